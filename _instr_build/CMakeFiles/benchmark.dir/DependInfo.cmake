@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/benchmark.cpp" "CMakeFiles/benchmark.dir/bench/benchmark.cpp.o" "gcc" "CMakeFiles/benchmark.dir/bench/benchmark.cpp.o.d"
+  "/root/repo/bench/order_generator.cpp" "CMakeFiles/benchmark.dir/bench/order_generator.cpp.o" "gcc" "CMakeFiles/benchmark.dir/bench/order_generator.cpp.o.d"
+  "/root/repo/bench/workload_generator.cpp" "CMakeFiles/benchmark.dir/bench/workload_generator.cpp.o" "gcc" "CMakeFiles/benchmark.dir/bench/workload_generator.cpp.o.d"
+  "/root/repo/src/engine_router.cpp" "CMakeFiles/benchmark.dir/src/engine_router.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/engine_router.cpp.o.d"
+  "/root/repo/src/instrument.cpp" "CMakeFiles/benchmark.dir/src/instrument.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/instrument.cpp.o.d"
+  "/root/repo/src/journal.cpp" "CMakeFiles/benchmark.dir/src/journal.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/journal.cpp.o.d"
+  "/root/repo/src/market_data.cpp" "CMakeFiles/benchmark.dir/src/market_data.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/market_data.cpp.o.d"
+  "/root/repo/src/matching_engine.cpp" "CMakeFiles/benchmark.dir/src/matching_engine.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/matching_engine.cpp.o.d"
+  "/root/repo/src/order_book.cpp" "CMakeFiles/benchmark.dir/src/order_book.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/order_book.cpp.o.d"
+  "/root/repo/src/order_log.cpp" "CMakeFiles/benchmark.dir/src/order_log.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/order_log.cpp.o.d"
+  "/root/repo/src/page_memory.cpp" "CMakeFiles/benchmark.dir/src/page_memory.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/page_memory.cpp.o.d"
+  "/root/repo/src/snapshot.cpp" "CMakeFiles/benchmark.dir/src/snapshot.cpp.o" "gcc" "CMakeFiles/benchmark.dir/src/snapshot.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
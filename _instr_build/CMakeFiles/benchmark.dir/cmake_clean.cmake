@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark.dir/bench/benchmark.cpp.o"
+  "CMakeFiles/benchmark.dir/bench/benchmark.cpp.o.d"
+  "CMakeFiles/benchmark.dir/bench/order_generator.cpp.o"
+  "CMakeFiles/benchmark.dir/bench/order_generator.cpp.o.d"
+  "CMakeFiles/benchmark.dir/bench/workload_generator.cpp.o"
+  "CMakeFiles/benchmark.dir/bench/workload_generator.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/engine_router.cpp.o"
+  "CMakeFiles/benchmark.dir/src/engine_router.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/instrument.cpp.o"
+  "CMakeFiles/benchmark.dir/src/instrument.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/journal.cpp.o"
+  "CMakeFiles/benchmark.dir/src/journal.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/market_data.cpp.o"
+  "CMakeFiles/benchmark.dir/src/market_data.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/matching_engine.cpp.o"
+  "CMakeFiles/benchmark.dir/src/matching_engine.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/order_book.cpp.o"
+  "CMakeFiles/benchmark.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/order_log.cpp.o"
+  "CMakeFiles/benchmark.dir/src/order_log.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/page_memory.cpp.o"
+  "CMakeFiles/benchmark.dir/src/page_memory.cpp.o.d"
+  "CMakeFiles/benchmark.dir/src/snapshot.cpp.o"
+  "CMakeFiles/benchmark.dir/src/snapshot.cpp.o.d"
+  "benchmark"
+  "benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/micro-benchmark.dir/bench/micro_benchmark.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/bench/micro_benchmark.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/bench/order_generator.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/bench/order_generator.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/bench/workload_generator.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/bench/workload_generator.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/engine_router.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/engine_router.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/instrument.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/instrument.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/journal.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/journal.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/market_data.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/market_data.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/matching_engine.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/matching_engine.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/order_book.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/order_log.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/order_log.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/page_memory.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/page_memory.cpp.o.d"
+  "CMakeFiles/micro-benchmark.dir/src/snapshot.cpp.o"
+  "CMakeFiles/micro-benchmark.dir/src/snapshot.cpp.o.d"
+  "micro-benchmark"
+  "micro-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/micro-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/engine_router.cpp" "CMakeFiles/order-book-server.dir/src/engine_router.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/engine_router.cpp.o.d"
+  "/root/repo/src/event_loop.cpp" "CMakeFiles/order-book-server.dir/src/event_loop.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/event_loop.cpp.o.d"
+  "/root/repo/src/event_loop_epoll.cpp" "CMakeFiles/order-book-server.dir/src/event_loop_epoll.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/event_loop_epoll.cpp.o.d"
+  "/root/repo/src/event_loop_kqueue.cpp" "CMakeFiles/order-book-server.dir/src/event_loop_kqueue.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/event_loop_kqueue.cpp.o.d"
+  "/root/repo/src/event_loop_uring.cpp" "CMakeFiles/order-book-server.dir/src/event_loop_uring.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/event_loop_uring.cpp.o.d"
+  "/root/repo/src/instrument.cpp" "CMakeFiles/order-book-server.dir/src/instrument.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/instrument.cpp.o.d"
+  "/root/repo/src/journal.cpp" "CMakeFiles/order-book-server.dir/src/journal.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/journal.cpp.o.d"
+  "/root/repo/src/market_data.cpp" "CMakeFiles/order-book-server.dir/src/market_data.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/market_data.cpp.o.d"
+  "/root/repo/src/matching_engine.cpp" "CMakeFiles/order-book-server.dir/src/matching_engine.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/matching_engine.cpp.o.d"
+  "/root/repo/src/order_book.cpp" "CMakeFiles/order-book-server.dir/src/order_book.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/order_book.cpp.o.d"
+  "/root/repo/src/order_log.cpp" "CMakeFiles/order-book-server.dir/src/order_log.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/order_log.cpp.o.d"
+  "/root/repo/src/page_memory.cpp" "CMakeFiles/order-book-server.dir/src/page_memory.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/page_memory.cpp.o.d"
+  "/root/repo/src/protocol.cpp" "CMakeFiles/order-book-server.dir/src/protocol.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/protocol.cpp.o.d"
+  "/root/repo/src/snapshot.cpp" "CMakeFiles/order-book-server.dir/src/snapshot.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/snapshot.cpp.o.d"
+  "/root/repo/src/tcp_server.cpp" "CMakeFiles/order-book-server.dir/src/tcp_server.cpp.o" "gcc" "CMakeFiles/order-book-server.dir/src/tcp_server.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/order-book-server.dir/src/engine_router.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/engine_router.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/event_loop.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/event_loop.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/event_loop_epoll.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/event_loop_epoll.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/event_loop_kqueue.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/event_loop_kqueue.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/event_loop_uring.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/event_loop_uring.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/instrument.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/instrument.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/journal.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/journal.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/market_data.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/market_data.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/matching_engine.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/matching_engine.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/order_book.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/order_log.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/order_log.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/page_memory.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/page_memory.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/protocol.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/protocol.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/snapshot.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/snapshot.cpp.o.d"
+  "CMakeFiles/order-book-server.dir/src/tcp_server.cpp.o"
+  "CMakeFiles/order-book-server.dir/src/tcp_server.cpp.o.d"
+  "order-book-server"
+  "order-book-server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/order-book-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
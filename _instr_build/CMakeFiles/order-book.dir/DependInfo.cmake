@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/csv_parser.cpp" "CMakeFiles/order-book.dir/src/csv_parser.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/csv_parser.cpp.o.d"
+  "/root/repo/src/engine_router.cpp" "CMakeFiles/order-book.dir/src/engine_router.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/engine_router.cpp.o.d"
+  "/root/repo/src/instrument.cpp" "CMakeFiles/order-book.dir/src/instrument.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/instrument.cpp.o.d"
+  "/root/repo/src/journal.cpp" "CMakeFiles/order-book.dir/src/journal.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/journal.cpp.o.d"
+  "/root/repo/src/main.cpp" "CMakeFiles/order-book.dir/src/main.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/main.cpp.o.d"
+  "/root/repo/src/market_data.cpp" "CMakeFiles/order-book.dir/src/market_data.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/market_data.cpp.o.d"
+  "/root/repo/src/matching_engine.cpp" "CMakeFiles/order-book.dir/src/matching_engine.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/matching_engine.cpp.o.d"
+  "/root/repo/src/order_book.cpp" "CMakeFiles/order-book.dir/src/order_book.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/order_book.cpp.o.d"
+  "/root/repo/src/order_log.cpp" "CMakeFiles/order-book.dir/src/order_log.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/order_log.cpp.o.d"
+  "/root/repo/src/page_memory.cpp" "CMakeFiles/order-book.dir/src/page_memory.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/page_memory.cpp.o.d"
+  "/root/repo/src/snapshot.cpp" "CMakeFiles/order-book.dir/src/snapshot.cpp.o" "gcc" "CMakeFiles/order-book.dir/src/snapshot.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/order-book.dir/src/csv_parser.cpp.o"
+  "CMakeFiles/order-book.dir/src/csv_parser.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/engine_router.cpp.o"
+  "CMakeFiles/order-book.dir/src/engine_router.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/instrument.cpp.o"
+  "CMakeFiles/order-book.dir/src/instrument.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/journal.cpp.o"
+  "CMakeFiles/order-book.dir/src/journal.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/main.cpp.o"
+  "CMakeFiles/order-book.dir/src/main.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/market_data.cpp.o"
+  "CMakeFiles/order-book.dir/src/market_data.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/matching_engine.cpp.o"
+  "CMakeFiles/order-book.dir/src/matching_engine.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/order_book.cpp.o"
+  "CMakeFiles/order-book.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/order_log.cpp.o"
+  "CMakeFiles/order-book.dir/src/order_log.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/page_memory.cpp.o"
+  "CMakeFiles/order-book.dir/src/page_memory.cpp.o.d"
+  "CMakeFiles/order-book.dir/src/snapshot.cpp.o"
+  "CMakeFiles/order-book.dir/src/snapshot.cpp.o.d"
+  "order-book"
+  "order-book.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/order-book.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
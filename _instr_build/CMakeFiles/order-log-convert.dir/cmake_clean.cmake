@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/order-log-convert.dir/bench/order_generator.cpp.o"
+  "CMakeFiles/order-log-convert.dir/bench/order_generator.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/bench/workload_generator.cpp.o"
+  "CMakeFiles/order-log-convert.dir/bench/workload_generator.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/csv_parser.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/csv_parser.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/engine_router.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/engine_router.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/instrument.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/instrument.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/journal.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/journal.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/market_data.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/market_data.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/matching_engine.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/matching_engine.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/order_book.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/order_log.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/order_log.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/page_memory.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/page_memory.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/src/snapshot.cpp.o"
+  "CMakeFiles/order-log-convert.dir/src/snapshot.cpp.o.d"
+  "CMakeFiles/order-log-convert.dir/tools/order_log_convert.cpp.o"
+  "CMakeFiles/order-log-convert.dir/tools/order_log_convert.cpp.o.d"
+  "order-log-convert"
+  "order-log-convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/order-log-convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
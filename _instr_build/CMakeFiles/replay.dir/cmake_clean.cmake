@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/replay.dir/src/engine_router.cpp.o"
+  "CMakeFiles/replay.dir/src/engine_router.cpp.o.d"
+  "CMakeFiles/replay.dir/src/instrument.cpp.o"
+  "CMakeFiles/replay.dir/src/instrument.cpp.o.d"
+  "CMakeFiles/replay.dir/src/journal.cpp.o"
+  "CMakeFiles/replay.dir/src/journal.cpp.o.d"
+  "CMakeFiles/replay.dir/src/market_data.cpp.o"
+  "CMakeFiles/replay.dir/src/market_data.cpp.o.d"
+  "CMakeFiles/replay.dir/src/matching_engine.cpp.o"
+  "CMakeFiles/replay.dir/src/matching_engine.cpp.o.d"
+  "CMakeFiles/replay.dir/src/order_book.cpp.o"
+  "CMakeFiles/replay.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/replay.dir/src/order_log.cpp.o"
+  "CMakeFiles/replay.dir/src/order_log.cpp.o.d"
+  "CMakeFiles/replay.dir/src/page_memory.cpp.o"
+  "CMakeFiles/replay.dir/src/page_memory.cpp.o.d"
+  "CMakeFiles/replay.dir/src/snapshot.cpp.o"
+  "CMakeFiles/replay.dir/src/snapshot.cpp.o.d"
+  "CMakeFiles/replay.dir/tools/replay.cpp.o"
+  "CMakeFiles/replay.dir/tools/replay.cpp.o.d"
+  "replay"
+  "replay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
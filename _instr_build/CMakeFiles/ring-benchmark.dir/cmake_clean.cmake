@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ring-benchmark.dir/bench/ring_benchmark.cpp.o"
+  "CMakeFiles/ring-benchmark.dir/bench/ring_benchmark.cpp.o.d"
+  "ring-benchmark"
+  "ring-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ring-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
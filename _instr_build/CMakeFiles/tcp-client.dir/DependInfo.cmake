@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/protocol.cpp" "CMakeFiles/tcp-client.dir/src/protocol.cpp.o" "gcc" "CMakeFiles/tcp-client.dir/src/protocol.cpp.o.d"
+  "/root/repo/tools/tcp_client.cpp" "CMakeFiles/tcp-client.dir/tools/tcp_client.cpp.o" "gcc" "CMakeFiles/tcp-client.dir/tools/tcp_client.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
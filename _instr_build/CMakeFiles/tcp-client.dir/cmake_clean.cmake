@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp-client.dir/src/protocol.cpp.o"
+  "CMakeFiles/tcp-client.dir/src/protocol.cpp.o.d"
+  "CMakeFiles/tcp-client.dir/tools/tcp_client.cpp.o"
+  "CMakeFiles/tcp-client.dir/tools/tcp_client.cpp.o.d"
+  "tcp-client"
+  "tcp-client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp-client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/workload_generator.cpp" "CMakeFiles/tests.dir/bench/workload_generator.cpp.o" "gcc" "CMakeFiles/tests.dir/bench/workload_generator.cpp.o.d"
+  "/root/repo/src/csv_parser.cpp" "CMakeFiles/tests.dir/src/csv_parser.cpp.o" "gcc" "CMakeFiles/tests.dir/src/csv_parser.cpp.o.d"
+  "/root/repo/src/engine_router.cpp" "CMakeFiles/tests.dir/src/engine_router.cpp.o" "gcc" "CMakeFiles/tests.dir/src/engine_router.cpp.o.d"
+  "/root/repo/src/event_loop.cpp" "CMakeFiles/tests.dir/src/event_loop.cpp.o" "gcc" "CMakeFiles/tests.dir/src/event_loop.cpp.o.d"
+  "/root/repo/src/event_loop_epoll.cpp" "CMakeFiles/tests.dir/src/event_loop_epoll.cpp.o" "gcc" "CMakeFiles/tests.dir/src/event_loop_epoll.cpp.o.d"
+  "/root/repo/src/event_loop_kqueue.cpp" "CMakeFiles/tests.dir/src/event_loop_kqueue.cpp.o" "gcc" "CMakeFiles/tests.dir/src/event_loop_kqueue.cpp.o.d"
+  "/root/repo/src/event_loop_uring.cpp" "CMakeFiles/tests.dir/src/event_loop_uring.cpp.o" "gcc" "CMakeFiles/tests.dir/src/event_loop_uring.cpp.o.d"
+  "/root/repo/src/instrument.cpp" "CMakeFiles/tests.dir/src/instrument.cpp.o" "gcc" "CMakeFiles/tests.dir/src/instrument.cpp.o.d"
+  "/root/repo/src/journal.cpp" "CMakeFiles/tests.dir/src/journal.cpp.o" "gcc" "CMakeFiles/tests.dir/src/journal.cpp.o.d"
+  "/root/repo/src/market_data.cpp" "CMakeFiles/tests.dir/src/market_data.cpp.o" "gcc" "CMakeFiles/tests.dir/src/market_data.cpp.o.d"
+  "/root/repo/src/matching_engine.cpp" "CMakeFiles/tests.dir/src/matching_engine.cpp.o" "gcc" "CMakeFiles/tests.dir/src/matching_engine.cpp.o.d"
+  "/root/repo/src/order_book.cpp" "CMakeFiles/tests.dir/src/order_book.cpp.o" "gcc" "CMakeFiles/tests.dir/src/order_book.cpp.o.d"
+  "/root/repo/src/order_log.cpp" "CMakeFiles/tests.dir/src/order_log.cpp.o" "gcc" "CMakeFiles/tests.dir/src/order_log.cpp.o.d"
+  "/root/repo/src/page_memory.cpp" "CMakeFiles/tests.dir/src/page_memory.cpp.o" "gcc" "CMakeFiles/tests.dir/src/page_memory.cpp.o.d"
+  "/root/repo/src/snapshot.cpp" "CMakeFiles/tests.dir/src/snapshot.cpp.o" "gcc" "CMakeFiles/tests.dir/src/snapshot.cpp.o.d"
+  "/root/repo/tests/test_csv_parser.cpp" "CMakeFiles/tests.dir/tests/test_csv_parser.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_csv_parser.cpp.o.d"
+  "/root/repo/tests/test_engine_router.cpp" "CMakeFiles/tests.dir/tests/test_engine_router.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_engine_router.cpp.o.d"
+  "/root/repo/tests/test_event_loop.cpp" "CMakeFiles/tests.dir/tests/test_event_loop.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_event_loop.cpp.o.d"
+  "/root/repo/tests/test_instrument.cpp" "CMakeFiles/tests.dir/tests/test_instrument.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_instrument.cpp.o.d"
+  "/root/repo/tests/test_journal.cpp" "CMakeFiles/tests.dir/tests/test_journal.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_journal.cpp.o.d"
+  "/root/repo/tests/test_ladder_levels.cpp" "CMakeFiles/tests.dir/tests/test_ladder_levels.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_ladder_levels.cpp.o.d"
+  "/root/repo/tests/test_latency_histogram.cpp" "CMakeFiles/tests.dir/tests/test_latency_histogram.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_latency_histogram.cpp.o.d"
+  "/root/repo/tests/test_market_data.cpp" "CMakeFiles/tests.dir/tests/test_market_data.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_market_data.cpp.o.d"
+  "/root/repo/tests/test_matching_engine.cpp" "CMakeFiles/tests.dir/tests/test_matching_engine.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_matching_engine.cpp.o.d"
+  "/root/repo/tests/test_node_pool.cpp" "CMakeFiles/tests.dir/tests/test_node_pool.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_node_pool.cpp.o.d"
+  "/root/repo/tests/test_object_pool.cpp" "CMakeFiles/tests.dir/tests/test_object_pool.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_object_pool.cpp.o.d"
+  "/root/repo/tests/test_order_book.cpp" "CMakeFiles/tests.dir/tests/test_order_book.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_order_book.cpp.o.d"
+  "/root/repo/tests/test_order_index.cpp" "CMakeFiles/tests.dir/tests/test_order_index.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_order_index.cpp.o.d"
+  "/root/repo/tests/test_order_log.cpp" "CMakeFiles/tests.dir/tests/test_order_log.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_order_log.cpp.o.d"
+  "/root/repo/tests/test_price_level.cpp" "CMakeFiles/tests.dir/tests/test_price_level.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_price_level.cpp.o.d"
+  "/root/repo/tests/test_snapshot.cpp" "CMakeFiles/tests.dir/tests/test_snapshot.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_snapshot.cpp.o.d"
+  "/root/repo/tests/test_spsc_ring.cpp" "CMakeFiles/tests.dir/tests/test_spsc_ring.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_spsc_ring.cpp.o.d"
+  "/root/repo/tests/test_workload_generator.cpp" "CMakeFiles/tests.dir/tests/test_workload_generator.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/test_workload_generator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_instr_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_instr_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,76 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/bench/workload_generator.cpp.o"
+  "CMakeFiles/tests.dir/bench/workload_generator.cpp.o.d"
+  "CMakeFiles/tests.dir/src/csv_parser.cpp.o"
+  "CMakeFiles/tests.dir/src/csv_parser.cpp.o.d"
+  "CMakeFiles/tests.dir/src/engine_router.cpp.o"
+  "CMakeFiles/tests.dir/src/engine_router.cpp.o.d"
+  "CMakeFiles/tests.dir/src/event_loop.cpp.o"
+  "CMakeFiles/tests.dir/src/event_loop.cpp.o.d"
+  "CMakeFiles/tests.dir/src/event_loop_epoll.cpp.o"
+  "CMakeFiles/tests.dir/src/event_loop_epoll.cpp.o.d"
+  "CMakeFiles/tests.dir/src/event_loop_kqueue.cpp.o"
+  "CMakeFiles/tests.dir/src/event_loop_kqueue.cpp.o.d"
+  "CMakeFiles/tests.dir/src/event_loop_uring.cpp.o"
+  "CMakeFiles/tests.dir/src/event_loop_uring.cpp.o.d"
+  "CMakeFiles/tests.dir/src/instrument.cpp.o"
+  "CMakeFiles/tests.dir/src/instrument.cpp.o.d"
+  "CMakeFiles/tests.dir/src/journal.cpp.o"
+  "CMakeFiles/tests.dir/src/journal.cpp.o.d"
+  "CMakeFiles/tests.dir/src/market_data.cpp.o"
+  "CMakeFiles/tests.dir/src/market_data.cpp.o.d"
+  "CMakeFiles/tests.dir/src/matching_engine.cpp.o"
+  "CMakeFiles/tests.dir/src/matching_engine.cpp.o.d"
+  "CMakeFiles/tests.dir/src/order_book.cpp.o"
+  "CMakeFiles/tests.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/tests.dir/src/order_log.cpp.o"
+  "CMakeFiles/tests.dir/src/order_log.cpp.o.d"
+  "CMakeFiles/tests.dir/src/page_memory.cpp.o"
+  "CMakeFiles/tests.dir/src/page_memory.cpp.o.d"
+  "CMakeFiles/tests.dir/src/snapshot.cpp.o"
+  "CMakeFiles/tests.dir/src/snapshot.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_csv_parser.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_csv_parser.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_engine_router.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_engine_router.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_event_loop.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_event_loop.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_instrument.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_instrument.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_journal.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_journal.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_ladder_levels.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_ladder_levels.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_latency_histogram.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_latency_histogram.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_market_data.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_market_data.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_matching_engine.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_matching_engine.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_node_pool.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_node_pool.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_object_pool.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_object_pool.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_order_book.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_order_book.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_order_index.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_order_index.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_order_log.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_order_log.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_price_level.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_price_level.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_snapshot.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_snapshot.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_spsc_ring.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_spsc_ring.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/test_workload_generator.cpp.o"
+  "CMakeFiles/tests.dir/tests/test_workload_generator.cpp.o.d"
+  "tests"
+  "tests.pdb"
+  "tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
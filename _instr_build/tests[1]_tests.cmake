@@ -0,0 +1,529 @@
+add_test([=[OrderBookTest.EmptyBook<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.EmptyBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.EmptyBook<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.AddBidOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.AddBidOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.AddBidOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.AddAskOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.AddAskOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.AddAskOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.BestBidIsHighest<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.BestBidIsHighest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.BestBidIsHighest<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.BestAskIsLowest<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.BestAskIsLowest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.BestAskIsLowest<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.CancelOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.CancelOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.CancelOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.CancelNonExistent<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.CancelNonExistent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.CancelNonExistent<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.VolumeAtPrice<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.VolumeAtPrice]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.VolumeAtPrice<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.MultipleLevels<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.MultipleLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.MultipleLevels<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.CancelRemovesEmptyLevel<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.CancelRemovesEmptyLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.CancelRemovesEmptyLevel<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.TopTracksAddsAndCancels<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.TopTracksAddsAndCancels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.TopTracksAddsAndCancels<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.GetDepthFillsCallerBuffer<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/0.GetDepthFillsCallerBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.GetDepthFillsCallerBuffer<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.EmptyBook<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.EmptyBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.EmptyBook<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.AddBidOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.AddBidOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.AddBidOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.AddAskOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.AddAskOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.AddAskOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.BestBidIsHighest<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.BestBidIsHighest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.BestBidIsHighest<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.BestAskIsLowest<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.BestAskIsLowest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.BestAskIsLowest<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.CancelOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.CancelOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.CancelOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.CancelNonExistent<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.CancelNonExistent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.CancelNonExistent<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.VolumeAtPrice<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.VolumeAtPrice]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.VolumeAtPrice<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.MultipleLevels<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.MultipleLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.MultipleLevels<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.CancelRemovesEmptyLevel<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.CancelRemovesEmptyLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.CancelRemovesEmptyLevel<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.TopTracksAddsAndCancels<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.TopTracksAddsAndCancels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.TopTracksAddsAndCancels<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTest.GetDepthFillsCallerBuffer<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderBookTest/1.GetDepthFillsCallerBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTest.GetDepthFillsCallerBuffer<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.NoMatchWhenBookEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.LimitBuyMatchesSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.LimitSellMatchesBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.BuyAtHigherPriceMatchesLowerAsk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.NoMatchWhenPricesDontCross]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.PartialFillBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.PartialFillSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.FilledMakersLeaveLevelVolume]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.TopOfBookFollowsMatching]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.BuyMatchesMultipleAskLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.FIFOWithinPriceLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.CancelFromMiddleKeepsQueueOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.MarketBuyMatchesAllAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.MarketSellMatchesBids]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.MarketOrderEmptyBookDoesNotRest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.MarketOrderPartialFillRemainsDiscarded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.CancelExistingOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.CancelNonExistentOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.OrderIdsIncrement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.ManyOrdersNoMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.LargeMatchSweep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.SinkReceivesTradesInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.BatchMatchesSequentialCalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.BatchRejectsNewOrdersWhenPoolIsFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.AmendDownKeepsTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.AmendUpLosesTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.AmendPriceMovesLevelAndMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.AmendThatFillsCompletelyFreesTheOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.AmendCountsFilledQuantity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/0.BatchAmendAcksBeforeItsTrades]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.NoMatchWhenBookEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.LimitBuyMatchesSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.LimitSellMatchesBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.BuyAtHigherPriceMatchesLowerAsk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.NoMatchWhenPricesDontCross]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.PartialFillBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.PartialFillSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.FilledMakersLeaveLevelVolume]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.TopOfBookFollowsMatching]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.BuyMatchesMultipleAskLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.FIFOWithinPriceLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.CancelFromMiddleKeepsQueueOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.MarketBuyMatchesAllAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.MarketSellMatchesBids]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.MarketOrderEmptyBookDoesNotRest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.MarketOrderPartialFillRemainsDiscarded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.CancelExistingOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.CancelNonExistentOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.OrderIdsIncrement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.ManyOrdersNoMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.LargeMatchSweep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.SinkReceivesTradesInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.BatchMatchesSequentialCalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.BatchRejectsNewOrdersWhenPoolIsFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.AmendDownKeepsTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.AmendUpLosesTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.AmendPriceMovesLevelAndMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.AmendThatFillsCompletelyFreesTheOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.AmendCountsFilledQuantity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/1.BatchAmendAcksBeforeItsTrades]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.NoMatchWhenBookEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.LimitBuyMatchesSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.LimitSellMatchesBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.BuyAtHigherPriceMatchesLowerAsk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.NoMatchWhenPricesDontCross]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.PartialFillBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.PartialFillSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.FilledMakersLeaveLevelVolume]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.TopOfBookFollowsMatching]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.BuyMatchesMultipleAskLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.FIFOWithinPriceLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.CancelFromMiddleKeepsQueueOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.MarketBuyMatchesAllAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.MarketSellMatchesBids]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.MarketOrderEmptyBookDoesNotRest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.MarketOrderPartialFillRemainsDiscarded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.CancelExistingOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.CancelNonExistentOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.OrderIdsIncrement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.ManyOrdersNoMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.LargeMatchSweep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.SinkReceivesTradesInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.BatchMatchesSequentialCalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.BatchRejectsNewOrdersWhenPoolIsFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.AmendDownKeepsTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.AmendUpLosesTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.AmendPriceMovesLevelAndMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.AmendThatFillsCompletelyFreesTheOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.AmendCountsFilledQuantity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/2.BatchAmendAcksBeforeItsTrades]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.NoMatchWhenBookEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.LimitBuyMatchesSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.LimitSellMatchesBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.BuyAtHigherPriceMatchesLowerAsk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.NoMatchWhenPricesDontCross]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.PartialFillBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.PartialFillSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.FilledMakersLeaveLevelVolume]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.TopOfBookFollowsMatching]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.BuyMatchesMultipleAskLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.FIFOWithinPriceLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.CancelFromMiddleKeepsQueueOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.MarketBuyMatchesAllAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.MarketSellMatchesBids]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.MarketOrderEmptyBookDoesNotRest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.MarketOrderPartialFillRemainsDiscarded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.CancelExistingOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.CancelNonExistentOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.OrderIdsIncrement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.ManyOrdersNoMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.LargeMatchSweep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.SinkReceivesTradesInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.BatchMatchesSequentialCalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.BatchRejectsNewOrdersWhenPoolIsFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.AmendDownKeepsTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.AmendUpLosesTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.AmendPriceMovesLevelAndMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.AmendThatFillsCompletelyFreesTheOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.AmendCountsFilledQuantity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/3.BatchAmendAcksBeforeItsTrades]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.NoMatchWhenBookEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.LimitBuyMatchesSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.LimitSellMatchesBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.BuyAtHigherPriceMatchesLowerAsk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.NoMatchWhenPricesDontCross]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.PartialFillBuy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.PartialFillSell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.FilledMakersLeaveLevelVolume]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.TopOfBookFollowsMatching]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.BuyMatchesMultipleAskLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.FIFOWithinPriceLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.CancelFromMiddleKeepsQueueOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.MarketBuyMatchesAllAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.MarketSellMatchesBids]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.MarketOrderEmptyBookDoesNotRest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.MarketOrderPartialFillRemainsDiscarded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.CancelExistingOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.CancelNonExistentOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.OrderIdsIncrement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.ManyOrdersNoMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.LargeMatchSweep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.SinkReceivesTradesInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.BatchMatchesSequentialCalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.BatchRejectsNewOrdersWhenPoolIsFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.AmendDownKeepsTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.AmendUpLosesTimePriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.AmendPriceMovesLevelAndMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.AmendThatFillsCompletelyFreesTheOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.AmendCountsFilledQuantity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MatchingEngineTest/4.BatchAmendAcksBeforeItsTrades]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.AllocateAndDeallocate]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.AllocateAndDeallocate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.AllocateAndDeallocate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.ReusesDeallocatedMemory]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.ReusesDeallocatedMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.ReusesDeallocatedMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.GrowsWhenExhausted]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.GrowsWhenExhausted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.GrowsWhenExhausted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.HighVolume]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.HighVolume]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.HighVolume]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.ReserveGrowsAheadOfDemand]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.ReserveGrowsAheadOfDemand]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.ReserveGrowsAheadOfDemand]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.CapacityIsReservedUpFront]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.CapacityIsReservedUpFront]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.CapacityIsReservedUpFront]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.WithoutGrowthAllocateThrowsWhenFull]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.WithoutGrowthAllocateThrowsWhenFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.WithoutGrowthAllocateThrowsWhenFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.TracksHighWaterMark]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.TracksHighWaterMark]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.TracksHighWaterMark]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.HugePagesFallBackWhenNoneReserved]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.HugePagesFallBackWhenNoneReserved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.HugePagesFallBackWhenNoneReserved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPool.LockedPool]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ObjectPool.LockedPool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPool.LockedPool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PoolCache.ThreadsShareOnePool]=]  /root/repo/_instr_build/tests [==[--gtest_filter=PoolCache.ThreadsShareOnePool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PoolCache.ThreadsShareOnePool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderLevelsTest.FirstOrderCentersWindow]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LadderLevelsTest.FirstOrderCentersWindow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderLevelsTest.FirstOrderCentersWindow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderLevelsTest.OutlierGoesToSparseFallback]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LadderLevelsTest.OutlierGoesToSparseFallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderLevelsTest.OutlierGoesToSparseFallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderLevelsTest.TouchLeavingWindowRecenters]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LadderLevelsTest.TouchLeavingWindowRecenters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderLevelsTest.TouchLeavingWindowRecenters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderLevelsTest.RecenterPullsSparseLevelsIntoWindow]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LadderLevelsTest.RecenterPullsSparseLevelsIntoWindow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderLevelsTest.RecenterPullsSparseLevelsIntoWindow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderLevelsTest.IterationMergesLadderAndSparseInPriority]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LadderLevelsTest.IterationMergesLadderAndSparseInPriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderLevelsTest.IterationMergesLadderAndSparseInPriority]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderLevelsTest.PopBestAdvancesToNextOccupiedSlot]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LadderLevelsTest.PopBestAdvancesToNextOccupiedSlot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderLevelsTest.PopBestAdvancesToNextOccupiedSlot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderLevelsTest.OffGridPricesUseFallback]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LadderLevelsTest.OffGridPricesUseFallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderLevelsTest.OffGridPricesUseFallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceLevelTest.AppendKeepsFifoOrder]=]  /root/repo/_instr_build/tests [==[--gtest_filter=PriceLevelTest.AppendKeepsFifoOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceLevelTest.AppendKeepsFifoOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceLevelTest.PopFront]=]  /root/repo/_instr_build/tests [==[--gtest_filter=PriceLevelTest.PopFront]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceLevelTest.PopFront]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceLevelTest.RemoveFromMiddleHeadAndTail]=]  /root/repo/_instr_build/tests [==[--gtest_filter=PriceLevelTest.RemoveFromMiddleHeadAndTail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceLevelTest.RemoveFromMiddleHeadAndTail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceLevelTest.MoveLeavesSourceEmpty]=]  /root/repo/_instr_build/tests [==[--gtest_filter=PriceLevelTest.MoveLeavesSourceEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceLevelTest.MoveLeavesSourceEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlatOrderMap.InsertFindErase]=]  /root/repo/_instr_build/tests [==[--gtest_filter=FlatOrderMap.InsertFindErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatOrderMap.InsertFindErase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlatOrderMap.MatchesUnorderedMapUnderChurn]=]  /root/repo/_instr_build/tests [==[--gtest_filter=FlatOrderMap.MatchesUnorderedMapUnderChurn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatOrderMap.MatchesUnorderedMapUnderChurn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderIndex.SequentialIds]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderIndex.SequentialIds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderIndex.SequentialIds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderIndex.RetiresDeadChunks]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderIndex.RetiresDeadChunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderIndex.RetiresDeadChunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderIndex.HeadChunkIsNotRetired]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderIndex.HeadChunkIsNotRetired]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderIndex.HeadChunkIsNotRetired]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderIndex.FarAheadIdsUseFallback]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderIndex.FarAheadIdsUseFallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderIndex.FarAheadIdsUseFallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EngineRouter.SymbolsHaveIndependentBooks]=]  /root/repo/_instr_build/tests [==[--gtest_filter=EngineRouter.SymbolsHaveIndependentBooks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EngineRouter.SymbolsHaveIndependentBooks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EngineRouter.PerSymbolOrderIsPreservedAcrossShards]=]  /root/repo/_instr_build/tests [==[--gtest_filter=EngineRouter.PerSymbolOrderIsPreservedAcrossShards]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EngineRouter.PerSymbolOrderIsPreservedAcrossShards]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EngineRouter.AmendFillsCarryTheAmendedOrder]=]  /root/repo/_instr_build/tests [==[--gtest_filter=EngineRouter.AmendFillsCarryTheAmendedOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EngineRouter.AmendFillsCarryTheAmendedOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EngineRouter.StopDrainsSubmittedWork]=]  /root/repo/_instr_build/tests [==[--gtest_filter=EngineRouter.StopDrainsSubmittedWork]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EngineRouter.StopDrainsSubmittedWork]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscRing.PushPopFifo]=]  /root/repo/_instr_build/tests [==[--gtest_filter=SpscRing.PushPopFifo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscRing.PushPopFifo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscRing.FullRingRejectsPush]=]  /root/repo/_instr_build/tests [==[--gtest_filter=SpscRing.FullRingRejectsPush]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscRing.FullRingRejectsPush]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscRing.BulkOperationsWrapAndClamp]=]  /root/repo/_instr_build/tests [==[--gtest_filter=SpscRing.BulkOperationsWrapAndClamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscRing.BulkOperationsWrapAndClamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscRing.CrossThreadOrderAndCompleteness]=]  /root/repo/_instr_build/tests [==[--gtest_filter=SpscRing.CrossThreadOrderAndCompleteness]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscRing.CrossThreadOrderAndCompleteness]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Journal.AppendSyncAndReplay]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Journal.AppendSyncAndReplay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Journal.AppendSyncAndReplay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Journal.ReopenContinuesSequence]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Journal.ReopenContinuesSequence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Journal.ReopenContinuesSequence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Journal.RollsOverSegments]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Journal.RollsOverSegments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Journal.RollsOverSegments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Journal.TornTailIsDroppedAndOverwritten]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Journal.TornTailIsDroppedAndOverwritten]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Journal.TornTailIsDroppedAndOverwritten]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Journal.SyncDueByCountOrAge]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Journal.SyncDueByCountOrAge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Journal.SyncDueByCountOrAge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Journal.RouterRecoversBooksAndIds]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Journal.RouterRecoversBooksAndIds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Journal.RouterRecoversBooksAndIds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Journal.RouterRejectsDifferentShardCount]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Journal.RouterRejectsDifferentShardCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Journal.RouterRejectsDifferentShardCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Snapshot.EngineRoundTrip]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Snapshot.EngineRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Snapshot.EngineRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Snapshot.DamagedFileIsRejected]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Snapshot.DamagedFileIsRejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Snapshot.DamagedFileIsRejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Snapshot.RouterTruncatesJournalAndRecovers]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Snapshot.RouterTruncatesJournalAndRecovers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Snapshot.RouterTruncatesJournalAndRecovers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Snapshot.RouterSnapshotsEveryNRecords]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Snapshot.RouterSnapshotsEveryNRecords]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Snapshot.RouterSnapshotsEveryNRecords]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketData.RestsAndCancelsUpdateTheirLevel]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MarketData.RestsAndCancelsUpdateTheirLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketData.RestsAndCancelsUpdateTheirLevel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketData.SweepReportsEachLevelOnce]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MarketData.SweepReportsEachLevelOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketData.SweepReportsEachLevelOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketData.ConflationKeepsLatestPerLevel]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MarketData.ConflationKeepsLatestPerLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketData.ConflationKeepsLatestPerLevel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketData.PacketsStayUnderMtu]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MarketData.PacketsStayUnderMtu]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketData.PacketsStayUnderMtu]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketData.UdpTransportDelivers]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MarketData.UdpTransportDelivers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketData.UdpTransportDelivers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketData.BadAddressThrows]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MarketData.BadAddressThrows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketData.BadAddressThrows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketData.RouterPublishesShardDepth]=]  /root/repo/_instr_build/tests [==[--gtest_filter=MarketData.RouterPublishesShardDepth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketData.RouterPublishesShardDepth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParsePrice.FixedPointWithoutDoubles]=]  /root/repo/_instr_build/tests [==[--gtest_filter=ParsePrice.FixedPointWithoutDoubles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParsePrice.FixedPointWithoutDoubles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputBuffer.FormatsLikeStreams]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OutputBuffer.FormatsLikeStreams]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputBuffer.FormatsLikeStreams]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CsvParser.TradesCancelsAndSymbols]=]  /root/repo/_instr_build/tests [==[--gtest_filter=CsvParser.TradesCancelsAndSymbols]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CsvParser.TradesCancelsAndSymbols]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CsvParser.Amends]=]  /root/repo/_instr_build/tests [==[--gtest_filter=CsvParser.Amends]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CsvParser.Amends]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CsvParser.ReportsBadLines]=]  /root/repo/_instr_build/tests [==[--gtest_filter=CsvParser.ReportsBadLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CsvParser.ReportsBadLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CsvParser.FileAndStreamAgree]=]  /root/repo/_instr_build/tests [==[--gtest_filter=CsvParser.FileAndStreamAgree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CsvParser.FileAndStreamAgree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CsvParser.ParallelIngestMatchesSerial]=]  /root/repo/_instr_build/tests [==[--gtest_filter=CsvParser.ParallelIngestMatchesSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CsvParser.ParallelIngestMatchesSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderLog.RoundTripsRecords]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderLog.RoundTripsRecords]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderLog.RoundTripsRecords]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderLog.TruncatedFileKeepsWholeRecords]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderLog.TruncatedFileKeepsWholeRecords]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderLog.TruncatedFileKeepsWholeRecords]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderLog.RejectsOtherFiles]=]  /root/repo/_instr_build/tests [==[--gtest_filter=OrderLog.RejectsOtherFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderLog.RejectsOtherFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogram.SmallValuesAreExact]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LatencyHistogram.SmallValuesAreExact]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogram.SmallValuesAreExact]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogram.PercentilesWithinBucketError]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LatencyHistogram.PercentilesWithinBucketError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogram.PercentilesWithinBucketError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogram.HandlesExtremesAndMerges]=]  /root/repo/_instr_build/tests [==[--gtest_filter=LatencyHistogram.HandlesExtremesAndMerges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogram.HandlesExtremesAndMerges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TscClock.CalibratesAgainstSteadyClock]=]  /root/repo/_instr_build/tests [==[--gtest_filter=TscClock.CalibratesAgainstSteadyClock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TscClock.CalibratesAgainstSteadyClock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGenerator.CancelsAlwaysHitRestingOrders]=]  /root/repo/_instr_build/tests [==[--gtest_filter=WorkloadGenerator.CancelsAlwaysHitRestingOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGenerator.CancelsAlwaysHitRestingOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGenerator.RecentCancelsTargetYoungOrders]=]  /root/repo/_instr_build/tests [==[--gtest_filter=WorkloadGenerator.RecentCancelsTargetYoungOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGenerator.RecentCancelsTargetYoungOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGenerator.PricesClusterAtTheTouch]=]  /root/repo/_instr_build/tests [==[--gtest_filter=WorkloadGenerator.PricesClusterAtTheTouch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGenerator.PricesClusterAtTheTouch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGenerator.HawkesArrivalsAreOrderedAndBursty]=]  /root/repo/_instr_build/tests [==[--gtest_filter=WorkloadGenerator.HawkesArrivalsAreOrderedAndBursty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGenerator.HawkesArrivalsAreOrderedAndBursty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGenerator.SameSeedSameStream]=]  /root/repo/_instr_build/tests [==[--gtest_filter=WorkloadGenerator.SameSeedSameStream]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGenerator.SameSeedSameStream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Instrument.PublishedStatsAreVisibleFromAnotherThread]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Instrument.PublishedStatsAreVisibleFromAnotherThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Instrument.PublishedStatsAreVisibleFromAnotherThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Instrument.MergeAddsCountersAndHistograms]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Instrument.MergeAddsCountersAndHistograms]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Instrument.MergeAddsCountersAndHistograms]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Instrument.ReportNamesThreadsAndSkipsIdleOnes]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Instrument.ReportNamesThreadsAndSkipsIdleOnes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Instrument.ReportNamesThreadsAndSkipsIdleOnes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Instrument.EnabledPolicyRecordsWhateverTheBuildFlag]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Instrument.EnabledPolicyRecordsWhateverTheBuildFlag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Instrument.EnabledPolicyRecordsWhateverTheBuildFlag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePool.MapNodesRecycleFreedSlots]=]  /root/repo/_instr_build/tests [==[--gtest_filter=NodePool.MapNodesRecycleFreedSlots]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePool.MapNodesRecycleFreedSlots]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePool.ReserveCarvesAhead]=]  /root/repo/_instr_build/tests [==[--gtest_filter=NodePool.ReserveCarvesAhead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePool.ReserveCarvesAhead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePool.ArraysGoToTheHeap]=]  /root/repo/_instr_build/tests [==[--gtest_filter=NodePool.ArraysGoToTheHeap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePool.ArraysGoToTheHeap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePool.MapLevelsReuseLevelNodes]=]  /root/repo/_instr_build/tests [==[--gtest_filter=NodePool.MapLevelsReuseLevelNodes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePool.MapLevelsReuseLevelNodes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.DeliversIncomingBytes/epoll  # GetParam() = "epoll"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.DeliversIncomingBytes/epoll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.DeliversIncomingBytes/epoll  # GetParam() = "epoll"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.DeliversIncomingBytes/io_uring  # GetParam() = "io_uring"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.DeliversIncomingBytes/io_uring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.DeliversIncomingBytes/io_uring  # GetParam() = "io_uring"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.DeliversIncomingBytes/kqueue  # GetParam() = "kqueue"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.DeliversIncomingBytes/kqueue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.DeliversIncomingBytes/kqueue  # GetParam() = "kqueue"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.SendReachesPeer/epoll  # GetParam() = "epoll"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.SendReachesPeer/epoll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.SendReachesPeer/epoll  # GetParam() = "epoll"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.SendReachesPeer/io_uring  # GetParam() = "io_uring"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.SendReachesPeer/io_uring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.SendReachesPeer/io_uring  # GetParam() = "io_uring"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.SendReachesPeer/kqueue  # GetParam() = "kqueue"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.SendReachesPeer/kqueue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.SendReachesPeer/kqueue  # GetParam() = "kqueue"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.ReportsPeerClose/epoll  # GetParam() = "epoll"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.ReportsPeerClose/epoll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.ReportsPeerClose/epoll  # GetParam() = "epoll"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.ReportsPeerClose/io_uring  # GetParam() = "io_uring"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.ReportsPeerClose/io_uring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.ReportsPeerClose/io_uring  # GetParam() = "io_uring"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Backends/EventLoopTest.ReportsPeerClose/kqueue  # GetParam() = "kqueue"]=]  /root/repo/_instr_build/tests [==[--gtest_filter=Backends/EventLoopTest.ReportsPeerClose/kqueue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Backends/EventLoopTest.ReportsPeerClose/kqueue  # GetParam() = "kqueue"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_instr_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  tests_TESTS [==[OrderBookTest.EmptyBook<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.AddBidOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.AddAskOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.BestBidIsHighest<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.BestAskIsLowest<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.CancelOrder<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.CancelNonExistent<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.VolumeAtPrice<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.MultipleLevels<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.CancelRemovesEmptyLevel<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.TopTracksAddsAndCancels<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.GetDepthFillsCallerBuffer<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>>]==] [==[OrderBookTest.EmptyBook<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.AddBidOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.AddAskOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.BestBidIsHighest<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.BestAskIsLowest<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.CancelOrder<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.CancelNonExistent<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.VolumeAtPrice<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.MultipleLevels<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.CancelRemovesEmptyLevel<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.TopTracksAddsAndCancels<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[OrderBookTest.GetDepthFillsCallerBuffer<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>>]==] [==[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::LadderLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::FlatOrderMap>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::HeapPool<ob::Order>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenBookEmpty<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitBuyMatchesSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LimitSellMatchesBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyAtHigherPriceMatchesLowerAsk<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.NoMatchWhenPricesDontCross<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillBuy<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.PartialFillSell<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FilledMakersLeaveLevelVolume<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.TopOfBookFollowsMatching<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BuyMatchesMultipleAskLevels<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.FIFOWithinPriceLevel<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelFromMiddleKeepsQueueOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketBuyMatchesAllAvailable<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketSellMatchesBids<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderEmptyBookDoesNotRest<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.MarketOrderPartialFillRemainsDiscarded<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelExistingOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.CancelNonExistentOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.OrderIdsIncrement<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.ManyOrdersNoMatch<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.LargeMatchSweep<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.SinkReceivesTradesInOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchMatchesSequentialCalls<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchRejectsNewOrdersWhenPoolIsFull<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendDownKeepsTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendUpLosesTimePriority<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendPriceMovesLevelAndMatches<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendThatFillsCompletelyFreesTheOrder<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.AmendCountsFilledQuantity<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] [==[MatchingEngineTest.BatchAmendAcksBeforeItsTrades<ob::BasicMatchingEngine<ob::BasicOrderBook<ob::MapLevels, ob::OrderIndex>, ob::ObjectPool<ob::Order, 4096ul>, ob::instrument::Enabled>>]==] ObjectPool.AllocateAndDeallocate ObjectPool.ReusesDeallocatedMemory ObjectPool.GrowsWhenExhausted ObjectPool.HighVolume ObjectPool.ReserveGrowsAheadOfDemand ObjectPool.CapacityIsReservedUpFront ObjectPool.WithoutGrowthAllocateThrowsWhenFull ObjectPool.TracksHighWaterMark ObjectPool.HugePagesFallBackWhenNoneReserved ObjectPool.LockedPool PoolCache.ThreadsShareOnePool LadderLevelsTest.FirstOrderCentersWindow LadderLevelsTest.OutlierGoesToSparseFallback LadderLevelsTest.TouchLeavingWindowRecenters LadderLevelsTest.RecenterPullsSparseLevelsIntoWindow LadderLevelsTest.IterationMergesLadderAndSparseInPriority LadderLevelsTest.PopBestAdvancesToNextOccupiedSlot LadderLevelsTest.OffGridPricesUseFallback PriceLevelTest.AppendKeepsFifoOrder PriceLevelTest.PopFront PriceLevelTest.RemoveFromMiddleHeadAndTail PriceLevelTest.MoveLeavesSourceEmpty FlatOrderMap.InsertFindErase FlatOrderMap.MatchesUnorderedMapUnderChurn OrderIndex.SequentialIds OrderIndex.RetiresDeadChunks OrderIndex.HeadChunkIsNotRetired OrderIndex.FarAheadIdsUseFallback EngineRouter.SymbolsHaveIndependentBooks EngineRouter.PerSymbolOrderIsPreservedAcrossShards EngineRouter.AmendFillsCarryTheAmendedOrder EngineRouter.StopDrainsSubmittedWork SpscRing.PushPopFifo SpscRing.FullRingRejectsPush SpscRing.BulkOperationsWrapAndClamp SpscRing.CrossThreadOrderAndCompleteness Journal.AppendSyncAndReplay Journal.ReopenContinuesSequence Journal.RollsOverSegments Journal.TornTailIsDroppedAndOverwritten Journal.SyncDueByCountOrAge Journal.RouterRecoversBooksAndIds Journal.RouterRejectsDifferentShardCount Snapshot.EngineRoundTrip Snapshot.DamagedFileIsRejected Snapshot.RouterTruncatesJournalAndRecovers Snapshot.RouterSnapshotsEveryNRecords MarketData.RestsAndCancelsUpdateTheirLevel MarketData.SweepReportsEachLevelOnce MarketData.ConflationKeepsLatestPerLevel MarketData.PacketsStayUnderMtu MarketData.UdpTransportDelivers MarketData.BadAddressThrows MarketData.RouterPublishesShardDepth ParsePrice.FixedPointWithoutDoubles OutputBuffer.FormatsLikeStreams CsvParser.TradesCancelsAndSymbols CsvParser.Amends CsvParser.ReportsBadLines CsvParser.FileAndStreamAgree CsvParser.ParallelIngestMatchesSerial OrderLog.RoundTripsRecords OrderLog.TruncatedFileKeepsWholeRecords OrderLog.RejectsOtherFiles LatencyHistogram.SmallValuesAreExact LatencyHistogram.PercentilesWithinBucketError LatencyHistogram.HandlesExtremesAndMerges TscClock.CalibratesAgainstSteadyClock WorkloadGenerator.CancelsAlwaysHitRestingOrders WorkloadGenerator.RecentCancelsTargetYoungOrders WorkloadGenerator.PricesClusterAtTheTouch WorkloadGenerator.HawkesArrivalsAreOrderedAndBursty WorkloadGenerator.SameSeedSameStream Instrument.PublishedStatsAreVisibleFromAnotherThread Instrument.MergeAddsCountersAndHistograms Instrument.ReportNamesThreadsAndSkipsIdleOnes Instrument.EnabledPolicyRecordsWhateverTheBuildFlag NodePool.MapNodesRecycleFreedSlots NodePool.ReserveCarvesAhead NodePool.ArraysGoToTheHeap NodePool.MapLevelsReuseLevelNodes [==[Backends/EventLoopTest.DeliversIncomingBytes/epoll  # GetParam() = "epoll"]==] [==[Backends/EventLoopTest.DeliversIncomingBytes/io_uring  # GetParam() = "io_uring"]==] [==[Backends/EventLoopTest.DeliversIncomingBytes/kqueue  # GetParam() = "kqueue"]==] [==[Backends/EventLoopTest.SendReachesPeer/epoll  # GetParam() = "epoll"]==] [==[Backends/EventLoopTest.SendReachesPeer/io_uring  # GetParam() = "io_uring"]==] [==[Backends/EventLoopTest.SendReachesPeer/kqueue  # GetParam() = "kqueue"]==] [==[Backends/EventLoopTest.ReportsPeerClose/epoll  # GetParam() = "epoll"]==] [==[Backends/EventLoopTest.ReportsPeerClose/io_uring  # GetParam() = "io_uring"]==] [==[Backends/EventLoopTest.ReportsPeerClose/kqueue  # GetParam() = "kqueue"]==])
@@ -1,60 +1,149 @@
 #include "matching_engine.h"
 #include "order_generator.h"
+#include "order_log.h"
+#include "workload_generator.h"
+#include "latency_histogram.h"
+#include "tsc_clock.h"
 #include <chrono>
 #include <iostream>
 #include <vector>
 #include <algorithm>
-#include <numeric>
 #include <cstring>
 #include <iomanip>
+#include <string>
+#include <span>
 
-using Clock = std::chrono::high_resolution_clock;
+using Clock = std::chrono::steady_clock;
+
+// How per-order latency is sampled. Throughput always comes from one
+// steady_clock interval around the whole run.
+struct TimingOptions {
+    size_t sample_every = 1;   // time every Nth order; 0 times none
+    bool serialize = false;    // fenced counter reads (TscClock::begin/end)
+};
 
 struct BenchResult {
     double throughput;  // orders/sec
     double p50_ns, p95_ns, p99_ns, p999_ns;
     double mean_ns;
     uint64_t total_trades;
+    uint64_t samples;
 };
 
-BenchResult run_benchmark(const std::vector<ob::GeneratedOrder>& orders) {
-    ob::MatchingEngine engine;
-
-    std::vector<double> latencies;
-    latencies.reserve(orders.size());
+// Shared timer, calibrated once in main()
+const ob::TscClock* g_clock = nullptr;
 
-    auto total_start = Clock::now();
+BenchResult make_result(const ob::LatencyHistogram& hist, size_t orders, double total_sec,
+                        uint64_t trades) {
+    BenchResult result;
+    result.throughput = orders / total_sec;
+    result.mean_ns = g_clock->ns_per_tick() * hist.mean();
+    result.p50_ns = g_clock->to_ns(hist.percentile(50));
+    result.p95_ns = g_clock->to_ns(hist.percentile(95));
+    result.p99_ns = g_clock->to_ns(hist.percentile(99));
+    result.p999_ns = g_clock->to_ns(hist.percentile(99.9));
+    result.total_trades = trades;
+    result.samples = hist.count();
+    return result;
+}
 
-    for (const auto& order : orders) {
-        auto start = Clock::now();
+// Times fn() as one sample if this call is due, else just runs it.
+// Returns the elapsed ticks, or 0 if untimed.
+class Sampler {
+public:
+    explicit Sampler(const TimingOptions& opts)
+        : every_(opts.sample_every), serialize_(opts.serialize), countdown_(1) {}
 
-        if (order.is_cancel) {
-            engine.cancel_order(order.cancel_id);
-        } else {
-            engine.process_order(order.side, order.type, order.price, order.quantity);
+    template <typename F>
+    uint64_t run(F&& fn) {
+        if (every_ == 0 || --countdown_ != 0) {
+            fn();
+            return 0;
         }
+        countdown_ = every_;
+        uint64_t start = serialize_ ? ob::TscClock::begin() : ob::TscClock::now();
+        fn();
+        uint64_t end = serialize_ ? ob::TscClock::end() : ob::TscClock::now();
+        return end - start;
+    }
+
+private:
+    size_t every_;
+    bool serialize_;
+    size_t countdown_;
+};
 
-        auto end = Clock::now();
-        double ns = std::chrono::duration<double, std::nano>(end - start).count();
-        latencies.push_back(ns);
+template <typename Engine>
+BenchResult run_benchmark(const std::vector<ob::GeneratedOrder>& orders, const TimingOptions& opts) {
+    Engine engine;
+    ob::LatencyHistogram hist;
+    Sampler sampler(opts);
+
+    auto total_start = Clock::now();
+
+    for (const auto& order : orders) {
+        uint64_t ticks = sampler.run([&] {
+            if (order.is_cancel) {
+                engine.cancel_order(order.cancel_id);
+            } else {
+                // Sink form: measures matching without per-order vector allocation
+                engine.process_order(order.side, order.type, order.price, order.quantity,
+                                     [](const ob::Trade&) {});
+            }
+        });
+        if (ticks) hist.record(ticks);
     }
 
     auto total_end = Clock::now();
     double total_sec = std::chrono::duration<double>(total_end - total_start).count();
+    return make_result(hist, orders.size(), total_sec, engine.trade_count());
+}
 
-    std::sort(latencies.begin(), latencies.end());
-    size_t n = latencies.size();
+// Counts outcomes only; keeps the sink out of the measurement
+struct NullBatchSink {
+    void on_accept(const ob::OrderMessage&, ob::OrderId) {}
+    void on_trade(const ob::OrderMessage&, const ob::Trade&) {}
+    void on_cancel(const ob::OrderMessage&, bool) {}
+    void on_amend(const ob::OrderMessage&, bool) {}
+    void on_reject(const ob::OrderMessage&) {}
+};
 
-    BenchResult result;
-    result.throughput = n / total_sec;
-    result.mean_ns = std::accumulate(latencies.begin(), latencies.end(), 0.0) / n;
-    result.p50_ns = latencies[n * 50 / 100];
-    result.p95_ns = latencies[n * 95 / 100];
-    result.p99_ns = latencies[n * 99 / 100];
-    result.p999_ns = latencies[std::min(n - 1, n * 999 / 1000)];
-    result.total_trades = engine.trade_count();
+// Same workload fed through process_batch(), as the network layer would.
+// Latency is per batch divided by its size (amortized per order); sampling
+// picks every Nth batch.
+template <typename Engine>
+BenchResult run_batch_benchmark(const std::vector<ob::GeneratedOrder>& orders, size_t batch_size,
+                                const TimingOptions& opts) {
+    std::vector<ob::OrderMessage> msgs(orders.size());
+    for (size_t i = 0; i < orders.size(); ++i) {
+        const auto& o = orders[i];
+        auto& m = msgs[i];
+        m.msg_type = static_cast<uint8_t>(o.is_cancel ? ob::MsgType::CANCEL : ob::MsgType::NEW_ORDER);
+        m.side = static_cast<uint8_t>(o.side);
+        m.order_type = static_cast<uint8_t>(o.type);
+        m.order_id = o.cancel_id;
+        m.price = o.price;
+        m.quantity = o.quantity;
+    }
 
-    return result;
+    Engine engine;
+    NullBatchSink sink;
+    ob::LatencyHistogram hist;
+    Sampler sampler(opts);
+
+    auto total_start = Clock::now();
+
+    for (size_t i = 0; i < msgs.size(); i += batch_size) {
+        size_t n = std::min(batch_size, msgs.size() - i);
+        uint64_t ticks = sampler.run([&] {
+            engine.process_batch(std::span<const ob::OrderMessage>(msgs.data() + i, n), sink);
+        });
+        if (ticks) hist.record(ticks / n);
+    }
+
+    auto total_end = Clock::now();
+    double total_sec = std::chrono::duration<double>(total_end - total_start).count();
+    return make_result(hist, msgs.size(), total_sec, engine.trade_count());
 }
 
 void print_result(const char* label, const BenchResult& r, size_t order_count) {
@@ -63,8 +152,9 @@ void print_result(const char* label, const BenchResult& r, size_t order_count) {
     std::cout << "Trades:     " << r.total_trades << "\n";
     std::cout << std::fixed << std::setprecision(0);
     std::cout << "Throughput: " << r.throughput << " orders/sec\n";
+    if (r.samples == 0) return;
     std::cout << std::setprecision(1);
-    std::cout << "Latency (ns):\n";
+    std::cout << "Latency (ns, " << r.samples << " samples):\n";
     std::cout << "  mean:  " << r.mean_ns << "\n";
     std::cout << "  p50:   " << r.p50_ns << "\n";
     std::cout << "  p95:   " << r.p95_ns << "\n";
@@ -72,32 +162,125 @@ void print_result(const char* label, const BenchResult& r, size_t order_count) {
     std::cout << "  p99.9: " << r.p999_ns << "\n";
 }
 
+// Run one workload against each selected book backend
+void run_workload(const char* label, const std::vector<ob::GeneratedOrder>& orders,
+                  bool run_map, bool run_ladder, const TimingOptions& timing) {
+    std::string name = label;
+    if (run_map) {
+        print_result((name + " [map]").c_str(),
+                     run_benchmark<ob::MatchingEngine>(orders, timing), orders.size());
+    }
+    if (run_ladder) {
+        print_result((name + " [ladder]").c_str(),
+                     run_benchmark<ob::LadderMatchingEngine>(orders, timing), orders.size());
+    }
+}
+
+// Usage: benchmark [--orders N] [--book map|ladder|both] [--sample N] [--serialize]
+//                  [--log FILE [--log-symbol ID]]
+//   --sample N    time every Nth order (default 1); 0 measures throughput only
+//   --serialize   fence each timestamp read so out-of-order execution can't
+//                 blur sample boundaries (adds the fence cost to each sample)
+//   --log FILE    also run the requests of one symbol (default 0) from a
+//                 binary order log, e.g. one converted from an ITCH feed
 int main(int argc, char* argv[]) {
     size_t order_count = 1'000'000;
+    TimingOptions timing;
+    std::string log_path;
+    ob::SymbolId log_symbol = 0;
+    bool run_map = true;
+    bool run_ladder = true;
 
     for (int i = 1; i < argc; ++i) {
         if (std::strcmp(argv[i], "--orders") == 0 && i + 1 < argc) {
             order_count = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--book") == 0 && i + 1 < argc) {
+            // map | ladder | both
+            std::string book = argv[++i];
+            run_map = (book == "map" || book == "both");
+            run_ladder = (book == "ladder" || book == "both");
+        } else if (std::strcmp(argv[i], "--sample") == 0 && i + 1 < argc) {
+            timing.sample_every = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--serialize") == 0) {
+            timing.serialize = true;
+        } else if (std::strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            log_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--log-symbol") == 0 && i + 1 < argc) {
+            log_symbol = static_cast<ob::SymbolId>(std::stoul(argv[++i]));
         }
     }
 
+    ob::TscClock clock;
+    g_clock = &clock;
+    std::cout << std::fixed << std::setprecision(3) << "Timer: " << clock.ns_per_tick()
+              << " ns/tick, read overhead " << clock.overhead_ticks() << " ticks ("
+              << clock.serialized_overhead_ticks() << " serialized)\n";
+
     std::cout << "Generating " << order_count << " random orders...\n";
     ob::OrderGenerator gen;
 
     // Benchmark 1: Mixed workload (limit + market + cancel)
     auto mixed_orders = gen.generate(order_count, 5, 10);
-    auto mixed_result = run_benchmark(mixed_orders);
-    print_result("Mixed Workload (5% cancel, 10% market)", mixed_result, order_count);
+    run_workload("Mixed Workload (5% cancel, 10% market)", mixed_orders, run_map, run_ladder, timing);
 
     // Benchmark 2: Pure limit orders (stress the book)
     auto limit_orders = gen.generate(order_count, 0, 0);
-    auto limit_result = run_benchmark(limit_orders);
-    print_result("Pure Limit Orders", limit_result, order_count);
+    run_workload("Pure Limit Orders", limit_orders, run_map, run_ladder, timing);
 
     // Benchmark 3: High cancel rate
     auto cancel_orders = gen.generate(order_count, 30, 5);
-    auto cancel_result = run_benchmark(cancel_orders);
-    print_result("High Cancel Rate (30%)", cancel_result, order_count);
+    run_workload("High Cancel Rate (30%)", cancel_orders, run_map, run_ladder, timing);
+
+    // Benchmarks 4-5: cancels that hit resting orders, prices clustered at
+    // the touch, heavy-tailed sizes
+    ob::WorkloadOptions realistic;
+    ob::WorkloadGenerator workload(realistic);
+    run_workload("Realistic (30% live cancels, near touch)", workload.generate(order_count),
+                 run_map, run_ladder, timing);
+
+    realistic.cancel_pct = 60;
+    realistic.cancel_age_mean = 5;
+    ob::WorkloadGenerator cancel_heavy(realistic);
+    run_workload("Cancel Heavy (60% live cancels, mostly recent)",
+                 cancel_heavy.generate(order_count), run_map, run_ladder, timing);
+
+    if (!log_path.empty()) {
+        ob::OrderLogReader log;
+        if (!log.open(log_path)) {
+            std::cerr << "Error: '" << log_path << "' is not a readable order log\n";
+            return 1;
+        }
+        std::vector<ob::GeneratedOrder> replayed;
+        for (const auto& r : log.records()) {
+            // GeneratedOrder has no amend; those records are skipped
+            if (r.msg.symbol_id != log_symbol ||
+                r.msg.msg_type == static_cast<uint8_t>(ob::MsgType::AMEND)) {
+                continue;
+            }
+            ob::GeneratedOrder o{};
+            o.is_cancel = r.msg.msg_type == static_cast<uint8_t>(ob::MsgType::CANCEL);
+            o.cancel_id = r.msg.order_id;
+            o.side = static_cast<ob::Side>(r.msg.side);
+            o.type = static_cast<ob::OrderType>(r.msg.order_type);
+            o.price = r.msg.price;
+            o.quantity = r.msg.quantity;
+            o.timestamp_ns = r.timestamp_ns;
+            replayed.push_back(o);
+        }
+        std::string label = "Order log " + log_path + " (symbol " + std::to_string(log_symbol) + ")";
+        if (!replayed.empty()) run_workload(label.c_str(), replayed, run_map, run_ladder, timing);
+    }
+
+    // Mixed workload submitted in batches
+    constexpr size_t BATCH = 64;
+    if (run_map) {
+        print_result("Mixed Workload, batched x64 [map]",
+                     run_batch_benchmark<ob::MatchingEngine>(mixed_orders, BATCH, timing), order_count);
+    }
+    if (run_ladder) {
+        print_result("Mixed Workload, batched x64 [ladder]",
+                     run_batch_benchmark<ob::LadderMatchingEngine>(mixed_orders, BATCH, timing), order_count);
+    }
 
     return 0;
 }
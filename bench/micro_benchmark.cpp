@@ -0,0 +1,337 @@
+#include "matching_engine.h"
+#include "object_pool.h"
+#include "order_generator.h"
+#include "price_level.h"
+#include "workload_generator.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Per-component microbenchmarks, so a regression in the end-to-end
+// benchmark can be pinned on the pool, the level queue, the book's level
+// container or the engine. Book and engine cases are templated on the
+// backend; a new backend gets the same cases by adding its instantiations
+// at the bottom, and the engine cases also run one engine per alternative
+// policy (flat order lookup, heap allocation, forced instrumentation).
+// Run with --benchmark_filter=<regex> to pick cases.
+
+using namespace ob;
+
+namespace {
+
+// Orders only exist in a pool (their cold half sits at a fixed offset)
+void fill_order(Order* o, OrderId id, Side side, Price price, Quantity qty = 10) {
+    *o = Order{};
+    o->id = id;
+    o->quantity = qty;
+    o->info() = {id, price, side, OrderType::LIMIT};
+}
+
+Order* make_order(ObjectPool<Order>& pool, OrderId id, Side side, Price price,
+                  Quantity qty = 10) {
+    Order* o = pool.allocate();
+    fill_order(o, id, side, price, qty);
+    return o;
+}
+
+// Engines differing from MatchingEngine in one policy each
+using FlatLookupEngine = BasicMatchingEngine<BasicOrderBook<MapLevels, FlatOrderMap>>;
+using HeapPoolEngine = BasicMatchingEngine<OrderBook, HeapPool<Order>>;
+using InstrumentedEngine = BasicMatchingEngine<OrderBook, ObjectPool<Order>, instrument::Enabled>;
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// ObjectPool
+
+// One slot out and straight back: the free list's best case
+void BM_PoolAllocFree(benchmark::State& state) {
+    ObjectPool<Order> pool;
+    for (auto _ : state) {
+        Order* o = pool.allocate();
+        benchmark::DoNotOptimize(o);
+        pool.deallocate(o);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PoolAllocFree);
+
+// Allocate N, then free them in allocation order (FIFO release)
+void BM_PoolBurst(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    ObjectPool<Order> pool;
+    pool.reserve(n);
+    std::vector<Order*> live(n);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) live[i] = pool.allocate();
+        benchmark::ClobberMemory();
+        for (size_t i = 0; i < n; ++i) pool.deallocate(live[i]);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_PoolBurst)->Arg(64)->Arg(4096)->Arg(65536);
+
+// Free in random order, as cancels do, so later allocations walk a
+// scrambled free list
+void BM_PoolScatteredFree(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    ObjectPool<Order> pool;
+    pool.reserve(n);
+    std::vector<Order*> live(n);
+    std::mt19937_64 rng(42);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) {
+            live[i] = pool.allocate();
+            live[i]->id = i;   // touch the slot, as a real order would
+        }
+        state.PauseTiming();
+        std::shuffle(live.begin(), live.end(), rng);
+        state.ResumeTiming();
+        for (size_t i = 0; i < n; ++i) pool.deallocate(live[i]);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_PoolScatteredFree)->Arg(4096)->Arg(65536);
+
+// The allocator the pool replaces, for reference
+void BM_HeapBurst(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<Order*> live(n);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) live[i] = new Order;
+        benchmark::ClobberMemory();
+        for (size_t i = 0; i < n; ++i) delete live[i];
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_HeapBurst)->Arg(64)->Arg(4096)->Arg(65536);
+
+// ---------------------------------------------------------------------------
+// PriceLevel
+
+// Level held at a steady depth: append at the back, pop from the front
+void BM_LevelAppendPop(benchmark::State& state) {
+    const auto depth = static_cast<size_t>(state.range(0));
+    ObjectPool<Order> pool;
+    PriceLevel level;
+    for (size_t i = 0; i < depth; ++i) level.add(make_order(pool, i, Side::BUY, 100));
+
+    Order* spare = make_order(pool, depth, Side::BUY, 100);
+    for (auto _ : state) {
+        Order* front = level.front();
+        level.pop_front();
+        level.add(spare);
+        spare = front;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LevelAppendPop)->Arg(1)->Arg(16)->Arg(1024);
+
+// Cancel from the middle of the queue and re-queue at the back
+void BM_LevelRemoveMiddle(benchmark::State& state) {
+    const auto depth = static_cast<size_t>(state.range(0));
+    ObjectPool<Order> pool;
+    std::vector<Order*> orders(depth);
+    PriceLevel level;
+    for (size_t i = 0; i < depth; ++i) {
+        orders[i] = make_order(pool, i, Side::BUY, 100);
+        level.add(orders[i]);
+    }
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> pick(0, depth - 1);
+    for (auto _ : state) {
+        Order* victim = orders[pick(rng)];
+        level.remove(victim);
+        level.add(victim);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LevelRemoveMiddle)->Arg(16)->Arg(1024)->Arg(65536);
+
+// ---------------------------------------------------------------------------
+// OrderBook
+
+// Add and cancel one order at a random existing price on a book holding
+// `levels` levels per side
+template <typename Book>
+void BM_BookAddCancel(benchmark::State& state) {
+    const auto levels = static_cast<Price>(state.range(0));
+    constexpr Price MID = 100000;
+    ObjectPool<Order> pool;
+    Book book;
+    OrderId id = 1;
+    for (Price p = 0; p < levels; ++p) {
+        for (int k = 0; k < 4; ++k) {
+            book.add_order(make_order(pool, id++, Side::BUY, MID - 1 - p));
+            book.add_order(make_order(pool, id++, Side::SELL, MID + 1 + p));
+        }
+    }
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<Price> depth(0, levels - 1);
+    Order* probe = pool.allocate();
+    for (auto _ : state) {
+        bool buy = rng() & 1;
+        Price offset = depth(rng);
+        fill_order(probe, id++, buy ? Side::BUY : Side::SELL,
+                   buy ? MID - 1 - offset : MID + 1 + offset);
+        book.add_order(probe);
+        benchmark::DoNotOptimize(book.cancel_order(probe->id));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_BookAddCancel, OrderBook)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_BookAddCancel, LadderOrderBook)->Arg(1)->Arg(64)->Arg(1024);
+
+// Create and empty a fresh level each time: the level container's insert
+// and erase path rather than the queue's
+template <typename Book>
+void BM_BookNewLevel(benchmark::State& state) {
+    const auto levels = static_cast<Price>(state.range(0));
+    constexpr Price MID = 100000;
+    ObjectPool<Order> pool;
+    Book book;
+    for (Price p = 0; p < levels; ++p) {
+        book.add_order(make_order(pool, p + 1, Side::BUY, MID - 2 * p));   // every other tick
+    }
+
+    OrderId id = levels + 1;
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<Price> gap(0, levels - 1);
+    Order* probe = pool.allocate();
+    for (auto _ : state) {
+        fill_order(probe, id++, Side::BUY, MID - 2 * gap(rng) - 1);
+        book.add_order(probe);
+        benchmark::DoNotOptimize(book.cancel_order(probe->id));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_BookNewLevel, OrderBook)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_BookNewLevel, LadderOrderBook)->Arg(64)->Arg(1024);
+
+// Add and cancel the only order at the best bid, with the next level
+// `gap` ticks behind it: every cancel has to find the new touch
+template <typename Book>
+void BM_BookCancelTouch(benchmark::State& state) {
+    const auto gap = static_cast<Price>(state.range(0));
+    constexpr Price MID = 100000;
+    ObjectPool<Order> pool;
+    Book book;
+    book.add_order(make_order(pool, 1, Side::BUY, MID - gap));
+
+    OrderId id = 2;
+    Order* probe = pool.allocate();
+    for (auto _ : state) {
+        fill_order(probe, id++, Side::BUY, MID);
+        book.add_order(probe);
+        benchmark::DoNotOptimize(book.cancel_order(probe->id));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_BookCancelTouch, OrderBook)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_BookCancelTouch, LadderOrderBook)->Arg(1)->Arg(64)->Arg(1024);
+
+// ---------------------------------------------------------------------------
+// MatchingEngine
+
+// One market order sweeping `levels` ask levels of `per_level` orders.
+// The book is rebuilt outside the timed region.
+template <typename Engine>
+void BM_EngineDeepSweep(benchmark::State& state) {
+    const auto levels = static_cast<Price>(state.range(0));
+    const auto per_level = static_cast<Quantity>(state.range(1));
+    auto engine = std::make_unique<Engine>();
+    auto noop = [](const Trade&) {};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (Price p = 0; p < levels; ++p) {
+            for (Quantity k = 0; k < per_level; ++k) {
+                engine->process_order(Side::SELL, OrderType::LIMIT, 10000 + p, 10, noop);
+            }
+        }
+        state.ResumeTiming();
+        engine->process_order(Side::BUY, OrderType::MARKET, 0,
+                              static_cast<Quantity>(levels) * per_level * 10, noop);
+    }
+    state.SetItemsProcessed(state.iterations() * levels * per_level);
+    state.counters["fills"] = static_cast<double>(levels * per_level);
+}
+BENCHMARK_TEMPLATE(BM_EngineDeepSweep, MatchingEngine)
+    ->Args({1, 1})->Args({10, 4})->Args({100, 4})->Args({1000, 1});
+BENCHMARK_TEMPLATE(BM_EngineDeepSweep, LadderMatchingEngine)
+    ->Args({1, 1})->Args({10, 4})->Args({100, 4})->Args({1000, 1});
+BENCHMARK_TEMPLATE(BM_EngineDeepSweep, FlatLookupEngine)->Args({10, 4})->Args({100, 4});
+BENCHMARK_TEMPLATE(BM_EngineDeepSweep, HeapPoolEngine)->Args({10, 4})->Args({100, 4});
+BENCHMARK_TEMPLATE(BM_EngineDeepSweep, InstrumentedEngine)->Args({10, 4})->Args({100, 4});
+
+// A generated stream replayed on a fresh engine per iteration, with the
+// cancel share as the parameter (the rest is 10% market, 90% limit)
+template <typename Engine>
+void BM_EngineFlow(benchmark::State& state) {
+    const auto cancel_pct = static_cast<int>(state.range(0));
+    constexpr size_t COUNT = 20000;
+    OrderGenerator gen;
+    const auto orders = gen.generate(COUNT, cancel_pct, 10);
+    auto noop = [](const Trade&) {};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto engine = std::make_unique<Engine>();
+        state.ResumeTiming();
+        for (const auto& o : orders) {
+            if (o.is_cancel) {
+                benchmark::DoNotOptimize(engine->cancel_order(o.cancel_id));
+            } else {
+                engine->process_order(o.side, o.type, o.price, o.quantity, noop);
+            }
+        }
+        state.PauseTiming();
+        engine.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK_TEMPLATE(BM_EngineFlow, MatchingEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineFlow, LadderMatchingEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineFlow, FlatLookupEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineFlow, HeapPoolEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineFlow, InstrumentedEngine)->Arg(5)->Arg(30)->Arg(60);
+
+// Same, from WorkloadGenerator: every cancel hits a resting order
+template <typename Engine>
+void BM_EngineLiveCancels(benchmark::State& state) {
+    constexpr size_t COUNT = 20000;
+    WorkloadOptions options;
+    options.cancel_pct = static_cast<int>(state.range(0));
+    WorkloadGenerator gen(options);
+    const auto orders = gen.generate(COUNT);
+    auto noop = [](const Trade&) {};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto engine = std::make_unique<Engine>();
+        state.ResumeTiming();
+        for (const auto& o : orders) {
+            if (o.is_cancel) {
+                benchmark::DoNotOptimize(engine->cancel_order(o.cancel_id));
+            } else {
+                engine->process_order(o.side, o.type, o.price, o.quantity, noop);
+            }
+        }
+        state.PauseTiming();
+        engine.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK_TEMPLATE(BM_EngineLiveCancels, MatchingEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineLiveCancels, LadderMatchingEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineLiveCancels, FlatLookupEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineLiveCancels, HeapPoolEngine)->Arg(5)->Arg(30)->Arg(60);
+BENCHMARK_TEMPLATE(BM_EngineLiveCancels, InstrumentedEngine)->Arg(5)->Arg(30)->Arg(60);
+
+BENCHMARK_MAIN();
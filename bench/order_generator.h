@@ -13,6 +13,7 @@ struct GeneratedOrder {
     Quantity quantity;
     bool is_cancel;
     OrderId cancel_id;
+    uint64_t timestamp_ns;   // arrival time, where the source has one
 };
 
 class OrderGenerator {
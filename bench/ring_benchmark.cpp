@@ -0,0 +1,130 @@
+#include "spsc_ring.h"
+#include "backoff.h"
+#include "protocol.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <memory>
+#include <thread>
+#include <cstring>
+#include <iomanip>
+
+using Clock = std::chrono::steady_clock;
+
+// Rings carry the same payload the router does: a session tag plus a wire message
+struct Item {
+    uint64_t         seq;
+    ob::OrderMessage msg;
+};
+
+constexpr size_t RING_CAPACITY = 1 << 14;
+using Ring = ob::SpscRing<Item, RING_CAPACITY>;
+
+// Producer pushes count items (in bursts of batch) while the consumer drains
+double run_throughput(size_t count, size_t batch) {
+    auto ring = std::make_unique<Ring>();
+    uint64_t checksum = 0;
+
+    auto start = Clock::now();
+
+    std::thread consumer([&] {
+        std::vector<Item> buf(batch);
+        size_t received = 0;
+        while (received < count) {
+            size_t n = ring->pop_bulk(buf.data(), batch);
+            if (n == 0) {
+                ob::cpu_relax();
+                continue;
+            }
+            for (size_t i = 0; i < n; ++i) checksum += buf[i].seq;
+            received += n;
+        }
+    });
+
+    std::vector<Item> buf(batch);
+    for (size_t sent = 0; sent < count;) {
+        size_t n = std::min(batch, count - sent);
+        for (size_t i = 0; i < n; ++i) buf[i].seq = sent + i;
+        size_t pushed = 0;
+        while (pushed < n) {
+            pushed += ring->push_bulk(buf.data() + pushed, n - pushed);
+            if (pushed < n) ob::cpu_relax();
+        }
+        sent += n;
+    }
+    consumer.join();
+
+    double sec = std::chrono::duration<double>(Clock::now() - start).count();
+    if (checksum != count * (count - 1) / 2) {
+        std::cerr << "checksum mismatch\n";
+    }
+    return count / sec;
+}
+
+// One item bounced through a request ring and a response ring; half the
+// round trip is the one-way hand-off latency
+std::vector<double> run_ping_pong(size_t rounds) {
+    auto request = std::make_unique<Ring>();
+    auto response = std::make_unique<Ring>();
+
+    std::thread echo([&] {
+        Item item;
+        for (size_t i = 0; i < rounds; ++i) {
+            while (!request->try_pop(item)) ob::cpu_relax();
+            while (!response->try_push(item)) ob::cpu_relax();
+        }
+    });
+
+    std::vector<double> latencies;
+    latencies.reserve(rounds);
+    Item item{};
+    for (size_t i = 0; i < rounds; ++i) {
+        item.seq = i;
+        auto start = Clock::now();
+        while (!request->try_push(item)) ob::cpu_relax();
+        while (!response->try_pop(item)) ob::cpu_relax();
+        auto end = Clock::now();
+        latencies.push_back(std::chrono::duration<double, std::nano>(end - start).count() / 2);
+    }
+    echo.join();
+    return latencies;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = 10'000'000;
+    size_t rounds = 200'000;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--items") == 0 && i + 1 < argc) {
+            count = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) {
+            rounds = std::stoull(argv[++i]);
+        }
+    }
+
+    std::cout << "SPSC ring: " << sizeof(Item) << "-byte items, capacity " << RING_CAPACITY << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    std::cout << "\n=== Throughput ===\n";
+    std::cout << std::fixed << std::setprecision(0);
+    for (size_t batch : {1, 16, 256}) {
+        std::cout << "  batch " << std::setw(3) << batch << ": "
+                  << run_throughput(count, batch) << " items/sec\n";
+    }
+
+    auto lat = run_ping_pong(rounds);
+    std::sort(lat.begin(), lat.end());
+    size_t n = lat.size();
+
+    std::cout << std::setprecision(1);
+    std::cout << "\n=== Hand-off latency (ns, one way) ===\n";
+    std::cout << "  mean:  " << std::accumulate(lat.begin(), lat.end(), 0.0) / n << "\n";
+    std::cout << "  p50:   " << lat[n * 50 / 100] << "\n";
+    std::cout << "  p95:   " << lat[n * 95 / 100] << "\n";
+    std::cout << "  p99:   " << lat[n * 99 / 100] << "\n";
+    std::cout << "  p99.9: " << lat[std::min(n - 1, n * 999 / 1000)] << "\n";
+
+    return 0;
+}
@@ -0,0 +1,198 @@
+#include "tcp_server.h"
+#include "engine_router.h"
+#include "cpu_affinity.h"
+#include "latency_histogram.h"
+#include "protocol.h"
+#include "shm_client.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+// Wakeup-to-ACK latency of the whole server (I/O thread, request ring,
+// shard, response ring, I/O thread) with the default blocking idle path
+// against --busy-poll, and busy-poll again with the client on the
+// shared-memory transport instead of TCP. One request at a time, with an
+// idle gap before each so the threads have gone quiet: blocking mode pays
+// an epoll wakeup and a shard backoff nap per request, busy-poll mode
+// should pay neither, and shared memory also skips the loopback stack.
+//
+// Usage: wakeup-benchmark [--pings N] [--gap-us G] [--port P]
+//                         [--io-core C] [--shard-core C] [--client-core C]
+//
+// Spinning threads only help on cores of their own; on a machine with
+// fewer cores than the server and client threads, busy-poll numbers mostly
+// measure preemption.
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct BenchOptions {
+    size_t pings = 20000;
+    int gap_us = 200;
+    uint16_t port = 9100;
+    int io_core = -1;
+    int shard_core = -1;
+    int client_core = -1;
+};
+
+int connect_with_retry(uint16_t port) {
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) == 0) {
+            int opt = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+            return fd;
+        }
+        close(fd);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return -1;
+}
+
+bool read_full(int fd, char* buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = read(fd, buf, len);
+        if (n <= 0) return false;
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Rest a bid, cancel it, repeat: every request is answered by exactly one
+// ACK and the book stays empty
+ob::OrderMessage ping_message(size_t i) {
+    ob::OrderMessage msg{};
+    if (i % 2 == 0) {
+        msg.msg_type = static_cast<uint8_t>(ob::MsgType::NEW_ORDER);
+        msg.side = static_cast<uint8_t>(ob::Side::BUY);
+        msg.order_type = static_cast<uint8_t>(ob::OrderType::LIMIT);
+        msg.price = 9000;
+        msg.quantity = 10;
+    } else {
+        msg.msg_type = static_cast<uint8_t>(ob::MsgType::CANCEL);
+        msg.order_id = i / 2 + 1;
+    }
+    return msg;
+}
+
+bool ping(int fd, size_t i, ob::LatencyHistogram& latency) {
+    ob::OrderMessage msg = ping_message(i);
+    char out[sizeof(ob::OrderMessage)];
+    char in[sizeof(ob::ResponseMessage)];
+    ob::serialize(msg, out);
+
+    auto start = Clock::now();
+    if (write(fd, out, sizeof(out)) != static_cast<ssize_t>(sizeof(out))) return false;
+    if (!read_full(fd, in, sizeof(in))) return false;
+    latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    return true;
+}
+
+bool ping(ob::ShmClient& client, size_t i, ob::LatencyHistogram& latency) {
+    ob::ResponseMessage r;
+    auto start = Clock::now();
+    if (!client.send(ping_message(i)) || !client.receive(r, 1'000'000)) return false;
+    latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    return true;
+}
+
+template <typename Client>
+bool ping_all(const BenchOptions& opts, Client& client, ob::LatencyHistogram& latency) {
+    ob::pin_current_thread(opts.client_core);
+    for (size_t i = 0; i < opts.pings; ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(opts.gap_us));
+        if (!ping(client, i, latency)) return false;
+    }
+    return true;
+}
+
+bool run_mode(const BenchOptions& opts, bool busy_poll, bool shm, uint16_t port,
+              ob::LatencyHistogram& latency) {
+    ob::RouterOptions router_options;
+    router_options.busy_poll = busy_poll;
+    router_options.cores = {opts.shard_core};
+    ob::EngineRouter router(router_options);
+    router.start();
+
+    ob::ServerOptions server_options;
+    server_options.busy_poll = busy_poll;
+    server_options.core = opts.io_core;
+    if (shm) server_options.shm_name = "/ob-wakeup-" + std::to_string(port);
+    ob::TcpServer server(port, router, server_options);
+    std::thread io([&] { server.run(); });
+
+    bool ok = false;
+    int fd = connect_with_retry(port);   // also waits for the server to be up
+    if (fd >= 0 && shm) {
+        close(fd);
+        try {
+            ob::ShmClient client(server_options.shm_name);
+            ok = ping_all(opts, client, latency);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+        }
+    } else if (fd >= 0) {
+        ok = ping_all(opts, fd, latency);
+        close(fd);
+    }
+
+    // A blocking server notices within its 1-second wait timeout
+    server.shutdown();
+    io.join();
+    router.stop();
+    return ok;
+}
+
+void print_latency(const char* label, const ob::LatencyHistogram& h) {
+    std::cout << "  " << std::left << std::setw(10) << label << std::right
+              << " p50 " << std::setw(7) << h.percentile(50) / 1000.0
+              << "  p99 " << std::setw(7) << h.percentile(99) / 1000.0
+              << "  p99.9 " << std::setw(7) << h.percentile(99.9) / 1000.0
+              << "  max " << std::setw(8) << h.max() / 1000.0 << "\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--pings" && i + 1 < argc) opts.pings = std::stoul(argv[++i]);
+        else if (arg == "--gap-us" && i + 1 < argc) opts.gap_us = std::stoi(argv[++i]);
+        else if (arg == "--port" && i + 1 < argc) opts.port = static_cast<uint16_t>(std::stoi(argv[++i]));
+        else if (arg == "--io-core" && i + 1 < argc) opts.io_core = std::stoi(argv[++i]);
+        else if (arg == "--shard-core" && i + 1 < argc) opts.shard_core = std::stoi(argv[++i]);
+        else if (arg == "--client-core" && i + 1 < argc) opts.client_core = std::stoi(argv[++i]);
+    }
+
+    ob::LatencyHistogram blocking, spinning, shm;
+    if (!run_mode(opts, false, false, opts.port, blocking) ||
+        !run_mode(opts, true, false, static_cast<uint16_t>(opts.port + 1), spinning) ||
+        !run_mode(opts, true, true, static_cast<uint16_t>(opts.port + 2), shm)) {
+        std::cerr << "Error: lost the connection to the server\n";
+        return 1;
+    }
+
+    std::cout << "Wakeup-to-ACK latency (us), " << opts.pings << " requests, "
+              << opts.gap_us << " us idle before each\n";
+    std::cout << std::fixed << std::setprecision(1);
+    print_latency("blocking", blocking);
+    print_latency("busy-poll", spinning);
+    print_latency("shm", shm);
+    return 0;
+}
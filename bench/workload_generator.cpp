@@ -0,0 +1,176 @@
+#include "workload_generator.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace ob {
+
+void WorkloadGenerator::LiveSet::reset(size_t max_id) {
+    tree_.assign(max_id + 1, 0);
+    size_ = 0;
+}
+
+void WorkloadGenerator::LiveSet::add(OrderId id, int32_t delta) {
+    size_ += delta;
+    for (size_t i = id; i < tree_.size(); i += i & (~i + 1)) {
+        tree_[i] += delta;
+    }
+}
+
+OrderId WorkloadGenerator::LiveSet::kth(size_t k) const {
+    size_t pos = 0;
+    size_t step = std::bit_floor(tree_.size());
+    for (; step; step >>= 1) {
+        if (pos + step < tree_.size() && static_cast<size_t>(tree_[pos + step]) < k) {
+            pos += step;
+            k -= tree_[pos];
+        }
+    }
+    return pos + 1;
+}
+
+WorkloadGenerator::WorkloadGenerator(const WorkloadOptions& options, uint64_t seed)
+    : options_(options), rng_(seed) {}
+
+WorkloadGenerator::~WorkloadGenerator() = default;
+
+std::vector<GeneratedOrder> WorkloadGenerator::generate(size_t count) {
+    // Each call continues from an empty book, like a fresh replay
+    shadow_ = std::make_unique<MatchingEngine>();
+    live_.reset(count);
+    now_s_ = 0;
+    excitation_ = 0;
+
+    std::vector<GeneratedOrder> orders;
+    orders.reserve(count);
+    std::uniform_int_distribution<int> pct(0, 99);
+
+    for (size_t i = 0; i < count; ++i) {
+        bool cancel = live_.size() > 0 && pct(rng_) < options_.cancel_pct;
+        GeneratedOrder order = cancel ? make_cancel() : make_order();
+        order.timestamp_ns = static_cast<uint64_t>(next_arrival() * 1e9);
+        apply(order);
+        orders.push_back(order);
+    }
+    return orders;
+}
+
+GeneratedOrder WorkloadGenerator::make_cancel() {
+    size_t n = live_.size();
+    size_t rank = 0;   // 0-based from the chosen end
+    if (options_.cancel_age == WorkloadOptions::CancelAge::UNIFORM) {
+        rank = std::uniform_int_distribution<size_t>(0, n - 1)(rng_);
+    } else {
+        std::geometric_distribution<size_t> age(1.0 / (1.0 + options_.cancel_age_mean));
+        rank = std::min(age(rng_), n - 1);
+    }
+    size_t k = options_.cancel_age == WorkloadOptions::CancelAge::RECENT ? n - rank : rank + 1;
+
+    GeneratedOrder order{};
+    order.is_cancel = true;
+    order.cancel_id = live_.kth(k);
+    return order;
+}
+
+GeneratedOrder WorkloadGenerator::make_order() {
+    std::uniform_int_distribution<int> pct(0, 99);
+    GeneratedOrder order{};
+    order.side = (rng_() & 1) ? Side::BUY : Side::SELL;
+    order.quantity = pick_size();
+    if (pct(rng_) < options_.market_pct) {
+        order.type = OrderType::MARKET;
+        order.price = 0;
+    } else {
+        order.type = OrderType::LIMIT;
+        order.price = pick_price(order.side);
+    }
+    return order;
+}
+
+Price WorkloadGenerator::pick_price(Side side) {
+    if (options_.price_model == WorkloadOptions::PriceModel::UNIFORM) {
+        std::uniform_int_distribution<int> offset(-options_.spread_ticks, options_.spread_ticks);
+        return options_.center_price + offset(rng_);
+    }
+
+    std::geometric_distribution<Price> depth(1.0 / (1.0 + options_.touch_depth_mean));
+    auto bid = shadow_->book().best_bid();
+    auto ask = shadow_->book().best_ask();
+    bool buy = side == Side::BUY;
+
+    // Through the opposite touch: a marketable limit that may sweep a level or two
+    if (std::uniform_int_distribution<int>(0, 99)(rng_) < options_.aggressive_pct) {
+        if (auto far = buy ? ask : bid) {
+            Price through = depth(rng_) / 2;
+            return buy ? *far + through : std::max<Price>(1, *far - through);
+        }
+    }
+
+    // Behind the same-side touch; an empty side quotes off the other one
+    Price ref;
+    if (auto near = buy ? bid : ask) {
+        ref = *near;
+    } else if (auto far = buy ? ask : bid) {
+        ref = buy ? *far - 1 : *far + 1;
+    } else {
+        ref = buy ? options_.center_price - 1 : options_.center_price + 1;
+    }
+    Price behind = depth(rng_);
+    return buy ? std::max<Price>(1, ref - behind) : ref + behind;
+}
+
+Quantity WorkloadGenerator::pick_size() {
+    if (options_.size_model == WorkloadOptions::SizeModel::UNIFORM) {
+        return std::uniform_int_distribution<Quantity>(1, options_.size_max)(rng_);
+    }
+    double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+    double size = options_.size_min * std::pow(1.0 - u, -1.0 / options_.size_alpha);
+    return static_cast<Quantity>(std::min<double>(size, options_.size_max));
+}
+
+double WorkloadGenerator::next_arrival() {
+    switch (options_.arrivals) {
+    case WorkloadOptions::Arrivals::NONE:
+        return 0;
+    case WorkloadOptions::Arrivals::POISSON:
+        now_s_ += std::exponential_distribution<double>(options_.rate)(rng_);
+        return now_s_;
+    case WorkloadOptions::Arrivals::HAWKES:
+        break;
+    }
+
+    // Ogata thinning: intensity only decays between arrivals, so the
+    // current intensity bounds it until the next accepted point
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (;;) {
+        double bound = options_.rate + excitation_;
+        double wait = std::exponential_distribution<double>(bound)(rng_);
+        now_s_ += wait;
+        excitation_ *= std::exp(-options_.hawkes_beta * wait);
+        if (unit(rng_) * bound <= options_.rate + excitation_) {
+            excitation_ += options_.hawkes_alpha * options_.hawkes_beta;
+            return now_s_;
+        }
+    }
+}
+
+void WorkloadGenerator::apply(const GeneratedOrder& order) {
+    if (order.is_cancel) {
+        shadow_->cancel_order(order.cancel_id);
+        live_.erase(order.cancel_id);
+        return;
+    }
+
+    touched_.clear();
+    OrderId id = shadow_->process_order(order.side, order.type, order.price, order.quantity,
+                                        [&](const Trade& t) {
+        touched_.push_back(order.side == Side::BUY ? t.seller_order_id : t.buyer_order_id);
+    });
+    // An incoming order fills each maker at most once; partial fills stay live
+    for (OrderId maker : touched_) {
+        if (!shadow_->book().find_order(maker)) live_.erase(maker);
+    }
+    if (shadow_->book().find_order(id)) live_.insert(id);
+}
+
+} // namespace ob
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "order_generator.h"
+#include "matching_engine.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ob {
+
+struct WorkloadOptions {
+    int cancel_pct = 30;          // 0-100, share of requests that are cancels
+    int market_pct = 5;           // 0-100, share of new orders that are market
+
+    // Which live order a cancel picks, by age rank among resting orders
+    enum class CancelAge { UNIFORM, RECENT, OLDEST };
+    CancelAge cancel_age = CancelAge::RECENT;
+    double cancel_age_mean = 20;  // RECENT/OLDEST: mean rank from that end
+
+    // UNIFORM: center +/- spread_ticks. NEAR_TOUCH: a geometric number of
+    // ticks behind the same-side touch, or through the opposite touch for
+    // aggressive_pct of limits.
+    enum class PriceModel { UNIFORM, NEAR_TOUCH };
+    PriceModel price_model = PriceModel::NEAR_TOUCH;
+    Price center_price = 10000;
+    int spread_ticks = 100;
+    double touch_depth_mean = 4;
+    int aggressive_pct = 10;
+
+    // UNIFORM: 1..size_max. PARETO: size_min * U^(-1/size_alpha), capped.
+    enum class SizeModel { UNIFORM, PARETO };
+    SizeModel size_model = SizeModel::PARETO;
+    double size_alpha = 1.5;
+    Quantity size_min = 10;
+    Quantity size_max = 100000;
+
+    // Arrival timestamps (GeneratedOrder::timestamp_ns). HAWKES is
+    // self-exciting: each arrival raises the rate by hawkes_alpha *
+    // hawkes_beta, decaying at hawkes_beta per second, so orders come in
+    // bursts. Long-run rate is rate / (1 - hawkes_alpha).
+    enum class Arrivals { NONE, POISSON, HAWKES };
+    Arrivals arrivals = Arrivals::HAWKES;
+    double rate = 100000;         // baseline orders/sec
+    double hawkes_alpha = 0.7;    // branching ratio, < 1
+    double hawkes_beta = 2000;    // 1/sec
+};
+
+// Order stream shaped like real flow. Every request is applied to a
+// private shadow engine as it is generated, so the generator knows which
+// orders are resting and where the touch is: cancels always name a live
+// order, and an engine replaying the stream from empty assigns the same
+// ids and sees the same book.
+class WorkloadGenerator {
+public:
+    explicit WorkloadGenerator(const WorkloadOptions& options = {}, uint64_t seed = 42);
+    ~WorkloadGenerator();
+
+    std::vector<GeneratedOrder> generate(size_t count);
+
+private:
+    // Live ids as a Fenwick tree of 0/1, so the k-th oldest resting order
+    // is a log-time lookup
+    class LiveSet {
+    public:
+        void reset(size_t max_id);
+        void insert(OrderId id) { add(id, 1); }
+        void erase(OrderId id) { add(id, -1); }
+        size_t size() const { return size_; }
+        OrderId kth(size_t k) const;   // 1-based, oldest first
+    private:
+        std::vector<int32_t> tree_;
+        size_t size_ = 0;
+        void add(OrderId id, int32_t delta);
+    };
+
+    WorkloadOptions options_;
+    std::mt19937_64 rng_;
+    std::unique_ptr<MatchingEngine> shadow_;
+    LiveSet live_;
+    std::vector<OrderId> touched_;
+    double now_s_ = 0;
+    double excitation_ = 0;
+
+    GeneratedOrder make_cancel();
+    GeneratedOrder make_order();
+    Price pick_price(Side side);
+    Quantity pick_size();
+    double next_arrival();
+    void apply(const GeneratedOrder& order);
+};
+
+} // namespace ob
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace ob {
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+// Idle strategy for polling threads: spin briefly, then yield, then nap.
+// Call idle() after each empty poll and reset() after useful work, so a
+// busy thread never leaves the spin phase and an idle one stops burning
+// its core. A spin-only Backoff never leaves the spin phase at all, for a
+// thread that owns an isolated core and must not pay a wakeup.
+class Backoff {
+public:
+    explicit Backoff(bool spin_only = false) : spin_only_(spin_only) {}
+
+    void idle() {
+        if (spin_only_ || count_ < SPIN_LIMIT) {
+            cpu_relax();
+        } else if (count_ < YIELD_LIMIT) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        ++count_;
+    }
+
+    void reset() { count_ = 0; }
+
+private:
+    static constexpr uint32_t SPIN_LIMIT = 256;
+    static constexpr uint32_t YIELD_LIMIT = 512;
+    bool spin_only_;
+    uint32_t count_ = 0;
+};
+
+} // namespace ob
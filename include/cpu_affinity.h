@@ -0,0 +1,45 @@
+#pragma once
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include <filesystem>
+#include <string>
+
+namespace ob {
+
+// Pin the calling thread to one CPU. Returns false if the platform has no
+// affinity API or the core is unavailable; the thread keeps running unpinned.
+inline bool pin_current_thread(int core) {
+    if (core < 0) return false;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+// NUMA node a CPU belongs to, from sysfs; -1 if unknown (not Linux, no
+// NUMA support, or no such core)
+inline int numa_node_of(int core) {
+    if (core < 0) return -1;
+#ifdef __linux__
+    std::error_code ec;
+    std::filesystem::directory_iterator it(
+        "/sys/devices/system/cpu/cpu" + std::to_string(core), ec);
+    if (ec) return -1;
+    for (const auto& entry : it) {
+        std::string name = entry.path().filename().string();
+        if (name.size() > 4 && name.compare(0, 4, "node") == 0) {
+            return std::stoi(name.substr(4));
+        }
+    }
+#endif
+    return -1;
+}
+
+} // namespace ob
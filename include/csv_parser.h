@@ -1,7 +1,12 @@
 #pragma once
 
 #include "matching_engine.h"
+#include "output_buffer.h"
+#include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <iostream>
 
 namespace ob {
@@ -10,21 +15,94 @@ namespace ob {
 //   LIMIT,BUY,150.25,100
 //   MARKET,SELL,,50
 //   CANCEL,,,,5
+//   AMEND,,150.20,60,5      order 5 to 60 (total, filled included) at 150.20
 //   PRINT
+// An optional 6th field names the symbol; each symbol has its own book and
+// order-id sequence, and output for a named symbol ends with its name:
+//   LIMIT,BUY,150.25,100,,AAPL
+//   CANCEL,,,,5,AAPL
+//   PRINT,AAPL
+// Lines without a symbol go to the engine passed to the constructor.
+//
+// Lines are tokenized in place as string_views and numbers parsed with
+// from_chars, so a line costs no allocation; output is staged in an
+// OutputBuffer.
+//
+// Parsing a line (parse_line) is separate from applying it (execute), so
+// large inputs can be parsed by several threads while one thread applies
+// the commands in input order.
+
+// One parsed line. Views point into the input, which must outlive it.
+struct CsvCommand {
+    enum Kind : uint8_t { NONE, ORDER, CANCEL, AMEND, PRINT, ERROR };
+    enum Error : uint8_t {
+        CANCEL_NEEDS_ID,
+        AMEND_FIELDS,
+        BAD_ORDER_ID,
+        EXPECTED_FIELDS,
+        UNKNOWN_COMMAND,
+        UNKNOWN_SIDE,
+        PRICE_REQUIRED,
+        BAD_PRICE,
+        BAD_QUANTITY,
+        ZERO_QUANTITY,
+    };
+
+    Kind      kind = NONE;     // NONE: blank line or comment
+    Error     error = CANCEL_NEEDS_ID;
+    Side      side = Side::BUY;
+    OrderType type = OrderType::LIMIT;
+    Quantity  quantity = 0;
+    Price     price = 0;
+    OrderId   order_id = 0;
+    std::string_view symbol;
+    std::string_view arg;      // ERROR: the offending field, if any
+};
+
 class CsvParser {
 public:
     explicit CsvParser(MatchingEngine& engine) : engine_(engine) {}
 
     // Process a single line, print trades/output to the given stream
-    void process_line(const std::string& line, std::ostream& os);
+    void process_line(std::string_view line, std::ostream& os);
+    void process_line(std::string_view line, OutputBuffer& out);
 
     // Process all lines from an input stream
     void process_stream(std::istream& is, std::ostream& os);
 
+    // Process a whole in-memory input, one command per line. With more
+    // than one thread, newline-aligned chunks are parsed in parallel and
+    // applied here in order; output is identical to the serial run.
+    void process_buffer(std::string_view data, OutputBuffer& out, size_t threads = 1);
+
+    // Map path and process it in place. False if it can't be opened.
+    bool process_file(const std::string& path, std::ostream& os, size_t threads = 1);
+
+    // Thread-safe: depends only on line
+    static CsvCommand parse_line(std::string_view line);
+
+    // Apply one parsed command and print its output
+    void execute(const CsvCommand& command, OutputBuffer& out);
+
 private:
+    // Lets find() take a string_view without building a key
+    struct SymbolHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    };
+
     MatchingEngine& engine_;
+    std::unordered_map<std::string, std::unique_ptr<MatchingEngine>, SymbolHash, std::equal_to<>>
+        symbol_engines_;
+
+    // Parallel ingest hands out input in chunks of about this size
+    static constexpr size_t PARALLEL_CHUNK_BYTES = 1 << 20;
+
+    MatchingEngine& engine_for(std::string_view symbol);
+
+    void process_parallel(std::string_view data, OutputBuffer& out, size_t threads);
 
-    void print_trades(const std::vector<Trade>& trades, std::ostream& os);
+    void print_trade(const Trade& trade, std::string_view symbol, OutputBuffer& out);
 };
 
 } // namespace ob
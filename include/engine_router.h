@@ -0,0 +1,133 @@
+#pragma once
+
+#include "types.h"
+#include "protocol.h"
+#include "journal.h"
+#include "market_data.h"
+#include "object_pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ob {
+
+struct RouterOptions {
+    size_t shards = 1;
+    // cores[i] pins shard i's thread, and puts its order pool on that
+    // core's NUMA node; missing or negative entries stay unpinned
+    std::vector<int> cores;
+    // Shard threads spin on their request rings instead of backing off
+    // into sleeps, so a request never waits on a wakeup. Each spinning
+    // shard needs a core of its own; pin them to isolated ones.
+    bool busy_poll = false;
+    // Write-ahead journal per shard (stream "shard-<i>-of-<shards>"); off
+    // when journal.dir is empty
+    JournalOptions journal;
+    // Fork a book snapshot once this many requests were journaled since
+    // the last one; 0: only on request_snapshot(). Needs a journal.
+    size_t snapshot_records = 0;
+    // Incremental L2 feed: each shard publishes its books' depth changes
+    // as UDP DepthUpdate packets (channel = shard index) to this address,
+    // usually a multicast group; off when empty
+    std::string market_data_address;
+    uint16_t market_data_port = 0;
+    MarketDataOptions market_data;
+    // Each shard's order pool; size capacity to the shard's peak resting
+    // orders so it never grows mid-session
+    PoolOptions pool;
+};
+
+// A response bound for the session (client) that sent the request
+struct RoutedResponse {
+    uint64_t        session;
+    ResponseMessage msg;
+};
+
+// Owns one MatchingEngine per symbol and partitions symbols across shard
+// threads (symbol % shards). A shard thread is the only one touching its
+// books and its ObjectPool, so every book stays single-threaded and
+// deterministic while symbols on different shards match in parallel.
+//
+// Each shard is fed through a lock-free SPSC request ring and answers
+// through an SPSC response ring, so the thread doing network I/O never
+// blocks on matching and a shard never blocks on a slow socket.
+// submit() and poll_responses() must both be called from that one thread.
+//
+// With a journal, each shard logs every request before applying it and
+// holds the batch's responses until a group commit makes the log durable,
+// so nothing is acknowledged that a restart could forget. start() first
+// replays the journal, which rebuilds every book, order id and timestamp
+// exactly, since each engine is a deterministic function of its requests.
+//
+// Replaying from the first request gets slower as the log grows, so a
+// shard can also snapshot its books: it forks right after a group commit
+// and the child writes the copy-on-write image of the books to
+// <dir>/<stream>.<seq>.snapshot while the parent keeps matching. Once the
+// child succeeds, journal segments the snapshot covers are deleted.
+// start() loads the newest valid snapshot and replays only what follows.
+class EngineRouter {
+public:
+    explicit EngineRouter(RouterOptions options = {});
+    ~EngineRouter();
+
+    EngineRouter(const EngineRouter&) = delete;
+    EngineRouter& operator=(const EngineRouter&) = delete;
+
+    // Load the newest snapshot and replay the journal after it (if any),
+    // then launch the shard threads. Throws std::runtime_error if the
+    // journal can't be opened, was written with a different shard count,
+    // or does not continue from the snapshot, or if the market data
+    // socket can't be set up.
+    void start();
+
+    // Finish everything already submitted, then join the shard threads
+    void stop();
+
+    // Route msg to the shard owning msg.symbol_id. Returns false if that
+    // shard's request ring is full; poll responses and retry.
+    // session_flags (SessionFlags) shape msg's responses; the router keeps
+    // no per-session state, so the caller passes them with every request.
+    bool submit(uint64_t session, const OrderMessage& msg, uint8_t session_flags = 0);
+
+    // Append every response produced so far to out; returns how many
+    size_t poll_responses(std::vector<RoutedResponse>& out);
+
+    // Messages submitted that their shard has not finished yet. Their
+    // responses are still to come; finished ones wait in poll_responses().
+    size_t in_flight() const;
+
+    // Ask every shard to snapshot after its next commit (needs a journal)
+    void request_snapshot();
+
+    // Snapshots completed so far, over all shards
+    uint64_t snapshots_written() const;
+
+    // Requests replayed from the journal by start(), after any snapshot
+    uint64_t recovered() const { return recovered_; }
+
+    // Whether every shard's pool got the huge pages options.pool asked
+    // for. Reads the pools, so only before start() or after stop().
+    bool huge_pages() const;
+
+    size_t shard_count() const { return shards_.size(); }
+    size_t shard_of(SymbolId symbol) const { return symbol % shards_.size(); }
+
+private:
+    struct Shard;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    uint64_t submitted_ = 0;
+    uint64_t recovered_ = 0;
+    bool running_ = false;
+    bool recovered_once_ = false;
+    JournalOptions journal_;
+    size_t snapshot_records_ = 0;
+    std::string market_data_address_;
+    uint16_t market_data_port_ = 0;
+    MarketDataOptions market_data_;
+
+    // Responses drained while stop() waits for the shards to finish
+    std::vector<RoutedResponse> backlog_;
+};
+
+} // namespace ob
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ob {
+
+// One socket event reported by an EventLoop backend.
+// Readiness backends (epoll, kqueue) report READABLE/WRITABLE and leave
+// the read to the caller. Completion backends (io_uring) have already
+// received the bytes and report DATA pointing at a backend-owned buffer,
+// which stays valid until release() is called for the event.
+struct IoEvent {
+    enum : uint32_t {
+        READABLE = 1u << 0,
+        WRITABLE = 1u << 1,
+        HANGUP   = 1u << 2,   // peer closed or socket error
+        DATA     = 1u << 3,
+    };
+
+    int         fd;
+    uint32_t    flags;
+    const char* data = nullptr;   // DATA only
+    size_t      len = 0;
+    uint32_t    buffer_id = 0;    // backend bookkeeping for release()
+};
+
+// Small event-loop backend interface for TcpServer. One instance is driven
+// by one thread.
+class EventLoop {
+public:
+    virtual ~EventLoop() = default;
+
+    virtual const char* name() const = 0;
+
+    // Listening socket: reported READABLE when connections are pending
+    virtual bool add_listener(int fd) = 0;
+
+    // Connected socket (already non-blocking)
+    virtual bool add_client(int fd) = 0;
+
+    // Stop watching fd and drop any queued output; the caller closes it
+    virtual void remove_client(int fd) = 0;
+
+    // Send bytes on fd. Readiness backends write directly and return what
+    // the kernel took (possibly short, -1 on error; wait for WRITABLE to
+    // retry). Completion backends copy the data and queue it for
+    // submission on the next wait(), up to a per-client limit; past it
+    // they take less, and report WRITABLE once earlier output is out.
+    virtual ssize_t send(int fd, const iovec* iov, int iovcnt) = 0;
+
+    // Ask for (or stop asking for) WRITABLE events on fd
+    virtual void want_writable(int fd, bool enable) = 0;
+
+    // Submit queued work and wait up to timeout_us for events (0 = poll).
+    // Returns the number of events stored, or -1 on error.
+    virtual int wait(IoEvent* events, int max_events, int64_t timeout_us) = 0;
+
+    // Hand a DATA event's buffer back to the backend
+    virtual void release(const IoEvent& event) { (void)event; }
+};
+
+// Backend by name: "epoll", "io_uring" (Linux), "kqueue" (macOS/BSD), or
+// empty for the platform default. Returns nullptr if unavailable here.
+std::unique_ptr<EventLoop> make_event_loop(const std::string& name = "");
+
+std::unique_ptr<EventLoop> make_epoll_loop();
+std::unique_ptr<EventLoop> make_io_uring_loop();
+std::unique_ptr<EventLoop> make_kqueue_loop();
+
+} // namespace ob
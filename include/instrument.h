@@ -0,0 +1,144 @@
+#pragma once
+
+#include "latency_histogram.h"
+#include "tsc_clock.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ob::instrument {
+
+// Hot-path instrumentation. The OB_* macros below compile to nothing
+// unless the build defines OB_INSTRUMENT (cmake -DOB_INSTRUMENT=ON); the
+// functions here are always available.
+//
+// Each thread writes its own Stats and nothing else. Every so often the
+// owner copies them into a published slot (maybe_publish), taking that
+// slot's lock with try_lock so it never waits; readers only ever touch the
+// published copies. So reading costs the matching thread nothing beyond
+// the periodic copy, and no cache line is written by both sides.
+
+enum class Timer : uint8_t {
+    DECODE,        // one request: decode and hand-off to its shard
+    MATCH,         // one NEW_ORDER through the engine
+    LEVEL_WALK,    // the matching loop over opposite levels
+    BOOK_INSERT,   // resting the remainder
+    ENCODE,        // coalescing one poll's responses into send buffers
+    SOCKET_WRITE,  // one send() of a client's buffer
+    COUNT
+};
+
+enum class Counter : uint8_t {
+    ORDERS,
+    CANCELS,
+    AMENDS,
+    TRADES,
+    POOL_GROWTH,   // ObjectPool blocks allocated for an engine
+    COUNT
+};
+
+// Value distributions
+enum class Dist : uint8_t {
+    LEVELS_SWEPT,  // per order that traded
+    QUEUE_DEPTH,   // orders in the level after an engine rests one
+    COUNT
+};
+
+struct Stats {
+    std::array<LatencyHistogram, static_cast<size_t>(Timer::COUNT)> timers;   // TSC ticks
+    std::array<LatencyHistogram, static_cast<size_t>(Dist::COUNT)> dists;
+    std::array<uint64_t, static_cast<size_t>(Counter::COUNT)> counters{};
+
+    LatencyHistogram& timer(Timer t) { return timers[static_cast<size_t>(t)]; }
+    LatencyHistogram& dist(Dist d) { return dists[static_cast<size_t>(d)]; }
+    uint64_t& counter(Counter c) { return counters[static_cast<size_t>(c)]; }
+
+    void merge(const Stats& other);
+};
+
+struct ThreadStats {
+    std::string name;
+    Stats stats;
+};
+
+// Calling thread's live stats; the first call registers the thread
+Stats& local();
+
+// Label the calling thread in reports ("io", "shard0", ...)
+void set_thread_name(std::string name);
+
+// Publish the calling thread's stats now, or if about PUBLISH_TICKS
+// counter ticks (tens of milliseconds) have passed since the last time
+void publish();
+void maybe_publish();
+constexpr uint64_t PUBLISH_TICKS = 100'000'000;
+
+// Latest published stats of every thread that has recorded any
+std::vector<ThreadStats> collect();
+
+// Text report: per thread, counters then percentiles (timers in ns)
+void report(std::ostream& os, const std::vector<ThreadStats>& threads, const TscClock& clock);
+
+// Times its scope into the calling thread's timer
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Timer t) : timer_(t), start_(TscClock::now()) {}
+    ~ScopedTimer() { local().timer(timer_).record(TscClock::now() - start_); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Timer timer_;
+    uint64_t start_;
+};
+
+// Instrumentation policies for code templated on it (BasicMatchingEngine):
+// Enabled records into the calling thread's stats whatever the build
+// flag, Disabled compiles to nothing, Default follows OB_INSTRUMENT. Lets
+// one binary compare an instrumented engine against a bare one.
+struct Enabled {
+    static constexpr bool enabled = true;
+    using Scope = ScopedTimer;
+    static void count(Counter c, uint64_t n) { local().counter(c) += n; }
+    static void record(Dist d, uint64_t value) { local().dist(d).record(value); }
+};
+
+struct Disabled {
+    static constexpr bool enabled = false;
+    struct Scope {
+        explicit Scope(Timer) {}
+    };
+    static void count(Counter, uint64_t) {}
+    static void record(Dist, uint64_t) {}
+};
+
+#ifdef OB_INSTRUMENT
+using Default = Enabled;
+#else
+using Default = Disabled;
+#endif
+
+} // namespace ob::instrument
+
+#define OB_INSTRUMENT_CONCAT_(a, b) a##b
+#define OB_INSTRUMENT_CONCAT(a, b) OB_INSTRUMENT_CONCAT_(a, b)
+
+#ifdef OB_INSTRUMENT
+#define OB_TIME(name) \
+    ::ob::instrument::ScopedTimer OB_INSTRUMENT_CONCAT(ob_timer_, __LINE__)( \
+        ::ob::instrument::Timer::name)
+#define OB_COUNT(name, n) \
+    (::ob::instrument::local().counter(::ob::instrument::Counter::name) += (n))
+#define OB_RECORD(name, value) \
+    (::ob::instrument::local().dist(::ob::instrument::Dist::name).record(value))
+#define OB_PUBLISH() ::ob::instrument::maybe_publish()
+#else
+#define OB_TIME(name) ((void)0)
+#define OB_COUNT(name, n) ((void)0)
+#define OB_RECORD(name, value) ((void)0)
+#define OB_PUBLISH() ((void)0)
+#endif
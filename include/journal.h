@@ -0,0 +1,100 @@
+#pragma once
+
+#include "protocol.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ob {
+
+struct JournalOptions {
+    std::string dir;                      // empty: journaling off
+    size_t segment_bytes = 64u << 20;     // rolled over when full
+    // Group commit: sync once this many records are pending, or once the
+    // oldest pending record is this old, whichever comes first. 0 records
+    // means sync after every batch.
+    size_t sync_records = 4096;
+    std::chrono::microseconds sync_interval{1000};
+};
+
+// 48 bytes on disk. crc covers seq and msg, so a torn write fails the check.
+struct JournalRecord {
+    uint64_t     seq;       // 1-based, contiguous across segments
+    uint32_t     crc;
+    uint32_t     reserved;
+    OrderMessage msg;
+};
+static_assert(sizeof(JournalRecord) == 48, "JournalRecord must be 48 bytes");
+
+uint32_t journal_crc(const JournalRecord& record);
+
+// Append-only write-ahead log of the requests one writer (a router shard)
+// applied, in order. Segments are preallocated files mapped MAP_SHARED:
+// append() is a memcpy, and durability comes from msync over the dirty
+// range when the group-commit policy says so, so a batch of requests
+// shares one sync instead of paying a syscall each.
+//
+// Files: <dir>/<stream>.<segment number, 6 digits>.journal
+class JournalWriter {
+public:
+    JournalWriter(JournalOptions options, std::string stream);
+    ~JournalWriter();
+
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter& operator=(const JournalWriter&) = delete;
+
+    // Continue after the last intact record of an existing journal (a
+    // torn tail is overwritten) or start a new one whose first record is
+    // first_seq. False on I/O error.
+    bool open(uint64_t first_seq = 1);
+
+    void append(const OrderMessage& msg);
+
+    // True once the pending records meet the group-commit policy
+    bool sync_due() const;
+
+    // Make every appended record durable. Aborts if the msync fails: the
+    // shard acknowledges the records as durable once this returns.
+    void sync();
+
+    // Delete the segments every record of which is <= seq (the current
+    // segment always stays). Call once a snapshot covers seq.
+    void drop_segments_through(uint64_t seq);
+
+    size_t pending() const { return pending_; }
+    uint64_t next_seq() const { return next_seq_; }
+
+private:
+    JournalOptions options_;
+    std::string stream_;
+
+    int fd_ = -1;
+    char* map_ = nullptr;
+    size_t map_bytes_ = 0;
+    size_t write_off_ = 0;     // next record offset in the mapped segment
+    size_t synced_off_ = 0;    // everything before this is durable
+    uint32_t segment_ = 0;
+
+    struct Segment {
+        uint32_t number;
+        uint64_t first_seq;
+    };
+    std::vector<Segment> segments_;   // oldest first; back() is current
+
+    uint64_t next_seq_ = 1;
+    size_t pending_ = 0;
+    std::chrono::steady_clock::time_point first_pending_;
+
+    bool open_segment(uint32_t number, bool create);
+    void close_segment();
+};
+
+// Replay every intact record of a stream, oldest first. Stops at the
+// first torn or out-of-sequence record. Returns the number replayed.
+size_t replay_journal(const std::string& dir, const std::string& stream,
+                      const std::function<void(const JournalRecord&)>& fn);
+
+} // namespace ob
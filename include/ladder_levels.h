@@ -0,0 +1,251 @@
+#pragma once
+
+#include "types.h"
+#include "order.h"
+#include "price_level.h"
+#include "node_pool.h"
+#include "occupancy_bitmap.h"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+namespace ob {
+
+// One side of the book backed by a contiguous price ladder.
+// Slot i holds the level at base + i * tick, so add/find/remove are array
+// indexing instead of tree walks, and creating or emptying a level never
+// touches the allocator. Prices outside the window (or off the tick grid)
+// fall back to a sparse map. When the touch moves past the window, or the
+// ladder is empty, the window is recentered on the new price and every
+// level is redistributed between ladder and fallback. An occupancy bitmap
+// over the slots finds the next level behind an emptied touch, and the
+// next one to visit in a walk, in a few instructions however sparse the
+// ladder is.
+template <Side S>
+class LadderLevels {
+public:
+    using Compare = std::conditional_t<S == Side::BUY, std::greater<>, std::less<>>;
+
+    static constexpr size_t DEFAULT_SLOTS = 4096;
+
+    explicit LadderLevels(size_t slots = DEFAULT_SLOTS, Price tick = 1)
+        : slots_(slots), occupancy_(slots), tick_(tick) {}
+
+    // Append to the level at the order's price, creating it if needed
+    void add(Order* order) {
+        Price price = order->info().price;
+        size_t idx = slot_of(price);
+        if (idx == NPOS) [[unlikely]] {
+            if (!should_recenter(price)) {
+                sparse_[price].add(order);
+                return;
+            }
+            recenter(price);
+            idx = slot_of(price);
+        }
+
+        PriceLevel& level = slots_[idx];
+        if (level.is_empty()) {
+            mark_occupied(idx);
+        }
+        level.add(order);
+    }
+
+    // Remove a resting order from its level, dropping the level if it empties
+    void remove(Order* order) {
+        Price price = order->info().price;
+        size_t idx = slot_of(price);
+        if (idx == NPOS) [[unlikely]] {
+            auto it = sparse_.find(price);
+            if (it == sparse_.end()) return;
+            it->second.remove(order);
+            if (it->second.is_empty()) {
+                sparse_.erase(it);
+            }
+            return;
+        }
+
+        PriceLevel& level = slots_[idx];
+        level.remove(order);
+        if (level.is_empty()) {
+            mark_empty(idx);
+        }
+    }
+
+    PriceLevel* find(Price price) {
+        return const_cast<PriceLevel*>(std::as_const(*this).find(price));
+    }
+
+    const PriceLevel* find(Price price) const {
+        size_t idx = slot_of(price);
+        if (idx == NPOS) {
+            auto it = sparse_.find(price);
+            return it != sparse_.end() ? &it->second : nullptr;
+        }
+        return slots_[idx].is_empty() ? nullptr : &slots_[idx];
+    }
+
+    // Pull the slot for price into cache ahead of an add or match
+    void prefetch(Price price) const {
+        size_t idx = slot_of(price);
+        if (idx != NPOS) __builtin_prefetch(&slots_[idx]);
+    }
+
+    bool empty() const { return occupied_ == 0 && sparse_.empty(); }
+    size_t size() const { return occupied_ + sparse_.size(); }
+
+    // Best level access. Precondition: !empty()
+    Price best_price() const {
+        return best_in_sparse() ? sparse_.begin()->first : price_at(best_);
+    }
+
+    PriceLevel& best_level() {
+        return best_in_sparse() ? sparse_.begin()->second : slots_[best_];
+    }
+
+    // Erase the best level once the matching engine has emptied it
+    void pop_best() {
+        if (best_in_sparse()) {
+            sparse_.erase(sparse_.begin());
+        } else {
+            mark_empty(best_);
+        }
+    }
+
+    // Visit levels in priority order (best first): f(Price, const PriceLevel&)
+    template <typename F>
+    void for_each(F&& f) const {
+        for_each_best(static_cast<size_t>(-1), f);
+    }
+
+    // Same, stopping after the best n levels
+    template <typename F>
+    void for_each_best(size_t n, F&& f) const {
+        auto sit = sparse_.begin();
+        size_t visited = 0;
+        size_t emitted = 0;
+        for (size_t idx = best_; visited < occupied_ && emitted < n; idx = next_worse(idx)) {
+            const PriceLevel& level = slots_[idx];
+            Price price = price_at(idx);
+            for (; sit != sparse_.end() && emitted < n && is_better_price<S>(sit->first, price);
+                 ++sit, ++emitted) {
+                f(sit->first, sit->second);
+            }
+            if (emitted == n) return;
+            f(price, level);
+            ++visited;
+            ++emitted;
+        }
+        for (; sit != sparse_.end() && emitted < n; ++sit, ++emitted) {
+            f(sit->first, sit->second);
+        }
+    }
+
+    // Window introspection (tests, diagnostics)
+    Price window_base() const { return base_; }
+    size_t window_slots() const { return slots_.size(); }
+    size_t sparse_size() const { return sparse_.size(); }
+
+private:
+    static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+    std::vector<PriceLevel> slots_;
+    OccupancyBitmap occupancy_;   // bit per non-empty slot
+    Price base_ = 0;          // price of slot 0
+    Price tick_;
+    size_t occupied_ = 0;     // non-empty ladder slots
+    size_t best_ = 0;         // best non-empty slot, valid while occupied_ > 0
+
+    // Levels that don't fit the window, with nodes from their own pool
+    using SparseMap = PooledMap<Price, PriceLevel, Compare>;
+    NodePool sparse_nodes_;
+    SparseMap sparse_{Compare{}, typename SparseMap::allocator_type(sparse_nodes_)};
+
+    Price price_at(size_t idx) const {
+        return base_ + static_cast<Price>(idx) * tick_;
+    }
+
+    size_t slot_of(Price price) const {
+        if (price < base_) return NPOS;
+        Price offset = price - base_;
+        if (tick_ != 1) {
+            if (offset % tick_ != 0) return NPOS;
+            offset /= tick_;
+        }
+        return static_cast<size_t>(offset) < slots_.size()
+            ? static_cast<size_t>(offset) : NPOS;
+    }
+
+    // Higher slots are better for bids, lower slots for asks
+    static bool is_better_slot(size_t a, size_t b) {
+        if constexpr (S == Side::BUY) return a > b;
+        else return a < b;
+    }
+
+    // Next occupied slot away from the touch, NPOS if none
+    size_t next_worse(size_t idx) const {
+        if constexpr (S == Side::BUY) return occupancy_.prev(idx);
+        else return occupancy_.next(idx);
+    }
+
+    bool best_in_sparse() const {
+        if (occupied_ == 0) return true;
+        return !sparse_.empty() && is_better_price<S>(sparse_.begin()->first, price_at(best_));
+    }
+
+    // Recenter when the ladder holds nothing, or when an on-grid price
+    // improves on the ladder's best (the touch has left the window).
+    bool should_recenter(Price price) const {
+        if (occupied_ == 0) return true;
+        bool on_grid = (price - base_) % tick_ == 0;
+        return on_grid && is_better_price<S>(price, price_at(best_));
+    }
+
+    void mark_occupied(size_t idx) {
+        if (occupied_ == 0 || is_better_slot(idx, best_)) {
+            best_ = idx;
+        }
+        occupancy_.set(idx);
+        ++occupied_;
+    }
+
+    void mark_empty(size_t idx) {
+        occupancy_.reset(idx);
+        --occupied_;
+        if (idx == best_ && occupied_ > 0) {
+            // Every other occupied slot is worse
+            best_ = next_worse(idx);
+        }
+    }
+
+    void recenter(Price center) {
+        std::vector<std::pair<Price, PriceLevel>> moved;
+        moved.reserve(occupied_ + sparse_.size());
+
+        for (size_t idx = occupancy_.first(); idx != OccupancyBitmap::NPOS;
+             idx = occupancy_.next(idx)) {
+            moved.emplace_back(price_at(idx), std::exchange(slots_[idx], PriceLevel{}));
+        }
+        for (auto& [price, level] : sparse_) {
+            moved.emplace_back(price, std::move(level));
+        }
+        sparse_.clear();
+        occupancy_.clear();
+        occupied_ = 0;
+
+        base_ = center - static_cast<Price>(slots_.size() / 2) * tick_;
+
+        for (auto& [price, level] : moved) {
+            size_t idx = slot_of(price);
+            if (idx == NPOS) {
+                sparse_.emplace(price, std::move(level));
+            } else {
+                slots_[idx] = std::move(level);
+                mark_occupied(idx);
+            }
+        }
+    }
+};
+
+} // namespace ob
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace ob {
+
+// Log-linear latency histogram in the style of HdrHistogram: values below
+// 2^(SUB_BITS+1) get a bucket each, and every power of two above that is
+// split into 2^SUB_BITS equal buckets. Any value is reported to within
+// 1/2^SUB_BITS (about 3%) of itself, the whole uint64_t range fits in a
+// fixed 15 KB array, and record() is a shift and an increment -- no
+// per-sample storage and no sort at the end.
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BITS = 5;
+
+    void record(uint64_t value) { record_n(value, 1); }
+
+    void record_n(uint64_t value, uint64_t n) {
+        counts_[bucket_of(value)] += n;
+        count_ += n;
+        sum_ += value * n;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < BUCKETS; ++i) counts_[i] += other.counts_[i];
+        count_ += other.count_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    void reset() { *this = LatencyHistogram{}; }
+
+    uint64_t count() const { return count_; }
+    uint64_t min() const { return count_ ? min_ : 0; }
+    uint64_t max() const { return max_; }
+    double mean() const { return count_ ? static_cast<double>(sum_) / count_ : 0.0; }
+
+    // Smallest value v such that pct percent of samples are <= v, reported
+    // as the top of v's bucket (never above the largest sample)
+    uint64_t percentile(double pct) const {
+        if (count_ == 0) return 0;
+        auto rank = static_cast<uint64_t>(pct / 100.0 * static_cast<double>(count_) + 0.5);
+        rank = std::clamp<uint64_t>(rank, 1, count_);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            seen += counts_[i];
+            if (seen >= rank) return std::min(bucket_top(i), max_);
+        }
+        return max_;
+    }
+
+private:
+    static constexpr size_t BUCKETS = size_t{65 - SUB_BITS} << SUB_BITS;
+
+    // Buckets step by 2^shift, where shift grows by one per power of two
+    static size_t bucket_of(uint64_t value) {
+        unsigned msb = 63 - static_cast<unsigned>(std::countl_zero(value | 1));
+        unsigned shift = msb > SUB_BITS ? msb - SUB_BITS : 0;
+        return (size_t{shift} << SUB_BITS) + (value >> shift);
+    }
+
+    static uint64_t bucket_top(size_t bucket) {
+        size_t group = bucket >> SUB_BITS;
+        unsigned shift = group > 1 ? static_cast<unsigned>(group - 1) : 0;
+        uint64_t low = static_cast<uint64_t>(bucket - (size_t{shift} << SUB_BITS)) << shift;
+        return low + ((uint64_t{1} << shift) - 1);
+    }
+
+    std::array<uint64_t, BUCKETS> counts_{};
+    uint64_t count_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+};
+
+} // namespace ob
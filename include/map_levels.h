@@ -0,0 +1,86 @@
+#pragma once
+
+#include "types.h"
+#include "order.h"
+#include "price_level.h"
+#include "node_pool.h"
+#include <functional>
+#include <type_traits>
+
+namespace ob {
+
+// One side of the book backed by a std::map keyed on price.
+// Handles any price distribution, at the cost of a tree walk per lookup.
+// Map nodes come from this side's own NodePool, so a new level reuses the
+// slot of one that emptied instead of calling malloc. Best level is
+// always map::begin().
+template <Side S>
+class MapLevels {
+public:
+    using Compare = std::conditional_t<S == Side::BUY, std::greater<>, std::less<>>;
+
+    // Append to the level at the order's price, creating it if needed
+    void add(Order* order) {
+        levels_[order->info().price].add(order);
+    }
+
+    // Remove a resting order from its level, dropping the level if it empties
+    void remove(Order* order) {
+        auto it = levels_.find(order->info().price);
+        if (it == levels_.end()) return;
+        it->second.remove(order);
+        if (it->second.is_empty()) {
+            levels_.erase(it);
+        }
+    }
+
+    PriceLevel* find(Price price) {
+        auto it = levels_.find(price);
+        return it != levels_.end() ? &it->second : nullptr;
+    }
+
+    const PriceLevel* find(Price price) const {
+        auto it = levels_.find(price);
+        return it != levels_.end() ? &it->second : nullptr;
+    }
+
+    // Nothing cheap to prefetch: finding the node is the tree walk itself
+    void prefetch(Price) const {}
+
+    bool empty() const { return levels_.empty(); }
+    size_t size() const { return levels_.size(); }
+
+    // Best level access. Precondition: !empty()
+    Price best_price() const { return levels_.begin()->first; }
+    PriceLevel& best_level() { return levels_.begin()->second; }
+
+    // Erase the best level once the matching engine has emptied it
+    void pop_best() { levels_.erase(levels_.begin()); }
+
+    // Level nodes carved and in use (tests, diagnostics)
+    const NodePool& node_pool() const { return nodes_; }
+
+    // Visit levels in priority order (best first): f(Price, const PriceLevel&)
+    template <typename F>
+    void for_each(F&& f) const {
+        for (const auto& [price, level] : levels_) {
+            f(price, level);
+        }
+    }
+
+    // Same, stopping after the best n levels
+    template <typename F>
+    void for_each_best(size_t n, F&& f) const {
+        for (auto it = levels_.begin(); it != levels_.end() && n > 0; ++it, --n) {
+            f(it->first, it->second);
+        }
+    }
+
+private:
+    using Map = PooledMap<Price, PriceLevel, Compare>;
+
+    NodePool nodes_;   // before levels_, which frees into it on destruction
+    Map levels_{Compare{}, typename Map::allocator_type(nodes_)};
+};
+
+} // namespace ob
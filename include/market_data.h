@@ -0,0 +1,127 @@
+#pragma once
+
+#include "types.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ob {
+
+// Told the new aggregate quantity of a price level whenever an engine
+// changes it (0: the level is gone)
+class DepthListener {
+public:
+    virtual ~DepthListener() = default;
+    virtual void on_depth(SymbolId symbol, Side side, Price price, Quantity quantity) = 0;
+};
+
+// One incremental L2 update on the wire: 24 bytes
+struct DepthUpdate {
+    uint64_t seq;         // per publisher, contiguous from 1
+    int64_t  price;
+    uint32_t quantity;    // new aggregate at price; 0 deletes the level
+    uint16_t symbol_id;
+    uint8_t  side;        // Side enum
+    uint8_t  reserved;
+};
+static_assert(sizeof(DepthUpdate) == 24, "DepthUpdate must be 24 bytes");
+
+// Datagram header, followed by count DepthUpdates with seqs
+// first_seq, first_seq + 1, ... A gap in first_seq means lost packets.
+struct DepthPacketHeader {
+    uint64_t first_seq;
+    uint16_t count;
+    uint16_t channel;     // publisher id, e.g. the router shard
+    uint32_t reserved;
+};
+static_assert(sizeof(DepthPacketHeader) == 16, "DepthPacketHeader must be 16 bytes");
+
+// Where encoded packets go
+class DepthTransport {
+public:
+    virtual ~DepthTransport() = default;
+    virtual void send(const void* data, size_t len) = 0;
+};
+
+// UDP to a multicast group (or any IPv4 address). Throws
+// std::runtime_error if the socket can't be set up.
+class UdpDepthTransport : public DepthTransport {
+public:
+    UdpDepthTransport(const std::string& address, uint16_t port, int ttl = 1,
+                      const std::string& interface = "");
+    ~UdpDepthTransport() override;
+
+    UdpDepthTransport(const UdpDepthTransport&) = delete;
+    UdpDepthTransport& operator=(const UdpDepthTransport&) = delete;
+
+    void send(const void* data, size_t len) override;
+
+private:
+    int fd_ = -1;
+    std::vector<char> addr_;   // sockaddr_in, kept opaque here
+};
+
+struct MarketDataOptions {
+    // Conflate: between flushes keep only the latest quantity per level,
+    // so a sweep through many levels sends one update per level rather
+    // than one per fill. Off: every change is sent, in order.
+    bool conflate = true;
+    // flush_due() once the oldest unsent change is this old
+    std::chrono::microseconds interval{0};
+    uint16_t channel = 0;
+    // Distinct levels one flush interval is expected to touch; the
+    // conflation index is sized for them once and only grows past that
+    size_t levels = 4096;
+};
+
+// Collects depth changes from the engines of one thread and sends them
+// as DepthUpdate packets on flush(). Single-threaded.
+class MarketDataPublisher : public DepthListener {
+public:
+    MarketDataPublisher(std::unique_ptr<DepthTransport> transport, MarketDataOptions options = {});
+
+    void on_depth(SymbolId symbol, Side side, Price price, Quantity quantity) override;
+
+    bool has_pending() const { return !pending_.empty(); }
+    bool flush_due() const;
+
+    // Number every pending update and send them, MAX_PACKET_BYTES at most
+    // per packet
+    void flush();
+
+    uint64_t next_seq() const { return next_seq_; }
+
+    static constexpr size_t MAX_PACKET_BYTES = 1400;   // fits a standard MTU
+    static constexpr size_t UPDATES_PER_PACKET =
+        (MAX_PACKET_BYTES - sizeof(DepthPacketHeader)) / sizeof(DepthUpdate);
+
+private:
+    std::unique_ptr<DepthTransport> transport_;
+    MarketDataOptions options_;
+    std::vector<DepthUpdate> pending_;   // in first-change order
+
+    // Conflation index: (symbol, side, price) -> slot in pending_, open
+    // addressing with linear probing. flush() empties it by bumping
+    // epoch_, so the matching thread doesn't allocate or free here.
+    struct Slot {
+        uint64_t key;
+        uint32_t index;   // into pending_
+        uint32_t epoch;   // the slot is in use while this is epoch_
+    };
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+    unsigned shift_ = 0;
+    uint32_t epoch_ = 1;
+
+    // pending_ index for key, taking index if key is new
+    uint32_t find_or_add(uint64_t key, uint32_t index);
+    void rehash(size_t capacity);
+    std::vector<char> packet_;
+    uint64_t next_seq_ = 1;
+    std::chrono::steady_clock::time_point first_pending_;
+};
+
+} // namespace ob
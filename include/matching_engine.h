@@ -5,49 +5,500 @@
 #include "trade.h"
 #include "order_book.h"
 #include "object_pool.h"
+#include "protocol.h"
+#include "market_data.h"
+#include "instrument.h"
+#include <algorithm>
+#include <concepts>
+#include <memory>
+#include <span>
 #include <vector>
 #include <cstdint>
 
 namespace ob {
 
-class MatchingEngine {
+// Receives each Trade inline, as the match loop produces it.
+template <typename Sink>
+concept TradeSink = std::invocable<Sink&, const Trade&>;
+
+// Receives the outcome of each message in a process_batch() call, in order.
+//   on_accept(msg, id)  NEW_ORDER assigned id; sent before any of its trades
+//   on_trade(msg, t)    a trade produced by that NEW_ORDER
+//   on_cancel(msg, ok)  CANCEL result
+//   on_amend(msg, ok)   AMEND result; sent before any trades it causes
+//   on_trade(msg, t)    also a trade produced by a re-priced AMEND
+//   on_reject(msg)      unknown message type, or a NEW_ORDER with the
+//                       order pool full and not allowed to grow
+template <typename Sink>
+concept BatchSink = requires(Sink& s, const OrderMessage& m, const Trade& t) {
+    s.on_accept(m, OrderId{});
+    s.on_trade(m, t);
+    s.on_cancel(m, true);
+    s.on_amend(m, true);
+    s.on_reject(m);
+};
+
+// The engine is assembled from compile-time policies:
+//   Book        book backend: a BasicOrderBook over MapLevels or
+//               LadderLevels, with OrderIndex or FlatOrderMap for lookup;
+//               the engine only needs its per-side level containers and lookup
+//   Pool        where Orders live: ObjectPool<Order>, or HeapPool<Order>
+//               as a baseline (allocate, deallocate, reserve, full)
+//   Instrument  instrument::Enabled or Disabled; Default follows the build
+// Trade sinks are a template parameter of each call rather than the
+// class. Matching is one routine specialised per side and order type, so
+// the match loop carries no branch on either.
+template <typename Book, typename Pool = ObjectPool<Order>,
+          typename Instrument = instrument::Default>
+class BasicMatchingEngine {
 public:
+    using BookType = Book;
+    using PoolType = Pool;
+
+    // Engine with its own order pool
+    BasicMatchingEngine()
+        : owned_pool_(std::make_unique<Pool>()), pool_(*owned_pool_) {}
+
+    // Engine drawing orders from a pool shared with other engines on the
+    // same thread (e.g. every book in a router shard)
+    explicit BasicMatchingEngine(Pool& pool) : pool_(pool) {}
+
+    BasicMatchingEngine(const BasicMatchingEngine&) = delete;
+    BasicMatchingEngine& operator=(const BasicMatchingEngine&) = delete;
+
     // Process an incoming order: match against resting orders, return trades.
     // Unmatched remainder of limit orders is added to the book.
     // The engine takes ownership of Order allocation via the object pool.
     std::vector<Trade> process_order(Side side, OrderType type, Price price, Quantity quantity);
 
+    // Same, but hands each trade to sink as it executes instead of
+    // collecting them. No allocation on the match path.
+    // Returns the id assigned to the incoming order.
+    template <TradeSink Sink>
+    OrderId process_order(Side side, OrderType type, Price price, Quantity quantity, Sink&& sink);
+
     // Cancel an order by ID
     bool cancel_order(OrderId order_id);
 
+    // Change a resting order to total size quantity (including what has
+    // already filled) at price, without a cancel and new order:
+    //   - same price, no bigger: shrunk in place, keeping time priority
+    //   - new price or bigger: moves to the back of the queue at price,
+    //     matching first if it now crosses; trades go to sink
+    //   - quantity at or below the filled amount: the order is cancelled
+    // The order keeps its id. Returns false if no such order is resting.
+    template <TradeSink Sink>
+    bool amend_order(OrderId order_id, Price price, Quantity quantity, Sink&& sink);
+    bool amend_order(OrderId order_id, Price price, Quantity quantity) {
+        return amend_order(order_id, price, quantity, [](const Trade&) {});
+    }
+
+    // Apply a batch of wire messages in sequence. Same price-time semantics
+    // as calling process_order/cancel_order per message, but the pool is
+    // grown once up front and the resting orders and levels that upcoming
+    // messages will touch are prefetched while earlier ones match.
+    template <BatchSink Sink>
+    void process_batch(std::span<const OrderMessage> batch, Sink& sink);
+
     // Access to the book (for printing, queries)
-    const OrderBook& book() const { return book_; }
-    OrderBook& book() { return book_; }
+    const Book& book() const { return book_; }
+    Book& book() { return book_; }
+
+    // Snapshot load: counters first, then each level's orders in FIFO
+    // order. Orders are copied into pool slots reserved up front.
+    void restore_counters(OrderId next_order_id, Timestamp next_timestamp,
+                          uint64_t trade_count, uint64_t orders_processed) {
+        next_order_id_ = next_order_id;
+        next_timestamp_ = next_timestamp;
+        trade_count_ = trade_count;
+        orders_processed_ = orders_processed;
+    }
+    void restore_level(Side side, std::span<const OrderRecord> orders);
+
+    // Report every level change (new aggregate quantity) to listener,
+    // tagged with symbol; nullptr turns it off. Sweeps report each level
+    // they touch once, not once per fill.
+    void set_depth_listener(DepthListener* listener, SymbolId symbol) {
+        depth_ = listener;
+        depth_symbol_ = symbol;
+    }
 
     // Stats
     uint64_t next_order_id() const { return next_order_id_; }
+    Timestamp next_timestamp() const { return next_timestamp_; }
     uint64_t trade_count() const { return trade_count_; }
     uint64_t orders_processed() const { return orders_processed_; }
 
     // Access to pool (for benchmarking comparisons)
-    const ObjectPool<Order>& pool() const { return pool_; }
+    const Pool& pool() const { return pool_; }
 
 private:
-    OrderBook book_;
-    ObjectPool<Order> pool_;
+    // How many messages ahead process_batch prefetches
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+
+    Book book_;
+    std::unique_ptr<Pool> owned_pool_;
+    Pool& pool_;
     OrderId next_order_id_ = 1;
     Timestamp next_timestamp_ = 1;
     uint64_t trade_count_ = 0;
     uint64_t orders_processed_ = 0;
+    DepthListener* depth_ = nullptr;
+    SymbolId depth_symbol_ = 0;
 
-    // Match an incoming buy order against the ask side
-    void match_buy(Order* order, std::vector<Trade>& trades);
+    // Pool access, counting new blocks through the Instrument policy (the
+    // pool itself isn't templated on it)
+    size_t pool_blocks() const {
+        if constexpr (Instrument::enabled && requires(const Pool& p) { p.block_count(); }) {
+            return pool_.block_count();
+        } else {
+            return 0;
+        }
+    }
+    Order* allocate_order() {
+        const size_t blocks = pool_blocks();
+        Order* order = pool_.allocate();
+        Instrument::count(instrument::Counter::POOL_GROWTH, pool_blocks() - blocks);
+        return order;
+    }
+    void reserve_orders(size_t n) {
+        const size_t blocks = pool_blocks();
+        pool_.reserve(n);
+        Instrument::count(instrument::Counter::POOL_GROWTH, pool_blocks() - blocks);
+    }
 
-    // Match an incoming sell order against the bid side
-    void match_sell(Order* order, std::vector<Trade>& trades);
+    void report_level(Side side, Price price) {
+        depth_->on_depth(depth_symbol_, side, price, book_.get_volume_at_price(side, price));
+    }
 
-    // Execute a trade between two orders
-    Trade execute_trade(Order* buyer, Order* seller, Quantity qty, Price price);
+    // Prefetch what msg will touch: the resting order for a cancel or amend, the
+    // destination level for a new order
+    void prefetch_for(const OrderMessage& msg) const;
+
+    template <typename Sink>
+    void amend(Order* order, Price price, Quantity quantity, Sink&& sink);
+
+    // Pick the match specialisation for order's side and type
+    template <typename Sink>
+    void match(Order* order, Sink& sink);
+
+    // Match an incoming order on side S against the opposite side,
+    // best level first, until it fills or (for limits) stops crossing
+    template <Side S, OrderType T, typename Sink>
+    void match(Order* order, Sink& sink);
+
+    // Execute a trade between two orders and emit it to the sink
+    template <typename Sink>
+    void execute_trade(Order* buyer, Order* seller, Quantity qty, Price price, Sink& sink);
 };
 
+template <typename Book, typename Pool, typename Instrument>
+std::vector<Trade> BasicMatchingEngine<Book, Pool, Instrument>::process_order(
+    Side side, OrderType type, Price price, Quantity quantity)
+{
+    std::vector<Trade> trades;
+    process_order(side, type, price, quantity,
+                  [&trades](const Trade& t) { trades.push_back(t); });
+    return trades;
+}
+
+template <typename Book, typename Pool, typename Instrument>
+template <TradeSink Sink>
+OrderId BasicMatchingEngine<Book, Pool, Instrument>::process_order(
+    Side side, OrderType type, Price price, Quantity quantity, Sink&& sink)
+{
+    typename Instrument::Scope timer(instrument::Timer::MATCH);
+    Instrument::count(instrument::Counter::ORDERS, 1);
+    ++orders_processed_;
+
+    Order* order = allocate_order();
+    order->id = next_order_id_++;
+    order->quantity = quantity;
+    order->filled_qty = 0;
+    OrderInfo& info = order->info();
+    info.timestamp = next_timestamp_++;
+    info.price = price;
+    info.side = side;
+    info.type = type;
+
+    match(order, sink);
+
+    OrderId id = order->id;
+
+    // If the order has remaining quantity, add to book (limit orders only)
+    if (!order->is_filled()) {
+        if (type == OrderType::LIMIT) {
+            {
+                typename Instrument::Scope insert_timer(instrument::Timer::BOOK_INSERT);
+                book_.add_order(order);
+            }
+            if constexpr (Instrument::enabled) {
+                const auto* level = side == Side::BUY ? book_.bids().find(price)
+                                                      : book_.asks().find(price);
+                Instrument::record(instrument::Dist::QUEUE_DEPTH, level->order_count());
+            }
+            if (depth_) report_level(side, price);
+        } else {
+            // Market order with unfilled remainder — reject/discard
+            pool_.deallocate(order);
+        }
+    } else {
+        // Fully filled — return to pool
+        pool_.deallocate(order);
+    }
+
+    return id;
+}
+
+template <typename Book, typename Pool, typename Instrument>
+bool BasicMatchingEngine<Book, Pool, Instrument>::cancel_order(OrderId order_id) {
+    Instrument::count(instrument::Counter::CANCELS, 1);
+    Order* order = book_.cancel_order(order_id);
+    if (order) {
+        if (depth_) report_level(order->info().side, order->info().price);
+        pool_.deallocate(order);
+        return true;
+    }
+    return false;
+}
+
+template <typename Book, typename Pool, typename Instrument>
+template <TradeSink Sink>
+bool BasicMatchingEngine<Book, Pool, Instrument>::amend_order(OrderId order_id, Price price, Quantity quantity,
+                                            Sink&& sink) {
+    Order* order = book_.find_order(order_id);
+    if (!order) return false;
+    amend(order, price, quantity, sink);
+    return true;
+}
+
+template <typename Book, typename Pool, typename Instrument>
+template <typename Sink>
+void BasicMatchingEngine<Book, Pool, Instrument>::amend(Order* order, Price price, Quantity quantity, Sink&& sink) {
+    Instrument::count(instrument::Counter::AMENDS, 1);
+    OrderInfo& info = order->info();
+    Side side = info.side;
+    Price old_price = info.price;
+
+    if (quantity <= order->filled_qty) {
+        book_.cancel_order(order->id);
+        if (depth_) report_level(side, old_price);
+        pool_.deallocate(order);
+        return;
+    }
+
+    if (price == old_price && quantity <= order->quantity) {
+        if (quantity < order->quantity) {
+            book_.reduce_order(order, order->quantity - quantity);
+            if (depth_) report_level(side, price);
+        }
+        return;
+    }
+
+    // Loses time priority: out of its level, re-timed, and treated as an
+    // arrival at the new price; the id index entry stays
+    book_.unlink_order(order);
+    if (depth_) report_level(side, old_price);
+    info.price = price;
+    info.timestamp = next_timestamp_++;
+    order->quantity = quantity;
+
+    // Resting orders are limits
+    if (side == Side::BUY) {
+        match<Side::BUY, OrderType::LIMIT>(order, sink);
+    } else {
+        match<Side::SELL, OrderType::LIMIT>(order, sink);
+    }
+
+    if (order->is_filled()) {
+        book_.remove_from_lookup(order->id);
+        pool_.deallocate(order);
+    } else {
+        book_.relink_order(order);
+        if (depth_) report_level(side, price);
+    }
+}
+
+template <typename Book, typename Pool, typename Instrument>
+void BasicMatchingEngine<Book, Pool, Instrument>::restore_level(Side side,
+                                                                std::span<const OrderRecord> orders) {
+    reserve_orders(orders.size());
+    std::vector<Order*> slots(orders.size());
+    for (size_t i = 0; i < orders.size(); ++i) {
+        const OrderRecord& r = orders[i];
+        Order* order = allocate_order();
+        order->id = r.id;
+        order->quantity = r.quantity;
+        order->filled_qty = r.filled_qty;
+        order->prev = order->next = nullptr;
+        OrderInfo& info = order->info();
+        info.timestamp = r.timestamp;
+        info.price = r.price;
+        info.side = side;
+        info.type = r.type;
+        slots[i] = order;
+    }
+    book_.restore_level(side, slots.data(), slots.size());
+}
+
+template <typename Book, typename Pool, typename Instrument>
+template <BatchSink Sink>
+void BasicMatchingEngine<Book, Pool, Instrument>::process_batch(std::span<const OrderMessage> batch, Sink& sink) {
+    size_t new_orders = 0;
+    for (const auto& msg : batch) {
+        new_orders += (msg.msg_type == static_cast<uint8_t>(MsgType::NEW_ORDER));
+    }
+    // Every new order may rest, so no allocation can hit a fresh block mid-batch
+    reserve_orders(new_orders);
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (i + PREFETCH_DISTANCE < batch.size()) {
+            prefetch_for(batch[i + PREFETCH_DISTANCE]);
+        }
+
+        const OrderMessage& msg = batch[i];
+        switch (static_cast<MsgType>(msg.msg_type)) {
+        case MsgType::NEW_ORDER:
+            if (pool_.full()) [[unlikely]] {
+                sink.on_reject(msg);
+                break;
+            }
+            sink.on_accept(msg, next_order_id_);
+            process_order(static_cast<Side>(msg.side), static_cast<OrderType>(msg.order_type),
+                          msg.price, msg.quantity,
+                          [&](const Trade& t) { sink.on_trade(msg, t); });
+            break;
+        case MsgType::CANCEL:
+            sink.on_cancel(msg, cancel_order(msg.order_id));
+            break;
+        case MsgType::AMEND:
+            if (Order* order = book_.find_order(msg.order_id)) {
+                sink.on_amend(msg, true);
+                amend(order, msg.price, msg.quantity,
+                      [&](const Trade& t) { sink.on_trade(msg, t); });
+            } else {
+                sink.on_amend(msg, false);
+            }
+            break;
+        default:
+            sink.on_reject(msg);
+            break;
+        }
+    }
+}
+
+template <typename Book, typename Pool, typename Instrument>
+void BasicMatchingEngine<Book, Pool, Instrument>::prefetch_for(const OrderMessage& msg) const {
+    if (msg.msg_type == static_cast<uint8_t>(MsgType::CANCEL) ||
+        msg.msg_type == static_cast<uint8_t>(MsgType::AMEND)) {
+        if (const Order* order = book_.find_order(msg.order_id)) {
+            // Both halves: cancel and amend read the info for side and price
+            __builtin_prefetch(order);
+            __builtin_prefetch(&order->info());
+        }
+    } else if (msg.msg_type == static_cast<uint8_t>(MsgType::NEW_ORDER)) {
+        book_.prefetch_level(static_cast<Side>(msg.side), msg.price);
+    }
+}
+
+template <typename Book, typename Pool, typename Instrument>
+template <typename Sink>
+void BasicMatchingEngine<Book, Pool, Instrument>::match(Order* order, Sink& sink) {
+    const OrderInfo& info = order->info();
+    if (info.side == Side::BUY) {
+        if (info.type == OrderType::LIMIT) {
+            match<Side::BUY, OrderType::LIMIT>(order, sink);
+        } else {
+            match<Side::BUY, OrderType::MARKET>(order, sink);
+        }
+    } else {
+        if (info.type == OrderType::LIMIT) {
+            match<Side::SELL, OrderType::LIMIT>(order, sink);
+        } else {
+            match<Side::SELL, OrderType::MARKET>(order, sink);
+        }
+    }
+}
+
+template <typename Book, typename Pool, typename Instrument>
+template <Side S, OrderType T, typename Sink>
+void BasicMatchingEngine<Book, Pool, Instrument>::match(Order* incoming, Sink& sink) {
+    constexpr Side RESTING = opposite(S);
+    typename Instrument::Scope timer(instrument::Timer::LEVEL_WALK);
+    auto& levels = book_.template levels<RESTING>();
+    const Price limit = incoming->info().price;
+    bool touched = false;
+    [[maybe_unused]] size_t swept = 0;
+
+    while (!incoming->is_filled() && !levels.empty()) {
+        Price level_price = levels.best_price();
+
+        // Limits stop at the first level past their price; markets don't
+        if constexpr (T == OrderType::LIMIT) {
+            if (!crosses<S>(limit, level_price)) break;
+        }
+
+        PriceLevel& level = levels.best_level();
+        touched = true;
+        ++swept;
+
+        while (!incoming->is_filled() && !level.is_empty()) {
+            Order* resting = level.front();
+            Quantity fill_qty = std::min(incoming->remaining(), resting->remaining());
+
+            if constexpr (S == Side::BUY) {
+                execute_trade(incoming, resting, fill_qty, level_price, sink);
+            } else {
+                execute_trade(resting, incoming, fill_qty, level_price, sink);
+            }
+
+            // Before any pop: a filled order has nothing left for pop_front
+            // to take off the level total
+            level.reduce_quantity(fill_qty);
+            if (resting->is_filled()) {
+                level.pop_front();
+                // Only remove from lookup — don't use cancel_order which also
+                // manipulates the level container we're iterating over
+                book_.remove_from_lookup(resting->id);
+                pool_.deallocate(resting);
+            }
+        }
+
+        if (depth_) depth_->on_depth(depth_symbol_, RESTING, level_price, level.total_quantity());
+        if (level.is_empty()) {
+            levels.pop_best();
+        }
+    }
+    if (touched) {
+        book_.refresh_top(RESTING);
+        Instrument::record(instrument::Dist::LEVELS_SWEPT, swept);
+    }
+}
+
+template <typename Book, typename Pool, typename Instrument>
+template <typename Sink>
+void BasicMatchingEngine<Book, Pool, Instrument>::execute_trade(
+    Order* buyer, Order* seller, Quantity qty, Price price, Sink& sink)
+{
+    buyer->filled_qty += qty;
+    seller->filled_qty += qty;
+    ++trade_count_;
+    Instrument::count(instrument::Counter::TRADES, 1);
+
+    sink(Trade{
+        .buyer_order_id = buyer->id,
+        .seller_order_id = seller->id,
+        .price = price,
+        .quantity = qty,
+        .timestamp = next_timestamp_++
+    });
+}
+
+// The shipped configurations, instantiated once in matching_engine.cpp
+extern template class BasicMatchingEngine<OrderBook>;
+extern template class BasicMatchingEngine<LadderOrderBook>;
+
+using MatchingEngine = BasicMatchingEngine<OrderBook>;
+using LadderMatchingEngine = BasicMatchingEngine<LadderOrderBook>;
+
 } // namespace ob
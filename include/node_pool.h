@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ob {
+
+// Fixed-size slots for a node-based container. Node types only exist
+// inside the container, so the slot size is taken from the first
+// allocation; every later node of that container has the same size.
+// Freed slots go on a free list and are handed out again before any new
+// chunk is carved, so a container whose size hovers (levels appearing
+// and emptying at the touch) stops allocating once it has warmed up, and
+// its nodes stay packed in a few chunks instead of spread over the heap.
+class NodePool {
+public:
+    explicit NodePool(size_t chunk_slots = 256) : chunk_slots_(chunk_slots) {}
+
+    ~NodePool() {
+        for (void* chunk : chunks_) ::operator delete(chunk, std::align_val_t{ALIGN});
+    }
+
+    // Non-copyable, non-movable: containers hold a pointer to it
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Whether a request of this shape is served from slots; fixes the slot
+    // size on the first call
+    bool fits(size_t bytes, size_t align) {
+        if (slot_size_ == 0) {
+            slot_size_ = (std::max(bytes, sizeof(Free)) + ALIGN - 1) / ALIGN * ALIGN;
+        }
+        return bytes <= slot_size_ && align <= ALIGN;
+    }
+
+    void* allocate() {
+        if (free_list_ == nullptr) [[unlikely]] {
+            add_chunk();
+        }
+        Free* slot = free_list_;
+        free_list_ = slot->next;
+        ++allocated_;
+        return slot;
+    }
+
+    void deallocate(void* p) {
+        Free* slot = static_cast<Free*>(p);
+        slot->next = free_list_;
+        free_list_ = slot;
+        --allocated_;
+    }
+
+    // Carve slots for at least n more nodes now. Precondition: fits() has
+    // been called, which node containers do on their first insert.
+    void reserve(size_t n) {
+        while (capacity_ - allocated_ < n) add_chunk();
+    }
+
+    size_t allocated_count() const { return allocated_; }
+    size_t capacity() const { return capacity_; }
+    size_t slot_size() const { return slot_size_; }
+
+private:
+    static constexpr size_t ALIGN = alignof(std::max_align_t);
+
+    struct Free {
+        Free* next;
+    };
+
+    void add_chunk() {
+        char* chunk = static_cast<char*>(
+            ::operator new(slot_size_ * chunk_slots_, std::align_val_t{ALIGN}));
+        chunks_.push_back(chunk);
+        // Chain back to front so slots are handed out in address order
+        for (size_t i = chunk_slots_; i-- > 0;) {
+            Free* slot = reinterpret_cast<Free*>(chunk + i * slot_size_);
+            slot->next = free_list_;
+            free_list_ = slot;
+        }
+        capacity_ += chunk_slots_;
+    }
+
+    size_t chunk_slots_;
+    size_t slot_size_ = 0;
+    Free* free_list_ = nullptr;
+    size_t allocated_ = 0;
+    size_t capacity_ = 0;
+    std::vector<void*> chunks_;
+};
+
+// Allocator drawing single objects from a NodePool and anything else
+// (arrays, or a type that doesn't fit the slot) from the heap. Rebound
+// copies share the pool, so the container's internal node allocator ends
+// up using it.
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(NodePool& pool) noexcept : pool_(&pool) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool_(other.pool()) {}
+
+    T* allocate(size_t n) {
+        if (n == 1 && pool_->fits(sizeof(T), alignof(T))) {
+            return static_cast<T*>(pool_->allocate());
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (n == 1 && pool_->fits(sizeof(T), alignof(T))) {
+            pool_->deallocate(p);
+        } else {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    NodePool* pool() const noexcept { return pool_; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept { return pool_ == other.pool(); }
+
+private:
+    NodePool* pool_;
+};
+
+// std::map whose nodes come from a NodePool
+template <typename K, typename V, typename Compare>
+using PooledMap = std::map<K, V, Compare, PoolAllocator<std::pair<const K, V>>>;
+
+} // namespace ob
@@ -1,24 +1,65 @@
 #pragma once
 
+#include <algorithm>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include "page_memory.h"
+#include <mutex>
+#include <new>
 #include <vector>
 
 namespace ob {
 
+struct PoolOptions {
+    // Objects carved out of one mapping at construction; 0: one block
+    size_t capacity = 0;
+    // Page size behind every block; see PageMemory for the fallback when
+    // no huge pages are reserved
+    PageSize pages = PageSize::NORMAL;
+    // mlock the pool so none of it is ever paged out
+    bool lock = false;
+    // NUMA node every block is bound to; -1: wherever the allocating
+    // thread first touches it
+    int numa_node = -1;
+    // Add a block when the free list runs dry. Without growth, allocate()
+    // throws std::bad_alloc once capacity is used up (and
+    // MatchingEngine::process_batch rejects new orders instead).
+    bool grow = true;
+};
+
+// Types stored as a hot record with a cold twin (T::Cold). Their memory
+// comes in T::CHUNK-aligned chunks of T::PER_CHUNK records followed by the
+// PER_CHUNK twins, T::HOT_BYTES in; a record finds its twin from its place
+// in the chunk.
+template <typename T>
+concept SplitLayout = requires {
+    typename T::Cold;
+    { T::CHUNK } -> std::convertible_to<size_t>;
+    { T::PER_CHUNK } -> std::convertible_to<size_t>;
+    { T::HOT_BYTES } -> std::convertible_to<size_t>;
+};
+
 // Pre-allocated memory pool. Avoids new/delete overhead per order.
 // allocate() and deallocate() are O(1) — no system calls in the hot path.
+//
+// Every block is prefaulted when it is mapped, so given a capacity that
+// covers the session (high_water() from a replay is a good guide) the
+// order path never takes a page fault or a trip to the kernel. With huge
+// pages the whole pool sits under a handful of TLB entries.
+//
+// A SplitLayout T is carved in chunks (PER_CHUNK records, then their
+// twins); the pool hands out and chains only the records. Page-aligned
+// blocks keep every chunk CHUNK-aligned.
 template <typename T, size_t BlockSize = 4096>
 class ObjectPool {
 public:
-    ObjectPool() {
-        allocate_block();
-    }
+    ObjectPool() : ObjectPool(PoolOptions{}) {}
 
-    ~ObjectPool() {
-        for (auto* block : blocks_) {
-            ::operator delete(block, std::align_val_t{alignof(T)});
-        }
+    explicit ObjectPool(const PoolOptions& options)
+        : pages_(options.pages), lock_(options.lock), grow_(options.grow),
+          numa_node_(options.numa_node) {
+        add_block(options.capacity ? options.capacity : BlockSize);
     }
 
     // Non-copyable, non-movable
@@ -32,9 +73,16 @@ public:
         Node* node = free_list_;
         free_list_ = node->next;
         ++allocated_;
+        if (allocated_ > high_water_) high_water_ = allocated_;
         return reinterpret_cast<T*>(node);
     }
 
+    // nullptr instead of throwing when the pool is full and may not grow
+    T* try_allocate() {
+        if (full()) return nullptr;
+        return allocate();
+    }
+
     void deallocate(T* ptr) {
         Node* node = reinterpret_cast<Node*>(ptr);
         node->next = free_list_;
@@ -42,8 +90,28 @@ public:
         --allocated_;
     }
 
+    // Grow until at least n allocations can be served without a new block.
+    // Does nothing if the pool may not grow.
+    void reserve(size_t n) {
+        if (!grow_) return;
+        size_t free = capacity_ - allocated_;
+        if (free < n) add_block((n - free + BlockSize - 1) / BlockSize * BlockSize);
+    }
+
     size_t allocated_count() const { return allocated_; }
-    size_t capacity() const { return blocks_.size() * BlockSize; }
+    size_t capacity() const { return capacity_; }
+    // Most objects ever out at once
+    size_t high_water() const { return high_water_; }
+    size_t block_count() const { return blocks_.size(); }
+    // The next allocate() would throw
+    bool full() const { return free_list_ == nullptr && !grow_; }
+    // Whether every block got the huge pages asked for
+    bool huge_pages() const {
+        for (const auto& b : blocks_) {
+            if (!b.huge()) return false;
+        }
+        return pages_ != PageSize::NORMAL;
+    }
 
 private:
     struct Node {
@@ -54,22 +122,212 @@ private:
         "Object must be at least pointer-sized for free list");
 
     void allocate_block() {
-        // Allocate raw memory aligned for T
-        char* block = static_cast<char*>(
-            ::operator new(sizeof(T) * BlockSize, std::align_val_t{alignof(T)}));
-        blocks_.push_back(block);
+        if (!grow_) throw std::bad_alloc();
+        add_block(BlockSize);
+    }
+
+    // Slots per carving unit, and the unit's bytes
+    static constexpr size_t PER_UNIT = [] {
+        if constexpr (SplitLayout<T>) return T::PER_CHUNK;
+        else return size_t{1};
+    }();
+    static constexpr size_t UNIT_BYTES = [] {
+        if constexpr (SplitLayout<T>) return T::CHUNK;
+        else return sizeof(T);
+    }();
+
+    static char* slot_address(char* block, size_t i) {
+        return block + i / PER_UNIT * UNIT_BYTES + i % PER_UNIT * sizeof(T);
+    }
+
+    void add_block(size_t slots) {
+        PageMemory memory((slots + PER_UNIT - 1) / PER_UNIT * UNIT_BYTES, pages_, lock_, numa_node_);
+        // A huge page holds far more than one block; use all of it
+        if (pages_ != PageSize::NORMAL) slots = memory.size() / UNIT_BYTES * PER_UNIT;
 
         // Chain all slots into the free list
-        for (size_t i = 0; i < BlockSize; ++i) {
-            Node* node = reinterpret_cast<Node*>(block + i * sizeof(T));
+        char* block = memory.data();
+        for (size_t i = 0; i < slots; ++i) {
+            Node* node = reinterpret_cast<Node*>(slot_address(block, i));
             node->next = free_list_;
             free_list_ = node;
         }
+        capacity_ += slots;
+        blocks_.push_back(std::move(memory));
     }
 
     Node* free_list_ = nullptr;
     size_t allocated_ = 0;
-    std::vector<char*> blocks_;
+    size_t high_water_ = 0;
+    size_t capacity_ = 0;
+    PageSize pages_;
+    bool lock_;
+    bool grow_;
+    int numa_node_;
+    std::vector<PageMemory> blocks_;
+};
+
+// Plain new/delete behind the pool interface BasicMatchingEngine uses, as
+// the baseline ObjectPool is measured against. A SplitLayout T is
+// allocated as the first record of a chunk of its own, so its twin is in
+// the same allocation.
+//
+// Like ObjectPool, destroying the pool frees whatever is still out (the
+// engine leaves its resting orders to it): every allocation carries a
+// link after the object, chaining it into a list of live ones.
+template <typename T>
+class HeapPool {
+public:
+    HeapPool() = default;
+    HeapPool(const HeapPool&) = delete;
+    HeapPool& operator=(const HeapPool&) = delete;
+
+    ~HeapPool() {
+        while (live_) {
+            Link* next = live_->next;
+            ::operator delete(object(live_), ALLOC_BYTES, std::align_val_t{ALIGN});
+            live_ = next;
+        }
+    }
+
+    T* allocate() {
+        void* p = ::operator new(ALLOC_BYTES, std::align_val_t{ALIGN});
+        Link* link = link_of(p);
+        link->prev = nullptr;
+        link->next = live_;
+        if (live_) live_->prev = link;
+        live_ = link;
+        ++allocated_;
+        if (allocated_ > high_water_) high_water_ = allocated_;
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* ptr) {
+        Link* link = link_of(ptr);
+        if (link->prev) link->prev->next = link->next;
+        else live_ = link->next;
+        if (link->next) link->next->prev = link->prev;
+        ::operator delete(ptr, ALLOC_BYTES, std::align_val_t{ALIGN});
+        --allocated_;
+    }
+
+    void reserve(size_t) {}
+    bool full() const { return false; }
+    size_t allocated_count() const { return allocated_; }
+    size_t high_water() const { return high_water_; }
+
+private:
+    struct Link {
+        Link* prev;
+        Link* next;
+    };
+
+    static constexpr size_t BYTES = [] {
+        if constexpr (SplitLayout<T>) return T::HOT_BYTES + sizeof(typename T::Cold);
+        else return sizeof(T);
+    }();
+    static constexpr size_t ALIGN = [] {
+        if constexpr (SplitLayout<T>) return T::CHUNK;
+        else return std::max(alignof(T), alignof(Link));
+    }();
+    static constexpr size_t LINK_OFFSET = (BYTES + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+    static constexpr size_t ALLOC_BYTES = LINK_OFFSET + sizeof(Link);
+
+    static Link* link_of(void* p) {
+        return reinterpret_cast<Link*>(static_cast<char*>(p) + LINK_OFFSET);
+    }
+    static void* object(Link* link) {
+        return reinterpret_cast<char*>(link) - LINK_OFFSET;
+    }
+
+    Link* live_ = nullptr;
+    size_t allocated_ = 0;
+    size_t high_water_ = 0;
+};
+
+// An ObjectPool several threads can draw from. Each thread goes through
+// its own PoolCache, which takes objects from here and hands them back in
+// batches, so the lock is taken once per batch rather than per object.
+template <typename T, size_t BlockSize = 4096>
+class SharedObjectPool {
+public:
+    explicit SharedObjectPool(const PoolOptions& options = {}) : pool_(options) {}
+
+    // Up to n objects into out; fewer only if the pool may not grow
+    size_t allocate_bulk(T** out, size_t n) {
+        std::lock_guard<std::mutex> guard(lock_);
+        size_t got = 0;
+        while (got < n) {
+            T* p = pool_.try_allocate();
+            if (!p) break;
+            out[got++] = p;
+        }
+        return got;
+    }
+
+    void deallocate_bulk(T* const* in, size_t n) {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (size_t i = 0; i < n; ++i) pool_.deallocate(in[i]);
+    }
+
+    // Objects held by caches count as allocated
+    size_t allocated_count() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return pool_.allocated_count();
+    }
+
+    size_t high_water() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return pool_.high_water();
+    }
+
+private:
+    mutable std::mutex lock_;
+    ObjectPool<T, BlockSize> pool_;
+};
+
+// One thread's front end to a SharedObjectPool: a stack of up to 2 * batch
+// free objects. Refills take a batch when it runs empty; a full stack
+// returns a batch. Objects may be freed through a different thread's cache
+// than the one that allocated them.
+template <typename T, size_t BlockSize = 4096>
+class PoolCache {
+public:
+    explicit PoolCache(SharedObjectPool<T, BlockSize>& shared, size_t batch = 64)
+        : shared_(shared), batch_(batch ? batch : 1), slots_(2 * batch_) {}
+
+    ~PoolCache() {
+        shared_.deallocate_bulk(slots_.data(), count_);
+    }
+
+    PoolCache(const PoolCache&) = delete;
+    PoolCache& operator=(const PoolCache&) = delete;
+
+    T* allocate() {
+        if (count_ == 0) [[unlikely]] {
+            count_ = shared_.allocate_bulk(slots_.data(), batch_);
+            if (count_ == 0) throw std::bad_alloc();
+        }
+        return slots_[--count_];
+    }
+
+    void deallocate(T* ptr) {
+        if (count_ == slots_.size()) [[unlikely]] {
+            // Return the older half; the recently freed stay warm here
+            shared_.deallocate_bulk(slots_.data(), batch_);
+            for (size_t i = 0; i < batch_; ++i) slots_[i] = slots_[batch_ + i];
+            count_ = batch_;
+        }
+        slots_[count_++] = ptr;
+    }
+
+    size_t cached() const { return count_; }
+
+private:
+    SharedObjectPool<T, BlockSize>& shared_;
+    size_t batch_;
+    std::vector<T*> slots_;
+    size_t count_ = 0;
 };
 
 } // namespace ob
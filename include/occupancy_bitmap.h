@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ob {
+
+// One bit per slot, with summary levels above it: bit j of a word at level
+// L + 1 is set while word j of level L is non-zero. The top level is a
+// single word. The first or last set bit, or the nearest one on either
+// side of a slot, is found with one count-zeros per level (tzcnt/lzcnt
+// under -march=native) however far away it is, so a sparse ladder costs
+// the same to search as a dense one. 4096 slots take two levels; a
+// million take four.
+class OccupancyBitmap {
+public:
+    static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+    explicit OccupancyBitmap(size_t bits) : bits_(bits) {
+        size_t n = bits ? bits : 1;
+        do {
+            n = (n + 63) / 64;
+            levels_.emplace_back(n, 0);
+        } while (n > 1);
+    }
+
+    size_t size() const { return bits_; }
+    bool any() const { return levels_.back()[0] != 0; }
+
+    bool test(size_t i) const {
+        return (levels_[0][i / 64] >> (i % 64)) & 1;
+    }
+
+    void set(size_t i) {
+        for (auto& level : levels_) {
+            uint64_t& word = level[i / 64];
+            bool was_empty = word == 0;
+            word |= bit(i % 64);
+            if (!was_empty) return;
+            i /= 64;
+        }
+    }
+
+    void reset(size_t i) {
+        for (auto& level : levels_) {
+            uint64_t& word = level[i / 64];
+            word &= ~bit(i % 64);
+            if (word != 0) return;
+            i /= 64;
+        }
+    }
+
+    void clear() {
+        for (auto& level : levels_) std::fill(level.begin(), level.end(), 0);
+    }
+
+    // Lowest / highest set bit, NPOS if none
+    size_t first() const {
+        return any() ? descend_low(levels_.size() - 1, 0) : NPOS;
+    }
+
+    size_t last() const {
+        return any() ? descend_high(levels_.size() - 1, 0) : NPOS;
+    }
+
+    // Lowest set bit above i / highest set bit below i, NPOS if none
+    size_t next(size_t i) const {
+        for (size_t l = 0; l < levels_.size(); ++l, i /= 64) {
+            if (i % 64 == 63) continue;
+            uint64_t word = levels_[l][i / 64] & (~uint64_t{0} << (i % 64 + 1));
+            if (word != 0) {
+                size_t found = i / 64 * 64 + std::countr_zero(word);
+                return l == 0 ? found : descend_low(l - 1, found);
+            }
+        }
+        return NPOS;
+    }
+
+    size_t prev(size_t i) const {
+        for (size_t l = 0; l < levels_.size(); ++l, i /= 64) {
+            if (i % 64 == 0) continue;
+            uint64_t word = levels_[l][i / 64] & (bit(i % 64) - 1);
+            if (word != 0) {
+                size_t found = i / 64 * 64 + 63 - std::countl_zero(word);
+                return l == 0 ? found : descend_high(l - 1, found);
+            }
+        }
+        return NPOS;
+    }
+
+private:
+    static uint64_t bit(size_t n) { return uint64_t{1} << n; }
+
+    // Follow set bits down from word w of level l to a slot
+    size_t descend_low(size_t l, size_t w) const {
+        for (;; --l) {
+            w = w * 64 + std::countr_zero(levels_[l][w]);
+            if (l == 0) return w;
+        }
+    }
+
+    size_t descend_high(size_t l, size_t w) const {
+        for (;; --l) {
+            w = w * 64 + 63 - std::countl_zero(levels_[l][w]);
+            if (l == 0) return w;
+        }
+    }
+
+    size_t bits_;
+    std::vector<std::vector<uint64_t>> levels_;   // [0] is one bit per slot
+};
+
+} // namespace ob
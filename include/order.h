@@ -1,24 +1,87 @@
 #pragma once
 
 #include "types.h"
+#include <cstddef>
+#include <cstdint>
 
 namespace ob {
 
-// Compact order struct — fits in one cache line (~64 bytes).
+// Cold half of an order: what the match loop never reads for the resting
+// orders it walks. Touched on arrival, cancel, amend and snapshot.
+struct OrderInfo {
+    Timestamp timestamp;   // 8 bytes
+    Price     price;       // 8 bytes (fixed-point)
+    Side      side;        // 1 byte
+    OrderType type;        // 1 byte
+    uint8_t   padding[6];  // pad to 24 bytes
+};
+
+static_assert(sizeof(OrderInfo) == 24, "OrderInfo must be 24 bytes");
+
+// Hot half: everything a sweep reads and writes per resting order, two to
+// a cache line.
+//
+// The halves are stored apart (see ObjectPool): memory comes in CHUNK-byte
+// chunks, CHUNK-aligned, holding PER_CHUNK Orders followed by their
+// PER_CHUNK OrderInfos, and info() finds an order's twin from where the
+// order sits in its chunk. An Order therefore only ever lives in an order
+// pool, never on its own or in an array of Orders.
 struct Order {
     OrderId   id;           // 8 bytes
-    Timestamp timestamp;    // 8 bytes
-    Price     price;        // 8 bytes (fixed-point)
     Quantity  quantity;     // 4 bytes (original quantity)
-    Quantity  filled_qty;  // 4 bytes
-    Side      side;        // 1 byte
-    OrderType type;        // 1 byte
-    uint8_t   padding[30]; // pad to 64 bytes
+    Quantity  filled_qty;   // 4 bytes
+    Order*    prev;         // 8 bytes (intrusive FIFO links, owned by PriceLevel)
+    Order*    next;         // 8 bytes
+
+    using Cold = OrderInfo;
+    static constexpr size_t CHUNK = 512;
+    static constexpr size_t PER_CHUNK = 9;   // 9 * (32 + 24) = 504 of the 512 bytes
+    static constexpr size_t HOT_BYTES = PER_CHUNK * 32;
 
     Quantity remaining() const { return quantity - filled_qty; }
     bool is_filled() const { return filled_qty >= quantity; }
+
+    OrderInfo& info() { return *twin(reinterpret_cast<uintptr_t>(this)); }
+    const OrderInfo& info() const { return *twin(reinterpret_cast<uintptr_t>(this)); }
+
+private:
+    static OrderInfo* twin(uintptr_t self) {
+        uintptr_t chunk = self & ~uintptr_t{CHUNK - 1};
+        size_t index = (self - chunk) / 32;
+        return reinterpret_cast<OrderInfo*>(chunk + HOT_BYTES + index * sizeof(OrderInfo));
+    }
+};
+
+static_assert(sizeof(Order) == 32, "Order must be 32 bytes, two to a cache line");
+static_assert(Order::HOT_BYTES + Order::PER_CHUNK * sizeof(OrderInfo) <= Order::CHUNK);
+
+// Both halves of an order as one plain value, in the pre-split 64-byte
+// layout that book snapshots store
+struct OrderRecord {
+    OrderId   id;
+    Timestamp timestamp;
+    Price     price;
+    Quantity  quantity;
+    Quantity  filled_qty;
+    uint64_t  unused[2];   // were the links; zero
+    Side      side;
+    OrderType type;
+    uint8_t   padding[14];
+
+    static OrderRecord of(const Order& order) {
+        const OrderInfo& info = order.info();
+        OrderRecord r{};
+        r.id = order.id;
+        r.timestamp = info.timestamp;
+        r.price = info.price;
+        r.quantity = order.quantity;
+        r.filled_qty = order.filled_qty;
+        r.side = info.side;
+        r.type = info.type;
+        return r;
+    }
 };
 
-static_assert(sizeof(Order) == 64, "Order must be 64 bytes for cache-line alignment");
+static_assert(sizeof(OrderRecord) == 64, "OrderRecord is the snapshot's 64-byte order");
 
 } // namespace ob
@@ -3,40 +3,123 @@
 #include "types.h"
 #include "order.h"
 #include "price_level.h"
-#include <map>
-#include <unordered_map>
+#include "map_levels.h"
+#include "ladder_levels.h"
+#include "order_index.h"
+#include <algorithm>
 #include <optional>
-#include <functional>
+#include <iosfwd>
+#include <span>
 
 namespace ob {
 
-class OrderBook {
+// One price level as seen from outside the book
+struct LevelSnapshot {
+    Price    price;
+    Quantity quantity;
+    uint32_t order_count;   // 0: no level (empty side)
+};
+
+// Price-time priority book. The per-side level container and the id
+// lookup are template parameters so backends can be swapped and compared:
+//   MapLevels    — std::map, any price distribution
+//   LadderLevels — contiguous tick-indexed array around the touch
+//   OrderIndex   — direct-indexed by sequential id, hashed fallback
+//   FlatOrderMap — the hashed table alone
+template <template <Side> class Levels, typename Index = OrderIndex>
+class BasicOrderBook {
 public:
+    using BidLevels = Levels<Side::BUY>;
+    using AskLevels = Levels<Side::SELL>;
+
     // Add a resting order to the book
     void add_order(Order* order);
 
+    // Snapshot load: link already-filled orders of one price, in FIFO
+    // order, straight into their level and the id index. One level lookup
+    // for the lot instead of one per add_order.
+    void restore_level(Side side, Order* const* orders, size_t count);
+
     // Cancel an order by ID. Returns the removed order (caller handles deallocation).
     Order* cancel_order(OrderId order_id);
 
+    // Amend support. reduce_order takes qty off a resting order's size in
+    // place, keeping its queue position. unlink_order takes an order out
+    // of its level but leaves it findable by id; relink_order queues it at
+    // the back of the level at its (possibly new) price.
+    void reduce_order(Order* order, Quantity qty);
+    void unlink_order(Order* order);
+    void relink_order(Order* order);
+
     // Top-of-book access
     std::optional<Price> best_bid() const;
     std::optional<Price> best_ask() const;
 
+    // Best level per side with its size, kept current by every mutation
+    // so polling it is a load, not a container walk
+    const LevelSnapshot& top(Side side) const { return top_[static_cast<size_t>(side)]; }
+
+    // Re-read side's best level into the cache. The book's own mutations
+    // do this; the matching engine calls it after working levels directly.
+    void refresh_top(Side side) {
+        if (side == Side::BUY) {
+            top_[0] = best_snapshot(bids_);
+        } else {
+            top_[1] = best_snapshot(asks_);
+        }
+    }
+
+    // Fill out with up to n best levels of side, best first, without
+    // allocating. Returns how many were written.
+    size_t get_depth(Side side, size_t n, std::span<LevelSnapshot> out) const {
+        size_t count = 0;
+        auto fill = [&](Price price, const PriceLevel& level) {
+            out[count++] = {price, level.total_quantity(),
+                            static_cast<uint32_t>(level.order_count())};
+        };
+        n = std::min(n, out.size());
+        if (side == Side::BUY) {
+            bids_.for_each_best(n, fill);
+        } else {
+            asks_.for_each_best(n, fill);
+        }
+        return count;
+    }
+
     // Volume at a specific price level
     Quantity get_volume_at_price(Side side, Price price) const;
 
-    // Iterators for matching engine to walk the book
+    // Level containers for matching engine to walk the book
     // Bids: highest price first
-    auto& bids() { return bids_; }
-    const auto& bids() const { return bids_; }
+    BidLevels& bids() { return bids_; }
+    const BidLevels& bids() const { return bids_; }
 
     // Asks: lowest price first
-    auto& asks() { return asks_; }
-    const auto& asks() const { return asks_; }
+    AskLevels& asks() { return asks_; }
+    const AskLevels& asks() const { return asks_; }
+
+    // One side chosen at compile time, for side-generic code
+    template <Side S>
+    auto& levels() {
+        if constexpr (S == Side::BUY) return bids_;
+        else return asks_;
+    }
 
     // Check if order exists in the book
     bool has_order(OrderId id) const;
 
+    // Resting order by id, or nullptr
+    Order* find_order(OrderId id) const { return order_lookup_.find(id); }
+
+    // Hint that the level at (side, price) is about to be touched
+    void prefetch_level(Side side, Price price) const {
+        if (side == Side::BUY) {
+            bids_.prefetch(price);
+        } else {
+            asks_.prefetch(price);
+        }
+    }
+
     // Remove order from lookup only (used by matching engine which handles level cleanup itself)
     void remove_from_lookup(OrderId id);
 
@@ -49,14 +132,32 @@ public:
     void print(std::ostream& os) const;
 
 private:
-    // Bids sorted highest-first, asks sorted lowest-first
-    std::map<Price, PriceLevel, std::greater<>> bids_;
-    std::map<Price, PriceLevel> asks_;
-
-    // O(1) lookup for cancel
-    std::unordered_map<OrderId, Order*> order_lookup_;
-
-    void remove_empty_level(Side side, Price price);
+    BidLevels bids_;
+    AskLevels asks_;
+
+    // O(1) lookup for cancel and fill; direct-indexed by sequential id
+    Index order_lookup_;
+
+    LevelSnapshot top_[2] = {};   // by Side
+
+    template <typename L>
+    static LevelSnapshot best_snapshot(L& levels) {
+        if (levels.empty()) return {};
+        const PriceLevel& level = levels.best_level();
+        return {levels.best_price(), level.total_quantity(),
+                static_cast<uint32_t>(level.order_count())};
+    }
+
+    // Whether a change at price can alter side's best level
+    bool touches_top(Side side, Price price) const {
+        const LevelSnapshot& t = top(side);
+        if (t.order_count == 0 || price == t.price) return true;
+        return side == Side::BUY ? is_better_price<Side::BUY>(price, t.price)
+                                 : is_better_price<Side::SELL>(price, t.price);
+    }
 };
 
+using OrderBook = BasicOrderBook<MapLevels>;
+using LadderOrderBook = BasicOrderBook<LadderLevels>;
+
 } // namespace ob
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "types.h"
+#include "order.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace ob {
+
+// Open-addressing OrderId -> Order* map with linear probing and
+// backward-shift deletion. One flat array, no per-entry allocation, no
+// tombstones. Id ~0 is reserved as the empty marker.
+class FlatOrderMap {
+public:
+    FlatOrderMap() { rehash(MIN_CAPACITY); }
+
+    void insert(OrderId id, Order* order) {
+        if ((size_ + 1) * 4 > slots_.size() * 3) [[unlikely]] {
+            rehash(slots_.size() * 2);
+        }
+        size_t i = home(id);
+        while (slots_[i].key != EMPTY && slots_[i].key != id) {
+            i = (i + 1) & mask_;
+        }
+        if (slots_[i].key == EMPTY) ++size_;
+        slots_[i] = {id, order};
+    }
+
+    Order* find(OrderId id) const {
+        for (size_t i = home(id); slots_[i].key != EMPTY; i = (i + 1) & mask_) {
+            if (slots_[i].key == id) return slots_[i].value;
+        }
+        return nullptr;
+    }
+
+    bool erase(OrderId id) {
+        size_t i = home(id);
+        while (slots_[i].key != id) {
+            if (slots_[i].key == EMPTY) return false;
+            i = (i + 1) & mask_;
+        }
+
+        // Shift later members of the probe run back into the hole so
+        // lookups never need tombstones
+        size_t hole = i;
+        for (size_t j = (i + 1) & mask_; slots_[j].key != EMPTY; j = (j + 1) & mask_) {
+            size_t h = home(slots_[j].key);
+            if (((j - h) & mask_) >= ((j - hole) & mask_)) {
+                slots_[hole] = slots_[j];
+                hole = j;
+            }
+        }
+        slots_[hole].key = EMPTY;
+        --size_;
+        return true;
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    struct Slot {
+        OrderId key;
+        Order*  value;
+    };
+
+    static constexpr OrderId EMPTY = ~OrderId{0};
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+    unsigned shift_ = 0;
+    size_t size_ = 0;
+
+    // Fibonacci hashing: sequential ids spread across the table
+    size_t home(OrderId id) const {
+        return static_cast<size_t>((id * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> old(capacity, Slot{EMPTY, nullptr});
+        old.swap(slots_);
+        mask_ = capacity - 1;
+        shift_ = 64 - static_cast<unsigned>(__builtin_ctzll(capacity));
+        size_ = 0;
+        for (const Slot& s : old) {
+            if (s.key != EMPTY) insert(s.key, s.value);
+        }
+    }
+};
+
+// OrderId -> resting Order* for the cancel and fill paths.
+// The engine assigns ids sequentially, so the common case is a direct-index
+// table split into fixed chunks: lookup is a shift and two loads, and a
+// chunk is released once every id in it is dead and newer ids have moved
+// on. Ids that don't fit the window (far ahead, or behind a retired chunk)
+// fall back to a FlatOrderMap.
+class OrderIndex {
+public:
+    static constexpr unsigned CHUNK_BITS = 12;
+    static constexpr size_t CHUNK_SIZE = size_t{1} << CHUNK_BITS;
+    // Ids more than this many chunks past the window go to the fallback
+    static constexpr size_t MAX_GAP_CHUNKS = 1024;
+
+    OrderIndex() = default;
+    ~OrderIndex() {
+        for (Chunk* c : chunks_) delete c;
+        delete spare_;
+    }
+
+    OrderIndex(const OrderIndex&) = delete;
+    OrderIndex& operator=(const OrderIndex&) = delete;
+
+    void insert(OrderId id, Order* order) {
+        uint64_t c = id >> CHUNK_BITS;
+        if (chunks_.empty()) [[unlikely]] {
+            first_chunk_ = c;
+        }
+        if (c < first_chunk_ || c - first_chunk_ >= chunks_.size() + MAX_GAP_CHUNKS) [[unlikely]] {
+            if (fallback_.find(id) == nullptr) ++size_;
+            fallback_.insert(id, order);
+            return;
+        }
+
+        size_t idx = static_cast<size_t>(c - first_chunk_);
+        while (idx >= chunks_.size()) {
+            chunks_.push_back(nullptr);
+        }
+        Chunk*& chunk = chunks_[idx];
+        if (chunk == nullptr) {
+            chunk = new_chunk();
+        }
+
+        Order*& slot = chunk->slots[id & (CHUNK_SIZE - 1)];
+        if (slot == nullptr) {
+            ++chunk->live;
+            ++size_;
+        }
+        slot = order;
+        if (c > high_chunk_) advance_high(c);
+    }
+
+    Order* find(OrderId id) const {
+        uint64_t c = (id >> CHUNK_BITS) - first_chunk_;
+        if (c < chunks_.size() && chunks_[c] != nullptr) [[likely]] {
+            Order* o = chunks_[c]->slots[id & (CHUNK_SIZE - 1)];
+            if (o != nullptr || fallback_.empty()) return o;
+        }
+        return fallback_.empty() ? nullptr : fallback_.find(id);
+    }
+
+    bool erase(OrderId id) {
+        uint64_t c = (id >> CHUNK_BITS) - first_chunk_;
+        if (c < chunks_.size() && chunks_[c] != nullptr) [[likely]] {
+            Chunk* chunk = chunks_[c];
+            Order*& slot = chunk->slots[id & (CHUNK_SIZE - 1)];
+            if (slot != nullptr) {
+                slot = nullptr;
+                --size_;
+                if (--chunk->live == 0) {
+                    maybe_retire(static_cast<size_t>(c));
+                }
+                return true;
+            }
+        }
+        if (!fallback_.empty() && fallback_.erase(id)) {
+            --size_;
+            return true;
+        }
+        return false;
+    }
+
+    bool contains(OrderId id) const { return find(id) != nullptr; }
+    size_t size() const { return size_; }
+
+    // Chunks currently allocated (diagnostics)
+    size_t chunk_count() const {
+        size_t n = 0;
+        for (Chunk* c : chunks_) n += (c != nullptr);
+        return n;
+    }
+
+private:
+    struct Chunk {
+        Order*   slots[CHUNK_SIZE];
+        uint32_t live;
+    };
+
+    std::deque<Chunk*> chunks_;    // chunks_[i] covers chunk number first_chunk_ + i
+    uint64_t first_chunk_ = 0;
+    uint64_t high_chunk_ = 0;      // chunk of the highest id seen
+    Chunk* spare_ = nullptr;       // one recycled chunk, avoids malloc churn at the boundary
+    size_t size_ = 0;
+    FlatOrderMap fallback_;
+
+    Chunk* new_chunk() {
+        Chunk* chunk = spare_ ? spare_ : new Chunk;
+        spare_ = nullptr;
+        for (Order*& s : chunk->slots) s = nullptr;
+        chunk->live = 0;
+        return chunk;
+    }
+
+    // The old head chunk may have emptied while it was still the head,
+    // when maybe_retire had to keep it; now it can go
+    void advance_high(uint64_t c) {
+        uint64_t old = high_chunk_;
+        high_chunk_ = c;
+        if (old < first_chunk_) return;
+        size_t idx = static_cast<size_t>(old - first_chunk_);
+        if (idx < chunks_.size() && chunks_[idx] != nullptr && chunks_[idx]->live == 0) {
+            maybe_retire(idx);
+        }
+    }
+
+    // A dead chunk behind the newest id will never be written again
+    void maybe_retire(size_t idx) {
+        if (first_chunk_ + idx >= high_chunk_) return;
+
+        Chunk* chunk = chunks_[idx];
+        chunks_[idx] = nullptr;
+        if (spare_ == nullptr) {
+            spare_ = chunk;
+        } else {
+            delete chunk;
+        }
+
+        while (!chunks_.empty() && chunks_.front() == nullptr) {
+            chunks_.pop_front();
+            ++first_chunk_;
+        }
+    }
+};
+
+} // namespace ob
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "protocol.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ob {
+
+// Binary order log for replays: an OrderLogHeader, then OrderLogRecords
+// back to back, so a mapped file is an array that needs no parsing.
+// Host byte order, like the wire protocol.
+struct OrderLogHeader {
+    char     magic[8];        // "OBORDLOG"
+    uint32_t version;
+    uint32_t record_size;     // sizeof(OrderLogRecord)
+    uint64_t record_count;
+    uint64_t reserved;
+};
+static_assert(sizeof(OrderLogHeader) == 32, "OrderLogHeader must be 32 bytes");
+
+struct OrderLogRecord {
+    uint64_t     timestamp_ns;   // when the request arrived; 0 if unknown
+    OrderMessage msg;
+};
+static_assert(sizeof(OrderLogRecord) == 40, "OrderLogRecord must be 40 bytes");
+
+class OrderLogWriter {
+public:
+    OrderLogWriter() = default;
+    ~OrderLogWriter();
+
+    OrderLogWriter(const OrderLogWriter&) = delete;
+    OrderLogWriter& operator=(const OrderLogWriter&) = delete;
+
+    // Create or truncate path. False on I/O error.
+    bool open(const std::string& path);
+
+    void append(uint64_t timestamp_ns, const OrderMessage& msg);
+
+    // Flush and record the final count in the header. False if any write failed.
+    bool close();
+
+    uint64_t count() const { return count_; }
+
+private:
+    static constexpr size_t BUFFER_RECORDS = 1 << 14;
+
+    int fd_ = -1;
+    std::vector<OrderLogRecord> buf_;
+    uint64_t count_ = 0;
+    bool failed_ = false;
+
+    void flush();
+};
+
+// Maps a log read-only
+class OrderLogReader {
+public:
+    OrderLogReader() = default;
+    ~OrderLogReader();
+
+    OrderLogReader(const OrderLogReader&) = delete;
+    OrderLogReader& operator=(const OrderLogReader&) = delete;
+
+    // False if missing or not an order log. A file cut short keeps its
+    // whole records.
+    bool open(const std::string& path);
+
+    std::span<const OrderLogRecord> records() const { return records_; }
+
+private:
+    void* map_ = nullptr;
+    size_t map_bytes_ = 0;
+    std::span<const OrderLogRecord> records_;
+};
+
+} // namespace ob
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "types.h"
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace ob {
+
+// Text output staged in one large block in front of an ostream. Each
+// put is a few stores; the stream only sees a write() per full block.
+class OutputBuffer {
+public:
+    explicit OutputBuffer(std::ostream& os, size_t capacity = 1 << 20)
+        : os_(os), buf_(capacity) {}
+
+    ~OutputBuffer() { flush(); }
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    void put(std::string_view s) {
+        if (len_ + s.size() > buf_.size()) {
+            flush();
+            if (s.size() > buf_.size()) {
+                os_.write(s.data(), static_cast<std::streamsize>(s.size()));
+                return;
+            }
+        }
+        std::memcpy(buf_.data() + len_, s.data(), s.size());
+        len_ += s.size();
+    }
+
+    void put(char c) {
+        if (len_ == buf_.size()) flush();
+        buf_[len_++] = c;
+    }
+
+    void put_uint(uint64_t v) {
+        char digits[20];
+        auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), v);
+        put(std::string_view(digits, static_cast<size_t>(end - digits)));
+    }
+
+    // Same text as price_to_string()
+    void put_price(Price p) {
+        char text[32];
+        char* out = text;
+        Price whole = p / PRICE_SCALE;
+        Price frac = p % PRICE_SCALE;
+        if (frac < 0) frac = -frac;
+        out = std::to_chars(out, text + sizeof(text), whole).ptr;
+        *out++ = '.';
+        for (Price scale = PRICE_SCALE / 10; scale > 0; scale /= 10) {
+            *out++ = static_cast<char>('0' + (frac / scale) % 10);
+        }
+        put(std::string_view(text, static_cast<size_t>(out - text)));
+    }
+
+    void flush() {
+        if (len_ > 0) {
+            os_.write(buf_.data(), static_cast<std::streamsize>(len_));
+            len_ = 0;
+        }
+    }
+
+    // The underlying stream, for output that formats itself (flushed
+    // first so ordering holds)
+    std::ostream& stream() {
+        flush();
+        return os_;
+    }
+
+private:
+    std::ostream& os_;
+    std::vector<char> buf_;
+    size_t len_ = 0;
+};
+
+} // namespace ob
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ob {
+
+enum class PageSize : uint8_t {
+    NORMAL,     // the base page size (4 KB on x86)
+    HUGE_2MB,
+    HUGE_1GB,
+};
+
+// An anonymous private mapping, prefaulted when it is created so nothing
+// in it takes a first-touch fault later.
+//
+// Huge pages come from the hugetlb pool (vm.nr_hugepages, or
+// hugepages=N on the kernel command line for 1 GB ones). If that pool
+// can't supply the mapping it falls back to ordinary pages marked for
+// transparent huge pages and aligned so the kernel can back them with
+// 2 MB pages; huge() says which one happened.
+//
+// Hugetlb mappings are copy-on-write across fork() like any other, so a
+// parent writing to one while a snapshot child runs needs spare huge
+// pages for the copies.
+//
+// Given a NUMA node, the range is bound to it (preferred, so a full node
+// still yields memory elsewhere) before it is faulted in, whichever
+// thread does the mapping.
+class PageMemory {
+public:
+    // Throws std::bad_alloc if nothing can be mapped, std::runtime_error
+    // if lock was asked for and mlock fails (usually RLIMIT_MEMLOCK).
+    // numa_node < 0 leaves placement to the kernel's first-touch policy.
+    PageMemory(size_t bytes, PageSize pages, bool lock = false, int numa_node = -1);
+    ~PageMemory();
+
+    PageMemory(PageMemory&& other) noexcept;
+    PageMemory& operator=(PageMemory&& other) noexcept;
+    PageMemory(const PageMemory&) = delete;
+    PageMemory& operator=(const PageMemory&) = delete;
+
+    char* data() const { return data_; }
+    // The request rounded up to whole pages
+    size_t size() const { return size_; }
+    bool huge() const { return huge_; }
+    bool locked() const { return locked_; }
+
+    static size_t page_bytes(PageSize pages);
+
+private:
+    void release();
+
+    char* data_ = nullptr;
+    size_t size_ = 0;
+    void* map_base_ = nullptr;   // what munmap gets back
+    size_t map_size_ = 0;
+    bool huge_ = false;
+    bool locked_ = false;
+};
+
+} // namespace ob
@@ -1,47 +1,73 @@
 #pragma once
 
 #include "order.h"
-#include <deque>
-#include <algorithm>
+#include <cstddef>
+#include <utility>
 
 namespace ob {
 
 // All orders resting at a single price point, in FIFO (time-priority) order.
-// Uses std::deque for cache-friendlier iteration than std::list.
+// Intrusive doubly-linked list through Order::prev/next: append, pop_front
+// and cancel-from-anywhere are all O(1) and never allocate.
 class PriceLevel {
 public:
+    PriceLevel() = default;
+
+    // Moving transfers the whole queue; the source is left empty
+    PriceLevel(PriceLevel&& other) noexcept
+        : head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)),
+          count_(std::exchange(other.count_, 0)),
+          total_qty_(std::exchange(other.total_qty_, 0)) {}
+
+    PriceLevel& operator=(PriceLevel&& other) noexcept {
+        head_ = std::exchange(other.head_, nullptr);
+        tail_ = std::exchange(other.tail_, nullptr);
+        count_ = std::exchange(other.count_, 0);
+        total_qty_ = std::exchange(other.total_qty_, 0);
+        return *this;
+    }
+
+    // Orders link into exactly one level, so copies would alias
+    PriceLevel(const PriceLevel&) = delete;
+    PriceLevel& operator=(const PriceLevel&) = delete;
+
     void add(Order* order) {
-        orders_.push_back(order);
+        order->prev = tail_;
+        order->next = nullptr;
+        if (tail_) {
+            tail_->next = order;
+        } else {
+            head_ = order;
+        }
+        tail_ = order;
+        ++count_;
         total_qty_ += order->remaining();
     }
 
     Order* front() const {
-        return orders_.front();
+        return head_;
     }
 
     void pop_front() {
-        if (!orders_.empty()) {
-            total_qty_ -= orders_.front()->remaining();
-            orders_.pop_front();
+        if (head_) {
+            total_qty_ -= head_->remaining();
+            unlink(head_);
         }
     }
 
-    // Remove a specific order (for cancellation). O(n) but cancels are less frequent.
-    bool remove(Order* order) {
-        auto it = std::find(orders_.begin(), orders_.end(), order);
-        if (it != orders_.end()) {
-            total_qty_ -= (*it)->remaining();
-            orders_.erase(it);
-            return true;
-        }
-        return false;
+    // Remove a specific order (for cancellation). O(1).
+    // Precondition: order is resting in this level.
+    void remove(Order* order) {
+        total_qty_ -= order->remaining();
+        unlink(order);
     }
 
-    bool is_empty() const { return orders_.empty(); }
+    bool is_empty() const { return head_ == nullptr; }
 
     Quantity total_quantity() const { return total_qty_; }
 
-    size_t order_count() const { return orders_.size(); }
+    size_t order_count() const { return count_; }
 
     // Update cached quantity after a partial fill on the front order
     void reduce_quantity(Quantity qty) {
@@ -49,8 +75,26 @@ public:
     }
 
 private:
-    std::deque<Order*> orders_;
+    Order* head_ = nullptr;
+    Order* tail_ = nullptr;
+    size_t count_ = 0;
     Quantity total_qty_ = 0;
+
+    void unlink(Order* order) {
+        if (order->prev) {
+            order->prev->next = order->next;
+        } else {
+            head_ = order->next;
+        }
+        if (order->next) {
+            order->next->prev = order->prev;
+        } else {
+            tail_ = order->prev;
+        }
+        order->prev = nullptr;
+        order->next = nullptr;
+        --count_;
+    }
 };
 
 } // namespace ob
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "types.h"
+#include "trade.h"
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -11,9 +13,31 @@ namespace ob {
 enum class MsgType : uint8_t {
     NEW_ORDER = 1,
     CANCEL    = 2,
+    AMEND     = 3,
+    SESSION   = 4,
     ACK       = 10,
     FILL      = 11,
     REJECT    = 12,
+    LEVEL_FILL = 13,
+};
+
+// SESSION options (OrderMessage::flags). A SESSION request is only taken
+// as the first message on a connection and is answered by an ACK with
+// order_id 0; anywhere else it is rejected like an unknown type.
+struct SessionFlags {
+    enum : uint8_t {
+        // A NEW_ORDER or AMEND's ACK carries its fill summary (quantity:
+        // total filled, match_id: fills, price: last fill price), and its
+        // fills at one price come as a single LEVEL_FILL instead of a
+        // FILL per resting order
+        AGGREGATE_FILLS = 1 << 0,
+        // With AGGREGATE_FILLS: still send the per-counterparty FILLs,
+        // each behind the LEVEL_FILL it adds up to
+        FILL_DETAIL     = 1 << 1,
+        // TCP only: responses come in frames, a FrameHeader followed by
+        // its messages, rather than as a bare message stream
+        FRAMED          = 1 << 2,
+    };
 };
 
 // Client → Server: 32 bytes
@@ -21,25 +45,89 @@ struct OrderMessage {
     uint8_t  msg_type;      // MsgType
     uint8_t  side;          // Side enum
     uint8_t  order_type;    // OrderType enum
-    uint8_t  padding[5];
-    uint64_t order_id;      // For CANCEL: id to cancel. For NEW_ORDER: ignored (server assigns)
-    int64_t  price;         // Fixed-point
-    uint32_t quantity;
+    uint8_t  flags;         // For SESSION: SessionFlags
+    uint8_t  padding[2];
+    uint16_t symbol_id;     // Instrument; order ids are unique per symbol
+    uint64_t order_id;      // For CANCEL/AMEND: the resting order. For NEW_ORDER: ignored (server assigns)
+    int64_t  price;         // Fixed-point. For AMEND: the new price
+    uint32_t quantity;      // For AMEND: new total size, filled part included
     uint32_t reserved;
 };
 static_assert(sizeof(OrderMessage) == 32, "OrderMessage must be 32 bytes");
 
 // Server → Client: 32 bytes
 struct ResponseMessage {
-    uint8_t  msg_type;      // MsgType: ACK, FILL, REJECT
-    uint8_t  padding[3];
-    uint32_t quantity;      // For FILL: fill qty
+    uint8_t  msg_type;      // MsgType: ACK, FILL, REJECT, LEVEL_FILL
+    uint8_t  padding;
+    uint16_t symbol_id;     // Echoes the request's symbol
+    uint32_t quantity;      // For FILL: fill qty. For LEVEL_FILL: qty filled at price
     uint64_t order_id;      // The order this response refers to
-    int64_t  price;         // For FILL: fill price
-    uint64_t match_id;      // For FILL: counterparty order id
+    int64_t  price;         // For FILL/LEVEL_FILL: fill price
+    uint64_t match_id;      // For FILL: counterparty order id. For LEVEL_FILL: fills
 };
 static_assert(sizeof(ResponseMessage) == 32, "ResponseMessage must be 32 bytes");
 
+// Server → Client on FRAMED sessions: precedes each run of responses
+struct FrameHeader {
+    uint32_t length;        // Bytes of messages after the header
+    uint32_t count;         // Messages in the frame
+};
+static_assert(sizeof(FrameHeader) == 8, "FrameHeader must be 8 bytes");
+
+// Largest frame the server sends, so a client can size its buffer
+constexpr size_t MAX_FRAME_MESSAGES = 1024;
+constexpr size_t MAX_FRAME_BYTES = sizeof(FrameHeader) + MAX_FRAME_MESSAGES * sizeof(ResponseMessage);
+
+// SESSION request: send first on a connection to pick its options
+inline OrderMessage make_session_request(uint8_t flags) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::SESSION);
+    m.flags = flags;
+    return m;
+}
+
+// Response builders shared by every transport
+
+inline ResponseMessage make_ack(SymbolId symbol, OrderId order_id) {
+    ResponseMessage r{};
+    r.msg_type = static_cast<uint8_t>(MsgType::ACK);
+    r.symbol_id = symbol;
+    r.order_id = order_id;
+    return r;
+}
+
+inline ResponseMessage make_reject(SymbolId symbol, OrderId order_id) {
+    ResponseMessage r{};
+    r.msg_type = static_cast<uint8_t>(MsgType::REJECT);
+    r.symbol_id = symbol;
+    r.order_id = order_id;
+    return r;
+}
+
+// FILL for order_id (on the given side) from one trade; match_id is the counterparty
+inline ResponseMessage make_fill(SymbolId symbol, OrderId order_id, Side side, const Trade& trade) {
+    ResponseMessage r{};
+    r.msg_type = static_cast<uint8_t>(MsgType::FILL);
+    r.symbol_id = symbol;
+    r.order_id = order_id;
+    r.price = trade.price;
+    r.quantity = trade.quantity;
+    r.match_id = (side == Side::BUY) ? trade.seller_order_id : trade.buyer_order_id;
+    return r;
+}
+
+// LEVEL_FILL for order_id opened by its first trade at that price
+inline ResponseMessage make_level_fill(SymbolId symbol, OrderId order_id, const Trade& trade) {
+    ResponseMessage r{};
+    r.msg_type = static_cast<uint8_t>(MsgType::LEVEL_FILL);
+    r.symbol_id = symbol;
+    r.order_id = order_id;
+    r.price = trade.price;
+    r.quantity = trade.quantity;
+    r.match_id = 1;
+    return r;
+}
+
 // Serialize/deserialize via memcpy (trivially copyable structs)
 inline void serialize(const OrderMessage& msg, char* buf) {
     std::memcpy(buf, &msg, sizeof(msg));
@@ -57,4 +145,35 @@ inline void deserialize(const char* buf, ResponseMessage& msg) {
     std::memcpy(&msg, buf, sizeof(msg));
 }
 
+// Client side: hand every complete response in data to on_response and
+// return the bytes consumed; keep the rest for the next read. A framed
+// stream is consumed a whole frame at a time. Returns SIZE_MAX on a
+// frame header no server sends (the stream is out of step).
+template <typename F>
+size_t decode_responses(const char* data, size_t len, bool framed, F&& on_response) {
+    constexpr size_t MSG_SIZE = sizeof(ResponseMessage);
+    size_t used = 0;
+    ResponseMessage msg;
+    if (!framed) {
+        for (; len - used >= MSG_SIZE; used += MSG_SIZE) {
+            deserialize(data + used, msg);
+            on_response(msg);
+        }
+        return used;
+    }
+    while (len - used >= sizeof(FrameHeader)) {
+        FrameHeader h;
+        std::memcpy(&h, data + used, sizeof(h));
+        if (h.count > MAX_FRAME_MESSAGES || h.length != h.count * MSG_SIZE) return SIZE_MAX;
+        if (len - used < sizeof(h) + h.length) break;
+        const char* p = data + used + sizeof(h);
+        for (uint32_t i = 0; i < h.count; ++i, p += MSG_SIZE) {
+            deserialize(p, msg);
+            on_response(msg);
+        }
+        used += sizeof(h) + h.length;
+    }
+    return used;
+}
+
 } // namespace ob
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "protocol.h"
+#include "spsc_ring.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ob {
+
+// Shared-memory transport for clients on the same host as the server.
+//
+// The server creates one POSIX shared memory segment (/dev/shm/<name>)
+// holding a fixed number of client slots. A client claims a free slot and
+// then talks to the server through that slot's two SPSC rings, carrying
+// the same OrderMessage / ResponseMessage structs as the TCP protocol with
+// the same ordering guarantees. A round trip is a few cache-line
+// transfers instead of two passes through the loopback stack.
+//
+// Either side can spin on the rings or sleep on a futex (ShmWait). Every
+// push rings a doorbell; ringing costs a system call only when the other
+// side has said it is asleep, so a spinning peer pays nothing for it.
+
+enum class ShmWait : uint8_t {
+    SPIN,    // poll the rings; lowest latency, burns the core
+    FUTEX,   // sleep until the peer rings
+};
+
+constexpr size_t SHM_REQUEST_CAPACITY = 1024;
+constexpr size_t SHM_RESPONSE_CAPACITY = 4096;   // a request can produce several responses
+
+// Wakeup word for one direction: an event count. The consumer reads seq,
+// announces it is waiting, checks once more for work and sleeps on seq;
+// the producer bumps seq after publishing and wakes only if someone waits.
+// Lives in shared memory, so the futex is a process-shared one.
+struct ShmDoorbell {
+    std::atomic<uint32_t> seq{0};
+    std::atomic<uint32_t> waiting{0};
+
+    void ring();
+
+    // Sleep until the next ring() or timeout_us (< 0: no timeout), unless
+    // ready() already holds. May return early.
+    template <typename Ready>
+    void wait(Ready&& ready, int64_t timeout_us) {
+        uint32_t s = seq.load();
+        waiting.store(1);
+        if (!ready()) sleep(s, timeout_us);
+        waiting.store(0);
+    }
+
+private:
+    void sleep(uint32_t seen, int64_t timeout_us);
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+              std::atomic<size_t>::is_always_lock_free,
+    "Shared-memory atomics must be address-free");
+
+// One client's channel
+struct alignas(CACHE_LINE_SIZE) ShmSlot {
+    enum : uint32_t {
+        FREE,       // claimable
+        CLAIMED,    // a client is filling in pid
+        ATTACHED,   // in use
+        CLOSING,    // client left; the server resets the slot
+        EVICTED,    // the server dropped the client (backlog over limit)
+    };
+
+    std::atomic<uint32_t> state{FREE};
+    int32_t pid = 0;
+    ShmDoorbell response_bell;   // server -> client
+
+    SpscRing<OrderMessage, SHM_REQUEST_CAPACITY> requests;      // client -> server
+    SpscRing<ResponseMessage, SHM_RESPONSE_CAPACITY> responses; // server -> client
+};
+
+struct alignas(CACHE_LINE_SIZE) ShmSegment {
+    static constexpr uint32_t MAGIC = 0x4f425348;   // "OBSH"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slot_count;
+    std::atomic<uint32_t> server_alive{1};
+
+    // Client -> server, shared by every slot
+    alignas(CACHE_LINE_SIZE) ShmDoorbell request_bell;
+
+    ShmSlot* slots() { return reinterpret_cast<ShmSlot*>(this + 1); }
+
+    static size_t bytes(size_t slot_count) {
+        return sizeof(ShmSegment) + slot_count * sizeof(ShmSlot);
+    }
+};
+
+// A mapped shared memory object: created (and unlinked again when
+// destroyed) by the server, opened by clients
+class ShmMapping {
+public:
+    // Throw std::runtime_error on failure
+    static ShmMapping create(const std::string& name, size_t bytes);
+    static ShmMapping open(const std::string& name);
+
+    ShmMapping(ShmMapping&& other) noexcept;
+    ShmMapping& operator=(ShmMapping&& other) noexcept;
+    ShmMapping(const ShmMapping&) = delete;
+    ShmMapping& operator=(const ShmMapping&) = delete;
+    ~ShmMapping();
+
+    void* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    ShmMapping() = default;
+    void release();
+
+    void* data_ = nullptr;
+    size_t size_ = 0;
+    std::string unlink_name_;   // set for the creator
+};
+
+// Server end: owns the segment and turns each attached slot into a
+// session for the EngineRouter. Driven by the server's I/O thread.
+class ShmServer {
+public:
+    // Throws std::runtime_error if the segment can't be created
+    ShmServer(const std::string& name, size_t slots, ShmWait wait);
+    ~ShmServer();
+
+    ShmServer(const ShmServer&) = delete;
+    ShmServer& operator=(const ShmServer&) = delete;
+
+    // Sessions of shared-memory clients carry this bit, which no socket
+    // fd reaches
+    static constexpr uint64_t SESSION_FLAG = uint64_t{1} << 31;
+    static bool owns(uint64_t session) { return session & SESSION_FLAG; }
+
+    // In FUTEX mode, readable whenever a client rang while the server
+    // thread was not looking; watch it in the event loop and drain it.
+    // -1 in SPIN mode.
+    int notify_fd() const { return notify_[0]; }
+    void drain_notify();
+
+    // Whether the caller should poll() in a tight loop
+    bool spinning() const { return wait_ == ShmWait::SPIN && attached_ > 0; }
+
+    // Take attaches and detaches, then hand every queued request to
+    // on_request(session, msg, session_flags); returns how many. A
+    // client's SESSION request, if it is the first, is answered here
+    // (FRAMED has no meaning on the rings and is dropped).
+    template <typename F>
+    size_t poll(F&& on_request);
+
+    // Queue a response for session; false if the client is gone
+    bool send(uint64_t session, const ResponseMessage& msg);
+
+    // Push whatever send() could not fit and ring the clients' doorbells
+    void flush();
+
+    size_t attached() const { return attached_; }
+
+private:
+    static constexpr size_t MAX_BACKLOG = 1 << 16;   // responses per client
+    static constexpr uint32_t LIVENESS_POLLS = 4096;
+
+    struct Channel {
+        uint64_t session = 0;   // 0: slot not attached
+        std::vector<ResponseMessage> backlog;
+        bool dirty = false;
+        uint8_t session_flags = 0;
+        bool first_message = true;
+    };
+
+    ShmMapping mapping_;
+    ShmSegment* segment_;
+    ShmWait wait_;
+    std::vector<Channel> channels_;   // by slot
+    std::vector<uint32_t> dirty_;
+    size_t attached_ = 0;
+    uint64_t next_generation_ = 1;
+    uint32_t polls_ = 0;
+
+    int notify_[2] = {-1, -1};   // socketpair: watcher -> I/O thread
+    std::atomic<bool> stop_{false};
+    std::unique_ptr<std::thread> watcher_;   // FUTEX mode only
+
+    void check_slots();
+    void reset_slot(uint32_t index);
+    void watch();
+};
+
+template <typename F>
+size_t ShmServer::poll(F&& on_request) {
+    check_slots();
+    size_t total = 0;
+    OrderMessage batch[64];
+    for (uint32_t i = 0; i < channels_.size(); ++i) {
+        Channel& ch = channels_[i];
+        if (ch.session == 0) continue;
+        ShmSlot& slot = segment_->slots()[i];
+        size_t n = slot.requests.pop_bulk(batch, std::size(batch));
+        for (size_t k = 0; k < n; ++k) {
+            const OrderMessage& msg = batch[k];
+            if (ch.first_message) {
+                ch.first_message = false;
+                if (msg.msg_type == static_cast<uint8_t>(MsgType::SESSION)) {
+                    ch.session_flags = msg.flags & ~SessionFlags::FRAMED;
+                    send(ch.session, make_ack(msg.symbol_id, 0));
+                    continue;
+                }
+            }
+            on_request(ch.session, msg, ch.session_flags);
+        }
+        total += n;
+    }
+    return total;
+}
+
+} // namespace ob
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "matching_engine.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace ob {
+
+// Binary book snapshot. Everything is 8-byte aligned so a mapped file can
+// be read in place:
+//
+//   SnapshotHeader
+//   per engine: SnapshotEngine, then level_count x
+//               (SnapshotLevel, OrderRecord[order_count])
+//
+// Levels are bids best-first then asks best-first; orders within a level
+// are in FIFO order, both halves of each in one 64-byte OrderRecord.
+struct SnapshotHeader {
+    char     magic[8];        // "OBSNAP01"
+    uint64_t journal_seq;     // last journal record reflected in the books
+    uint64_t body_bytes;
+    uint32_t engine_count;
+    uint32_t body_crc;
+};
+static_assert(sizeof(SnapshotHeader) == 32);
+
+struct SnapshotEngine {
+    SymbolId  symbol;
+    uint16_t  reserved;
+    uint32_t  level_count;
+    OrderId   next_order_id;
+    Timestamp next_timestamp;
+    uint64_t  trade_count;
+    uint64_t  orders_processed;
+};
+static_assert(sizeof(SnapshotEngine) == 40);
+
+struct SnapshotLevel {
+    Price    price;
+    uint32_t order_count;
+    uint8_t  side;
+    uint8_t  reserved[3];
+};
+static_assert(sizeof(SnapshotLevel) == 16);
+
+// Streams a snapshot to <path>.tmp and renames it over path once complete
+// and synced, so a crash mid-write never leaves a truncated snapshot
+// under the real name.
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(std::string path);
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    bool ok() const { return !failed_; }
+
+    template <typename Book, typename Pool, typename Instrument>
+    void add_engine(SymbolId symbol, const BasicMatchingEngine<Book, Pool, Instrument>& engine);
+
+    // Write the header, fsync and move into place
+    bool finish(uint64_t journal_seq);
+
+private:
+    std::string path_;
+    std::string tmp_path_;
+    int fd_ = -1;
+    std::vector<char> buf_;
+    uint64_t body_bytes_ = 0;
+    uint32_t crc_ = 0;
+    uint32_t engines_ = 0;
+    bool failed_ = false;
+    bool finished_ = false;
+
+    void write(const void* data, size_t len);
+    void flush_buffer();
+};
+
+// Maps a snapshot read-only and checks it before anything is loaded
+class SnapshotReader {
+public:
+    SnapshotReader() = default;
+    ~SnapshotReader();
+
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    // False if missing, truncated or failing its checksum
+    bool open(const std::string& path);
+
+    uint64_t journal_seq() const { return header().journal_seq; }
+    size_t engine_count() const { return header().engine_count; }
+
+    // Rebuild each engine into *engine_for(symbol), which must be empty.
+    // False if the body is malformed (engines loaded so far stay loaded).
+    template <typename EngineFor>
+    bool load(EngineFor&& engine_for) const;
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+
+    const SnapshotHeader& header() const {
+        return *reinterpret_cast<const SnapshotHeader*>(data_);
+    }
+};
+
+template <typename Book, typename Pool, typename Instrument>
+void SnapshotWriter::add_engine(SymbolId symbol,
+                                const BasicMatchingEngine<Book, Pool, Instrument>& engine) {
+    const Book& book = engine.book();
+
+    SnapshotEngine e{};
+    e.symbol = symbol;
+    e.level_count = static_cast<uint32_t>(book.bid_level_count() + book.ask_level_count());
+    e.next_order_id = engine.next_order_id();
+    e.next_timestamp = engine.next_timestamp();
+    e.trade_count = engine.trade_count();
+    e.orders_processed = engine.orders_processed();
+    write(&e, sizeof(e));
+
+    auto write_level = [&](Side side, Price price, const PriceLevel& level) {
+        SnapshotLevel l{};
+        l.price = price;
+        l.order_count = static_cast<uint32_t>(level.order_count());
+        l.side = static_cast<uint8_t>(side);
+        write(&l, sizeof(l));
+        for (const Order* o = level.front(); o; o = o->next) {
+            OrderRecord record = OrderRecord::of(*o);
+            write(&record, sizeof(record));
+        }
+    };
+    book.bids().for_each([&](Price p, const PriceLevel& l) { write_level(Side::BUY, p, l); });
+    book.asks().for_each([&](Price p, const PriceLevel& l) { write_level(Side::SELL, p, l); });
+    ++engines_;
+}
+
+template <typename EngineFor>
+bool SnapshotReader::load(EngineFor&& engine_for) const {
+    const char* p = data_ + sizeof(SnapshotHeader);
+    const char* end = data_ + size_;
+
+    for (uint32_t i = 0; i < header().engine_count; ++i) {
+        if (end - p < static_cast<ptrdiff_t>(sizeof(SnapshotEngine))) return false;
+        SnapshotEngine e;
+        std::memcpy(&e, p, sizeof(e));
+        p += sizeof(e);
+
+        auto& engine = *engine_for(e.symbol);
+        engine.restore_counters(e.next_order_id, e.next_timestamp, e.trade_count,
+                                e.orders_processed);
+
+        for (uint32_t l = 0; l < e.level_count; ++l) {
+            if (end - p < static_cast<ptrdiff_t>(sizeof(SnapshotLevel))) return false;
+            SnapshotLevel level;
+            std::memcpy(&level, p, sizeof(level));
+            p += sizeof(level);
+
+            size_t bytes = static_cast<size_t>(level.order_count) * sizeof(OrderRecord);
+            if (static_cast<size_t>(end - p) < bytes) return false;
+            engine.restore_level(static_cast<Side>(level.side),
+                                 std::span<const OrderRecord>(reinterpret_cast<const OrderRecord*>(p),
+                                                              level.order_count));
+            p += bytes;
+        }
+    }
+    return true;
+}
+
+} // namespace ob
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace ob {
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+// Bounded lock-free single-producer/single-consumer ring.
+// Producer and consumer indices live on separate cache lines, and each
+// side keeps a cached copy of the other's index so the shared line is only
+// re-read when the ring looks full (producer) or empty (consumer).
+// Indices run freely and are masked, so Capacity must be a power of two.
+// Storage is inline, which also makes the ring placeable in shared memory.
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+        "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>,
+        "Ring elements are copied by value between threads");
+
+public:
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Producer side
+
+    bool try_push(const T& item) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == Capacity) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == Capacity) return false;
+        }
+        buffer_[tail & MASK] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Push up to n items with a single index publish; returns how many fit
+    size_t push_bulk(const T* items, size_t n) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t free = Capacity - (tail - cached_head_);
+        if (free < n) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = Capacity - (tail - cached_head_);
+        }
+        if (n > free) n = free;
+        for (size_t i = 0; i < n; ++i) {
+            buffer_[(tail + i) & MASK] = items[i];
+        }
+        if (n) tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    // Consumer side
+
+    bool try_pop(T& out) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) return false;
+        }
+        out = buffer_[head & MASK];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pop up to max items with a single index publish; returns how many
+    size_t pop_bulk(T* out, size_t max) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t avail = cached_tail_ - head;
+        if (avail < max) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            avail = cached_tail_ - head;
+        }
+        if (max > avail) max = avail;
+        for (size_t i = 0; i < max; ++i) {
+            out[i] = buffer_[(head + i) & MASK];
+        }
+        if (max) head_.store(head + max, std::memory_order_release);
+        return max;
+    }
+
+    // Either side; exact only when the other side is quiescent
+    size_t size_approx() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+    bool empty_approx() const { return size_approx() == 0; }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    // Consumer-owned line
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // Producer-owned line
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+
+    alignas(CACHE_LINE_SIZE) T buffer_[Capacity];
+};
+
+} // namespace ob
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "types.h"
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ob {
+
+// Interns instrument names into dense SymbolIds for the wire protocol.
+// Id 0 is the unnamed default symbol, so single-instrument clients that
+// leave symbol_id zeroed keep working.
+class SymbolTable {
+public:
+    SymbolTable() {
+        names_.emplace_back();
+        ids_.emplace(std::string{}, SymbolId{0});
+    }
+
+    std::optional<SymbolId> find(std::string_view name) const {
+        auto it = ids_.find(name);
+        if (it == ids_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    // Existing id for name, or the next free one
+    SymbolId intern(std::string_view name) {
+        if (auto id = find(name)) return *id;
+        if (names_.size() > std::numeric_limits<SymbolId>::max()) {
+            throw std::length_error("symbol table full");
+        }
+        SymbolId id = static_cast<SymbolId>(names_.size());
+        names_.emplace_back(name);
+        ids_.emplace(names_.back(), id);
+        return id;
+    }
+
+    const std::string& name(SymbolId id) const { return names_.at(id); }
+    size_t size() const { return names_.size(); }
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    };
+
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, SymbolId, Hash, std::equal_to<>> ids_;
+};
+
+} // namespace ob
@@ -1,48 +1,121 @@
 #pragma once
 
-#include "matching_engine.h"
+#include "engine_router.h"
+#include "event_loop.h"
 #include "protocol.h"
+#include "shm_transport.h"
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 #include <functional>
 
 namespace ob {
 
+struct ServerOptions {
+    // Event loop backend by name ("epoll", "io_uring", "kqueue"); empty
+    // for the platform default
+    std::string backend;
+    // Low-latency mode: poll the event loop with a zero timeout in a tight
+    // loop instead of sleeping in it, and ask the kernel to busy-poll each
+    // client socket's receive queue. Costs the I/O thread's whole core;
+    // pair it with core and RouterOptions::busy_poll.
+    bool busy_poll = false;
+    // Pin the I/O thread to this core; -1 leaves it unpinned. Client
+    // sockets are tagged with it (SO_INCOMING_CPU).
+    int core = -1;
+    // SO_BUSY_POLL on each client socket in busy-poll mode, in
+    // microseconds; 0 leaves the system default (net.core.busy_read).
+    // Raising it above that default needs CAP_NET_ADMIN.
+    int socket_busy_poll_us = 50;
+    // Shared-memory transport for clients on this host (ShmClient): the
+    // segment name, e.g. "/ob-9000"; off when empty
+    std::string shm_name;
+    size_t shm_slots = 16;
+    // How the I/O thread learns of shared-memory requests: SPIN polls the
+    // rings on every loop pass while a client is attached, FUTEX lets a
+    // watcher thread wake the event loop
+    ShmWait shm_wait = ShmWait::SPIN;
+};
+
+// Network I/O thread of the order pipeline: decodes OrderMessages off the
+// sockets (and any shared-memory clients' rings) into the router's request
+// rings and writes the responses the shard threads push back. Matching never runs on this thread, so a slow
+// client only delays its own responses.
+//
+// Socket readiness/completion comes from an EventLoop backend picked by
+// name (ServerOptions::backend).
 class TcpServer {
 public:
-    TcpServer(uint16_t port, MatchingEngine& engine);
+    TcpServer(uint16_t port, EngineRouter& router, ServerOptions options = {});
     ~TcpServer();
 
     // Run the event loop (blocks until shutdown)
     void run();
 
-    // Signal the server to stop
+    // Signal the server to stop; safe from any thread
     void shutdown();
 
 private:
     uint16_t port_;
-    MatchingEngine& engine_;
+    EngineRouter& router_;
+    ServerOptions options_;
+    std::unique_ptr<EventLoop> loop_;
+    std::unique_ptr<ShmServer> shm_;
     int listen_fd_ = -1;
-    int kqueue_fd_ = -1;
-    bool running_ = false;
+    std::atomic<bool> running_{false};
+    bool busy_poll_warned_ = false;
+
+    static constexpr size_t RECV_BUFFER_SIZE = 64 * 1024;
+    static constexpr size_t MAX_SEND_BACKLOG = 4 * 1024 * 1024;
 
-    // Per-client read buffer (handles partial reads)
     struct ClientState {
-        int fd;
-        char read_buf[sizeof(OrderMessage)];
-        size_t bytes_read = 0;
+        int fd = -1;          // -1: slot unused
+        uint64_t session = 0; // generation << 32 | fd: responses to a closed fd are dropped
+
+        // Receive buffer: filled by large reads, decoded in place; only a
+        // trailing partial message is kept between reads
+        std::unique_ptr<char[]> recv_buf;
+        size_t recv_len = 0;
+
+        // Responses coalesced since the last flush; send_off is how much
+        // of send_buf the kernel has already taken
+        std::vector<char> send_buf;
+        size_t send_off = 0;
+        bool send_dirty = false;      // on dirty_
+        bool want_writable = false;   // waiting for the socket to drain
+
+        // SESSION options, taken from the connection's first message
+        uint8_t session_flags = 0;
+        bool first_message = true;
+        // FRAMED: the frame in send_buf still taking messages; closed as
+        // soon as any of send_buf is handed to the kernel
+        bool frame_open = false;
+        size_t frame_at = 0;
+        uint32_t frame_count = 0;
     };
 
-    std::vector<ClientState> clients_;
+    std::vector<ClientState> clients_;   // by fd
+    std::vector<int> dirty_;             // clients with unsent responses
+    uint64_t next_generation_ = 1;
+    std::vector<RoutedResponse> responses_;
 
     void setup_listener();
-    void accept_client();
-    void handle_client_data(int client_fd);
+    void accept_clients();
+    void handle_event(const IoEvent& event);
+    void handle_client_data(ClientState& client);
+    void consume(ClientState& client, const char* data, size_t len);
+    size_t decode(ClientState& client, const char* data, size_t len);
     void remove_client(int client_fd);
-    void process_message(int client_fd, const OrderMessage& msg);
-    void send_response(int client_fd, const ResponseMessage& resp);
+    ClientState* find_client(int fd);
+    bool open_session(ClientState& client, const OrderMessage& msg);
+    void submit(uint64_t session, const OrderMessage& msg, uint8_t session_flags);
+    void queue_response(ClientState& client, const ResponseMessage& msg);
+    void flush_responses();
+    void flush_client(ClientState& client);
     void set_nonblocking(int fd);
+    void tune_client(int fd);
 };
 
 } // namespace ob
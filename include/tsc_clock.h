@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace ob {
+
+// Cycle-counter timer for timing sub-microsecond work, where a
+// steady_clock read costs as much as what it measures. Reads the TSC on
+// x86 and the virtual counter (cntvct_el0) on ARM64; elsewhere it falls
+// back to steady_clock nanoseconds.
+//
+// now() is a bare read that the CPU may reorder around neighbouring
+// instructions. begin()/end() fence the read so the interval contains
+// exactly the code between them, at the price of a few dozen cycles.
+//
+// Ticks are converted with a rate measured against steady_clock at
+// construction, so the counter must be invariant (constant rate, synced
+// across cores), as it is on every x86 of the last decade and all ARM64.
+class TscClock {
+public:
+    explicit TscClock(std::chrono::nanoseconds window = std::chrono::milliseconds(20)) {
+        calibrate(window);
+    }
+
+    static uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t v;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+        return v;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // Serialized start: earlier instructions finish before the read and
+    // later ones don't start until it's done
+    static uint64_t begin() {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_lfence();
+        uint64_t t = __rdtsc();
+        _mm_lfence();
+        return t;
+#elif defined(__aarch64__)
+        asm volatile("isb" ::: "memory");
+        uint64_t t = now();
+        asm volatile("isb" ::: "memory");
+        return t;
+#else
+        return now();
+#endif
+    }
+
+    // Serialized stop: the read waits for the measured code to finish
+    static uint64_t end() {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned aux;
+        uint64_t t = __rdtscp(&aux);
+        _mm_lfence();
+        return t;
+#elif defined(__aarch64__)
+        asm volatile("isb" ::: "memory");
+        return now();
+#else
+        return now();
+#endif
+    }
+
+    double ns_per_tick() const { return ns_per_tick_; }
+    double to_ns(uint64_t ticks) const { return static_cast<double>(ticks) * ns_per_tick_; }
+
+    // Smallest interval an empty bare / serialized pair reports, in ticks
+    uint64_t overhead_ticks() const { return overhead_; }
+    uint64_t serialized_overhead_ticks() const { return serialized_overhead_; }
+
+private:
+    double ns_per_tick_ = 1.0;
+    uint64_t overhead_ = 0;
+    uint64_t serialized_overhead_ = 0;
+
+    void calibrate(std::chrono::nanoseconds window) {
+        using Steady = std::chrono::steady_clock;
+        auto t0 = Steady::now();
+        uint64_t c0 = begin();
+        Steady::time_point t1;
+        do {
+            t1 = Steady::now();
+        } while (t1 - t0 < window);
+        uint64_t c1 = end();
+
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        if (c1 > c0) ns_per_tick_ = ns / static_cast<double>(c1 - c0);
+
+        overhead_ = serialized_overhead_ = UINT64_MAX;
+        for (int i = 0; i < 1000; ++i) {
+            uint64_t a = now();
+            uint64_t b = now();
+            overhead_ = std::min(overhead_, b - a);
+            a = begin();
+            b = end();
+            serialized_overhead_ = std::min(serialized_overhead_, b - a);
+        }
+    }
+};
+
+} // namespace ob
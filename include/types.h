@@ -1,7 +1,10 @@
 #pragma once
 
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace ob {
 
@@ -15,6 +18,51 @@ inline Price price_from_double(double p) {
     return static_cast<Price>(p * PRICE_SCALE + 0.5);
 }
 
+// Decimal digits PRICE_SCALE keeps
+constexpr size_t PRICE_DECIMALS = [] {
+    size_t digits = 0;
+    for (int scale = PRICE_SCALE; scale > 1; scale /= 10) ++digits;
+    return digits;
+}();
+
+// Parse decimal text ("150.25", "150", "-0.5") straight into ticks, with
+// no double in between. Digits past PRICE_DECIMALS round half away from
+// zero. False unless all of s is such a number.
+inline bool parse_price(std::string_view s, Price& out) {
+    bool negative = false;
+    if (!s.empty() && (s[0] == '-' || s[0] == '+')) {
+        negative = s[0] == '-';
+        s.remove_prefix(1);
+    }
+    size_t dot = s.find('.');
+    std::string_view whole = s.substr(0, dot);
+    std::string_view frac = dot == std::string_view::npos ? std::string_view{} : s.substr(dot + 1);
+    if (whole.empty() && frac.empty()) return false;
+
+    uint64_t units = 0;
+    if (!whole.empty()) {
+        auto [end, ec] = std::from_chars(whole.data(), whole.data() + whole.size(), units);
+        if (ec != std::errc{} || end != whole.data() + whole.size()) return false;
+    }
+
+    int64_t ticks = 0;
+    bool round_up = false;
+    for (size_t i = 0; i < frac.size(); ++i) {
+        char c = frac[i];
+        if (c < '0' || c > '9') return false;
+        if (i < PRICE_DECIMALS) {
+            ticks = ticks * 10 + (c - '0');
+        } else if (i == PRICE_DECIMALS) {
+            round_up = c >= '5';
+        }
+    }
+    for (size_t i = frac.size(); i < PRICE_DECIMALS; ++i) ticks *= 10;
+
+    Price value = static_cast<Price>(units) * PRICE_SCALE + ticks + (round_up ? 1 : 0);
+    out = negative ? -value : value;
+    return true;
+}
+
 inline double price_to_double(Price p) {
     return static_cast<double>(p) / PRICE_SCALE;
 }
@@ -33,6 +81,25 @@ enum class Side : uint8_t {
     SELL = 1
 };
 
+// Price priority within one side: bids rank higher prices first, asks lower.
+template <Side S>
+constexpr bool is_better_price(Price a, Price b) {
+    if constexpr (S == Side::BUY) return a > b;
+    else return a < b;
+}
+
+constexpr Side opposite(Side s) {
+    return s == Side::BUY ? Side::SELL : Side::BUY;
+}
+
+// Whether a limit order on side S at limit can trade at an opposite level
+// priced at level
+template <Side S>
+constexpr bool crosses(Price limit, Price level) {
+    if constexpr (S == Side::BUY) return level <= limit;
+    else return level >= limit;
+}
+
 enum class OrderType : uint8_t {
     LIMIT  = 0,
     MARKET = 1
@@ -41,5 +108,6 @@ enum class OrderType : uint8_t {
 using OrderId    = uint64_t;
 using Quantity   = uint32_t;
 using Timestamp  = uint64_t;
+using SymbolId   = uint16_t;
 
 } // namespace ob
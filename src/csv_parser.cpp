@@ -1,112 +1,412 @@
 #include "csv_parser.h"
-#include <sstream>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace ob {
 
-void CsvParser::process_line(const std::string& line, std::ostream& os) {
+namespace {
+
+constexpr size_t MAX_FIELDS = 8;   // more than any command uses
+
+std::string_view trim(std::string_view s) {
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == std::string_view::npos) return {};
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
+bool iequals(std::string_view s, std::string_view upper) {
+    if (s.size() != upper.size()) return false;
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(s[i])) != upper[i]) return false;
+    }
+    return true;
+}
+
+void put_upper(OutputBuffer& out, std::string_view s) {
+    for (char c : s) out.put(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+}
+
+// f(line) for each line of data, without its newline
+template <typename F>
+void for_each_line(std::string_view data, F&& f) {
+    const char* p = data.data();
+    const char* end = p + data.size();
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        const char* eol = nl ? nl : end;
+        f(std::string_view(p, static_cast<size_t>(eol - p)));
+        p = eol + 1;
+    }
+}
+
+template <typename T>
+bool parse_uint(std::string_view s, T& value) {
+    s = trim(s);
+    if (!s.empty() && s[0] == '+') s.remove_prefix(1);
+    auto [end, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+    return ec == std::errc{} && end == s.data() + s.size() && !s.empty();
+}
+
+} // namespace
+
+void CsvParser::process_line(std::string_view line, std::ostream& os) {
+    OutputBuffer out(os, 4096);
+    process_line(line, out);
+}
+
+void CsvParser::process_line(std::string_view line, OutputBuffer& out) {
+    execute(parse_line(line), out);
+}
+
+CsvCommand CsvParser::parse_line(std::string_view line) {
+    CsvCommand c;
+
     // Skip empty lines and comments
-    if (line.empty() || line[0] == '#') return;
+    if (line.empty() || line[0] == '#') return c;
+
+    std::string_view trimmed = trim(line);
+    if (trimmed.empty()) return c;
 
-    // Trim whitespace
-    std::string trimmed = line;
-    trimmed.erase(0, trimmed.find_first_not_of(" \t\r\n"));
-    trimmed.erase(trimmed.find_last_not_of(" \t\r\n") + 1);
-    if (trimmed.empty()) return;
+    auto fail = [&](CsvCommand::Error error, std::string_view arg = {}) {
+        c.kind = CsvCommand::ERROR;
+        c.error = error;
+        c.arg = arg;
+        return c;
+    };
 
-    // Split by comma
-    std::vector<std::string> tokens;
-    std::istringstream ss(trimmed);
-    std::string token;
-    while (std::getline(ss, token, ',')) {
-        tokens.push_back(token);
+    // Split by comma. Like getline, a trailing comma adds no empty field.
+    std::string_view tokens[MAX_FIELDS];
+    size_t count = 0;
+    size_t start = 0;
+    while (count < MAX_FIELDS) {
+        size_t comma = trimmed.find(',', start);
+        if (comma == std::string_view::npos) {
+            if (start < trimmed.size()) tokens[count++] = trimmed.substr(start);
+            break;
+        }
+        tokens[count++] = trimmed.substr(start, comma - start);
+        start = comma + 1;
     }
 
-    if (tokens.empty()) return;
+    std::string_view cmd = tokens[0];
 
-    std::string cmd = tokens[0];
-    std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::toupper);
+    // Optional symbol: 6th field, or 2nd for the PRINT,SYM shorthand
+    c.symbol = count > 5 ? tokens[5] : std::string_view{};
+    if (iequals(cmd, "PRINT")) {
+        if (c.symbol.empty() && count > 1) c.symbol = tokens[1];
+        c.kind = CsvCommand::PRINT;
+        return c;
+    }
 
-    if (cmd == "PRINT") {
-        engine_.book().print(os);
-        return;
+    if (iequals(cmd, "CANCEL")) {
+        if (count < 5) return fail(CsvCommand::CANCEL_NEEDS_ID);
+        if (!parse_uint(tokens[4], c.order_id)) return fail(CsvCommand::BAD_ORDER_ID, tokens[4]);
+        c.kind = CsvCommand::CANCEL;
+        return c;
+    }
+
+    if (iequals(cmd, "AMEND")) {
+        if (count < 5) return fail(CsvCommand::AMEND_FIELDS);
+        if (!parse_uint(tokens[4], c.order_id)) return fail(CsvCommand::BAD_ORDER_ID, tokens[4]);
+        if (tokens[2].empty()) return fail(CsvCommand::AMEND_FIELDS);
+        if (!parse_price(trim(tokens[2]), c.price)) return fail(CsvCommand::BAD_PRICE, tokens[2]);
+        // Zero is allowed: it cancels
+        if (!parse_uint(tokens[3], c.quantity)) return fail(CsvCommand::BAD_QUANTITY, tokens[3]);
+        c.kind = CsvCommand::AMEND;
+        return c;
+    }
+
+    // LIMIT or MARKET order
+    if (count < 4) return fail(CsvCommand::EXPECTED_FIELDS);
+
+    if (iequals(cmd, "LIMIT")) {
+        c.type = OrderType::LIMIT;
+    } else if (iequals(cmd, "MARKET")) {
+        c.type = OrderType::MARKET;
+    } else {
+        return fail(CsvCommand::UNKNOWN_COMMAND, cmd);
+    }
+
+    std::string_view side = tokens[1];
+    if (iequals(side, "BUY") || iequals(side, "B")) {
+        c.side = Side::BUY;
+    } else if (iequals(side, "SELL") || iequals(side, "S")) {
+        c.side = Side::SELL;
+    } else {
+        return fail(CsvCommand::UNKNOWN_SIDE, side);
     }
 
-    if (cmd == "CANCEL") {
-        if (tokens.size() < 5) {
-            os << "ERROR: CANCEL requires order_id as 5th field\n";
-            return;
+    if (c.type == OrderType::LIMIT) {
+        if (tokens[2].empty()) return fail(CsvCommand::PRICE_REQUIRED);
+        if (!parse_price(trim(tokens[2]), c.price)) return fail(CsvCommand::BAD_PRICE, tokens[2]);
+    }
+
+    if (!parse_uint(tokens[3], c.quantity)) return fail(CsvCommand::BAD_QUANTITY, tokens[3]);
+    if (c.quantity == 0) return fail(CsvCommand::ZERO_QUANTITY);
+
+    c.kind = CsvCommand::ORDER;
+    return c;
+}
+
+void CsvParser::execute(const CsvCommand& c, OutputBuffer& out) {
+    if (c.kind == CsvCommand::NONE) return;
+
+    std::string_view symbol = c.symbol;
+    MatchingEngine& engine = engine_for(symbol);
+    auto put_suffix = [&] {
+        if (!symbol.empty()) {
+            out.put(' ');
+            out.put(symbol);
         }
-        OrderId id = std::stoull(tokens[4]);
-        if (engine_.cancel_order(id)) {
-            os << "CANCELLED " << id << "\n";
+    };
+    auto put_quoted = [&](std::string_view prefix, std::string_view arg, bool upper) {
+        out.put(prefix);
+        out.put('\'');
+        if (upper) {
+            put_upper(out, arg);
         } else {
-            os << "CANCEL_REJECT " << id << " (not found)\n";
+            out.put(arg);
         }
-        return;
+        out.put("'\n");
+    };
+
+    switch (c.kind) {
+    case CsvCommand::PRINT:
+        engine.book().print(out.stream());
+        break;
+
+    case CsvCommand::CANCEL:
+        if (engine.cancel_order(c.order_id)) {
+            out.put("CANCELLED ");
+            out.put_uint(c.order_id);
+            put_suffix();
+            out.put('\n');
+        } else {
+            out.put("CANCEL_REJECT ");
+            out.put_uint(c.order_id);
+            put_suffix();
+            out.put(" (not found)\n");
+        }
+        break;
+
+    case CsvCommand::AMEND:
+        if (engine.book().has_order(c.order_id)) {
+            out.put("AMENDED ");
+            out.put_uint(c.order_id);
+            put_suffix();
+            out.put('\n');
+            engine.amend_order(c.order_id, c.price, c.quantity,
+                               [&](const Trade& t) { print_trade(t, symbol, out); });
+        } else {
+            out.put("AMEND_REJECT ");
+            out.put_uint(c.order_id);
+            put_suffix();
+            out.put(" (not found)\n");
+        }
+        break;
+
+    case CsvCommand::ORDER:
+        engine.process_order(c.side, c.type, c.price, c.quantity,
+                             [&](const Trade& t) { print_trade(t, symbol, out); });
+        break;
+
+    case CsvCommand::ERROR:
+        switch (c.error) {
+        case CsvCommand::CANCEL_NEEDS_ID:
+            out.put("ERROR: CANCEL requires order_id as 5th field\n");
+            break;
+        case CsvCommand::AMEND_FIELDS:
+            out.put("ERROR: AMEND requires a price and order_id as 5th field\n");
+            break;
+        case CsvCommand::BAD_ORDER_ID:
+            put_quoted("ERROR: bad order_id ", c.arg, false);
+            break;
+        case CsvCommand::EXPECTED_FIELDS:
+            out.put("ERROR: expected TYPE,SIDE,PRICE,QTY\n");
+            break;
+        case CsvCommand::UNKNOWN_COMMAND:
+            put_quoted("ERROR: unknown command ", c.arg, true);
+            break;
+        case CsvCommand::UNKNOWN_SIDE:
+            put_quoted("ERROR: unknown side ", c.arg, true);
+            break;
+        case CsvCommand::PRICE_REQUIRED:
+            out.put("ERROR: LIMIT order requires a price\n");
+            break;
+        case CsvCommand::BAD_PRICE:
+            put_quoted("ERROR: bad price ", c.arg, false);
+            break;
+        case CsvCommand::BAD_QUANTITY:
+            put_quoted("ERROR: bad quantity ", c.arg, false);
+            break;
+        case CsvCommand::ZERO_QUANTITY:
+            out.put("ERROR: quantity must be > 0\n");
+            break;
+        }
+        break;
+
+    case CsvCommand::NONE:
+        break;
     }
+}
 
-    // LIMIT or MARKET order
-    if (tokens.size() < 4) {
-        os << "ERROR: expected TYPE,SIDE,PRICE,QTY\n";
-        return;
+void CsvParser::process_stream(std::istream& is, std::ostream& os) {
+    OutputBuffer out(os);
+    std::string line;
+    while (std::getline(is, line)) {
+        process_line(line, out);
     }
+}
 
-    OrderType type;
-    if (cmd == "LIMIT") {
-        type = OrderType::LIMIT;
-    } else if (cmd == "MARKET") {
-        type = OrderType::MARKET;
-    } else {
-        os << "ERROR: unknown command '" << cmd << "'\n";
+void CsvParser::process_buffer(std::string_view data, OutputBuffer& out, size_t threads) {
+    if (threads > 1 && data.size() > PARALLEL_CHUNK_BYTES) {
+        process_parallel(data, out, threads);
         return;
     }
+    for_each_line(data, [&](std::string_view line) { process_line(line, out); });
+}
 
-    std::string side_str = tokens[1];
-    std::transform(side_str.begin(), side_str.end(), side_str.begin(), ::toupper);
-    Side side;
-    if (side_str == "BUY" || side_str == "B") {
-        side = Side::BUY;
-    } else if (side_str == "SELL" || side_str == "S") {
-        side = Side::SELL;
-    } else {
-        os << "ERROR: unknown side '" << side_str << "'\n";
-        return;
+void CsvParser::process_parallel(std::string_view data, OutputBuffer& out, size_t threads) {
+    // Chunks end on a newline, so no line straddles two parsers
+    std::vector<std::string_view> chunks;
+    for (size_t start = 0; start < data.size();) {
+        size_t end = std::min(start + PARALLEL_CHUNK_BYTES, data.size());
+        if (end < data.size()) {
+            size_t nl = data.find('\n', end);
+            end = nl == std::string_view::npos ? data.size() : nl + 1;
+        }
+        chunks.push_back(data.substr(start, end - start));
+        start = end;
     }
 
-    Price price = 0;
-    if (type == OrderType::LIMIT) {
-        if (tokens[2].empty()) {
-            os << "ERROR: LIMIT order requires a price\n";
-            return;
+    struct Parsed {
+        std::vector<CsvCommand> commands;
+        bool ready = false;
+    };
+    std::vector<Parsed> parsed(chunks.size());
+    std::mutex mutex;
+    std::condition_variable ready_cv;
+    std::condition_variable space_cv;
+    size_t next = 0;       // next chunk to hand to a parser
+    size_t applied = 0;    // chunks this thread has finished with
+
+    // Parsers stay at most a window ahead, which bounds memory to a few
+    // chunks' worth of commands however large the input is
+    const size_t window = threads * 2;
+
+    auto parse = [&] {
+        std::vector<CsvCommand> commands;
+        while (true) {
+            size_t i;
+            {
+                std::unique_lock lock(mutex);
+                space_cv.wait(lock, [&] { return next >= chunks.size() || next < applied + window; });
+                if (next >= chunks.size()) return;
+                i = next++;
+            }
+            commands.clear();
+            for_each_line(chunks[i], [&](std::string_view line) {
+                CsvCommand c = parse_line(line);
+                if (c.kind != CsvCommand::NONE) commands.push_back(c);
+            });
+            {
+                std::lock_guard lock(mutex);
+                parsed[i].commands.swap(commands);
+                parsed[i].ready = true;
+            }
+            ready_cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> parsers;
+    for (size_t t = 0; t < threads - 1; ++t) parsers.emplace_back(parse);
+
+    // This thread matches, strictly in input order
+    std::vector<CsvCommand> commands;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        {
+            std::unique_lock lock(mutex);
+            ready_cv.wait(lock, [&] { return parsed[i].ready; });
+            commands.swap(parsed[i].commands);
         }
-        price = price_from_double(std::stod(tokens[2]));
+        for (const CsvCommand& c : commands) execute(c, out);
+        commands.clear();
+        {
+            std::lock_guard lock(mutex);
+            applied = i + 1;
+        }
+        space_cv.notify_all();
     }
 
-    Quantity qty = static_cast<Quantity>(std::stoul(tokens[3]));
-    if (qty == 0) {
-        os << "ERROR: quantity must be > 0\n";
-        return;
+    for (auto& t : parsers) t.join();
+}
+
+bool CsvParser::process_file(const std::string& path, std::ostream& os, size_t threads) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    bool regular = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+    size_t bytes = regular ? static_cast<size_t>(st.st_size) : 0;
+    void* map = bytes ? mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd);
+
+    if (map == MAP_FAILED) {
+        if (regular && bytes == 0) return true;
+        // Pipes and other unmappable inputs take the stream path
+        std::ifstream file(path);
+        if (!file.is_open()) return false;
+        process_stream(file, os);
+        return true;
     }
 
-    auto trades = engine_.process_order(side, type, price, qty);
-    print_trades(trades, os);
+#ifdef MADV_SEQUENTIAL
+    madvise(map, bytes, MADV_SEQUENTIAL);
+#endif
+    {
+        OutputBuffer out(os);
+        process_buffer(std::string_view(static_cast<const char*>(map), bytes), out, threads);
+    }
+    munmap(map, bytes);
+    return true;
 }
 
-void CsvParser::process_stream(std::istream& is, std::ostream& os) {
-    std::string line;
-    while (std::getline(is, line)) {
-        process_line(line, os);
+MatchingEngine& CsvParser::engine_for(std::string_view symbol) {
+    if (symbol.empty()) return engine_;
+    auto it = symbol_engines_.find(symbol);
+    if (it == symbol_engines_.end()) {
+        it = symbol_engines_.emplace(std::string(symbol), std::make_unique<MatchingEngine>()).first;
     }
+    return *it->second;
 }
 
-void CsvParser::print_trades(const std::vector<Trade>& trades, std::ostream& os) {
-    for (const auto& t : trades) {
-        os << "TRADE " << t.buyer_order_id
-           << " " << t.seller_order_id
-           << " " << price_to_string(t.price)
-           << " " << t.quantity << "\n";
+void CsvParser::print_trade(const Trade& t, std::string_view symbol, OutputBuffer& out) {
+    out.put("TRADE ");
+    out.put_uint(t.buyer_order_id);
+    out.put(' ');
+    out.put_uint(t.seller_order_id);
+    out.put(' ');
+    out.put_price(t.price);
+    out.put(' ');
+    out.put_uint(t.quantity);
+    if (!symbol.empty()) {
+        out.put(' ');
+        out.put(symbol);
     }
+    out.put('\n');
 }
 
 } // namespace ob
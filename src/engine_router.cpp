@@ -0,0 +1,597 @@
+#include "engine_router.h"
+#include "matching_engine.h"
+#include "spsc_ring.h"
+#include "backoff.h"
+#include "cpu_affinity.h"
+#include "snapshot.h"
+#include "instrument.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace ob {
+
+namespace {
+
+struct InboundMessage {
+    uint64_t     session;
+    OrderMessage msg;
+    uint8_t      session_flags;
+};
+
+constexpr size_t INBOUND_CAPACITY = 1 << 14;
+constexpr size_t OUTBOUND_CAPACITY = 1 << 15;   // a request can produce several responses
+constexpr size_t BATCH_SIZE = 256;
+
+} // namespace
+
+struct EngineRouter::Shard {
+    explicit Shard(const PoolOptions& pool_options) : pool(pool_options) {}
+
+    size_t index;
+    size_t shard_count;
+    int core;
+    bool busy_poll = false;
+
+    SpscRing<InboundMessage, INBOUND_CAPACITY> inbound;
+    SpscRing<RoutedResponse, OUTBOUND_CAPACITY> outbound;
+
+    std::unique_ptr<JournalWriter> journal;
+    std::unique_ptr<MarketDataPublisher> market_data;
+    std::string dir;      // journal and snapshot directory
+    std::string stream;
+
+    // Snapshot state; only the request flag and counter leave the shard thread
+    size_t snapshot_records = 0;
+    std::atomic<bool> snapshot_requested{false};
+    std::atomic<uint64_t> snapshots_written{0};
+    pid_t snapshot_pid = -1;          // child writing a snapshot, if any
+    uint64_t snapshot_seq = 0;        // journal seq that child covers
+    uint64_t last_snapshot_seq = 0;   // newest snapshot on disk
+
+    std::atomic<bool> stopping{false};
+    std::atomic<uint64_t> completed{0};
+    std::thread thread;
+
+    // Shard-thread state: one pool shared by every book on this shard
+    ObjectPool<Order> pool;
+    std::vector<std::unique_ptr<MatchingEngine>> engines;   // by symbol / shard_count
+
+    MatchingEngine& engine_for(SymbolId symbol) {
+        size_t local = symbol / shard_count;
+        if (local >= engines.size()) {
+            engines.resize(local + 1);
+        }
+        if (!engines[local]) {
+            engines[local] = std::make_unique<MatchingEngine>(pool);
+            if (market_data) engines[local]->set_depth_listener(market_data.get(), symbol);
+        }
+        return *engines[local];
+    }
+
+    // Attach the feed to every book, including those rebuilt by recovery
+    void attach_market_data(std::unique_ptr<MarketDataPublisher> publisher) {
+        market_data = std::move(publisher);
+        for (size_t local = 0; local < engines.size(); ++local) {
+            if (engines[local]) {
+                engines[local]->set_depth_listener(
+                    market_data.get(), static_cast<SymbolId>(local * shard_count + index));
+            }
+        }
+    }
+
+    void run();
+    void process(std::span<const OrderMessage> msgs, const uint64_t* sessions,
+                 const uint8_t* session_flags, std::vector<RoutedResponse>& responses);
+    void publish(const std::vector<RoutedResponse>& responses);
+    uint64_t replay(uint64_t after_seq);
+
+    uint64_t load_snapshot();
+    void maybe_snapshot();
+    void reap_snapshot(bool block);
+    bool write_snapshot(const std::string& path, uint64_t seq) const;
+};
+
+namespace {
+
+// Turns batch outcomes into wire responses for the submitting session.
+// For AGGREGATE_FILLS sessions the order's ACK and the LEVEL_FILL of the
+// current price stay in `out` and are added to as trades arrive; trades
+// come best price first, so each price is one contiguous run.
+struct ResponseSink {
+    const OrderMessage* base;
+    const uint64_t* sessions;
+    const uint8_t* session_flags;
+    std::vector<RoutedResponse>& out;
+    OrderId current_id = 0;
+    size_t ack_at = 0;     // current order's ACK in out
+    size_t level_at = 0;   // its open LEVEL_FILL in out, if level_open
+    bool level_open = false;
+
+    uint64_t session(const OrderMessage& msg) const { return sessions[&msg - base]; }
+    uint8_t flags(const OrderMessage& msg) const { return session_flags[&msg - base]; }
+
+    void on_accept(const OrderMessage& msg, OrderId id) {
+        current_id = id;
+        ack_at = out.size();
+        level_open = false;
+        out.push_back({session(msg), make_ack(msg.symbol_id, id)});
+    }
+
+    // The fill is for current_id, whichever side it sits on (an AMEND's
+    // message needn't carry the side)
+    void on_trade(const OrderMessage& msg, const Trade& trade) {
+        Side side = trade.buyer_order_id == current_id ? Side::BUY : Side::SELL;
+        uint8_t f = flags(msg);
+        if (!(f & SessionFlags::AGGREGATE_FILLS)) {
+            out.push_back({session(msg), make_fill(msg.symbol_id, current_id, side, trade)});
+            return;
+        }
+
+        ResponseMessage& ack = out[ack_at].msg;
+        ack.quantity += trade.quantity;
+        ack.price = trade.price;
+        ++ack.match_id;
+        if (level_open && out[level_at].msg.price == trade.price) {
+            out[level_at].msg.quantity += trade.quantity;
+            ++out[level_at].msg.match_id;
+        } else {
+            level_at = out.size();
+            level_open = true;
+            out.push_back({session(msg), make_level_fill(msg.symbol_id, current_id, trade)});
+        }
+        if (f & SessionFlags::FILL_DETAIL) {
+            out.push_back({session(msg), make_fill(msg.symbol_id, current_id, side, trade)});
+        }
+    }
+
+    void on_cancel(const OrderMessage& msg, bool ok) {
+        out.push_back({session(msg), ok ? make_ack(msg.symbol_id, msg.order_id)
+                                        : make_reject(msg.symbol_id, msg.order_id)});
+    }
+
+    void on_amend(const OrderMessage& msg, bool ok) {
+        current_id = msg.order_id;
+        ack_at = out.size();
+        level_open = false;
+        on_cancel(msg, ok);
+    }
+
+    void on_reject(const OrderMessage& msg) {
+        out.push_back({session(msg), make_reject(msg.symbol_id, 0)});
+    }
+};
+
+// Replay has nobody to answer
+struct DiscardSink {
+    void on_accept(const OrderMessage&, OrderId) {}
+    void on_trade(const OrderMessage&, const Trade&) {}
+    void on_cancel(const OrderMessage&, bool) {}
+    void on_amend(const OrderMessage&, bool) {}
+    void on_reject(const OrderMessage&) {}
+};
+
+std::string journal_stream(size_t shard, size_t shard_count) {
+    return "shard-" + std::to_string(shard) + "-of-" + std::to_string(shard_count);
+}
+
+// A journal written with another shard count holds other symbol splits;
+// replaying it under this one would silently lose or reorder requests
+void check_shard_count(const std::string& dir, size_t shard_count) {
+    std::error_code ec;
+    std::string suffix = "-of-" + std::to_string(shard_count) + ".";
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.rfind("shard-", 0) != 0) continue;
+        if (name.find(".journal") == std::string::npos &&
+            name.find(".snapshot") == std::string::npos) continue;
+        if (name.find(suffix) == std::string::npos) {
+            throw std::runtime_error("journal in " + dir + " was written with a different "
+                                     "shard count (" + name + ")");
+        }
+    }
+}
+
+std::string snapshot_path(const std::string& dir, const std::string& stream, uint64_t seq) {
+    char name[40];
+    std::snprintf(name, sizeof(name), ".%020llu.snapshot", static_cast<unsigned long long>(seq));
+    return dir + "/" + stream + name;
+}
+
+// Journal seqs of the stream's snapshots, newest first
+std::vector<uint64_t> list_snapshots(const std::string& dir, const std::string& stream) {
+    std::vector<uint64_t> out;
+    std::error_code ec;
+    const std::string prefix = stream + ".";
+    const std::string suffix = ".snapshot";
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.size() != prefix.size() + 20 + suffix.size()) continue;
+        if (name.compare(0, prefix.size(), prefix) != 0) continue;
+        if (name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) continue;
+        std::string digits = name.substr(prefix.size(), 20);
+        if (!std::all_of(digits.begin(), digits.end(), ::isdigit)) continue;
+        out.push_back(std::stoull(digits));
+    }
+    std::sort(out.rbegin(), out.rend());
+    return out;
+}
+
+} // namespace
+
+void EngineRouter::Shard::process(std::span<const OrderMessage> msgs, const uint64_t* sessions,
+                                  const uint8_t* session_flags,
+                                  std::vector<RoutedResponse>& responses) {
+    // Feed each run of same-symbol messages to its book as one batch
+    size_t i = 0;
+    while (i < msgs.size()) {
+        size_t j = i + 1;
+        while (j < msgs.size() && msgs[j].symbol_id == msgs[i].symbol_id) ++j;
+
+        ResponseSink sink{msgs.data(), sessions, session_flags, responses};
+        engine_for(msgs[i].symbol_id).process_batch(msgs.subspan(i, j - i), sink);
+        i = j;
+    }
+}
+
+void EngineRouter::Shard::publish(const std::vector<RoutedResponse>& responses) {
+    // A full response ring means the I/O thread is behind; wait for it
+    // rather than drop, since every request must be answered
+    size_t sent = 0;
+    while (sent < responses.size()) {
+        sent += outbound.push_bulk(responses.data() + sent, responses.size() - sent);
+        if (sent < responses.size()) cpu_relax();
+    }
+}
+
+uint64_t EngineRouter::Shard::replay(uint64_t after_seq) {
+    OrderMessage msgs[BATCH_SIZE];
+    size_t n = 0;
+    uint64_t applied = 0;
+    bool gap = false;
+    DiscardSink sink;
+
+    auto flush = [&] {
+        // One process_batch per run of same-symbol requests
+        size_t i = 0;
+        while (i < n) {
+            size_t j = i + 1;
+            while (j < n && msgs[j].symbol_id == msgs[i].symbol_id) ++j;
+            engine_for(msgs[i].symbol_id)
+                .process_batch(std::span<const OrderMessage>(msgs + i, j - i), sink);
+            i = j;
+        }
+        n = 0;
+    };
+
+    // Records the snapshot already reflects are skipped; the first one
+    // applied must follow it directly
+    replay_journal(dir, stream, [&](const JournalRecord& r) {
+        if (r.seq <= after_seq || gap) return;
+        if (applied == 0 && r.seq != after_seq + 1) {
+            gap = true;
+            return;
+        }
+        msgs[n++] = r.msg;
+        ++applied;
+        if (n == BATCH_SIZE) flush();
+    });
+    flush();
+
+    if (gap) {
+        throw std::runtime_error("journal " + dir + "/" + stream + " does not continue from "
+                                 "snapshot at " + std::to_string(after_seq));
+    }
+    return applied;
+}
+
+uint64_t EngineRouter::Shard::load_snapshot() {
+    // A snapshot that fails its checks is skipped for the next older one;
+    // the journal after that one must then still be there
+    for (uint64_t seq : list_snapshots(dir, stream)) {
+        std::string path = snapshot_path(dir, stream, seq);
+        SnapshotReader reader;
+        if (!reader.open(path)) {
+            std::fprintf(stderr, "ignoring damaged snapshot %s\n", path.c_str());
+            continue;
+        }
+        bool ok = reader.load([&](SymbolId symbol) {
+            if (symbol % shard_count != index) {
+                throw std::runtime_error("snapshot " + path + " holds symbol " +
+                                         std::to_string(symbol) + " of another shard");
+            }
+            return &engine_for(symbol);
+        });
+        if (!ok) throw std::runtime_error("malformed snapshot " + path);
+        return reader.journal_seq();
+    }
+    return 0;
+}
+
+bool EngineRouter::Shard::write_snapshot(const std::string& path, uint64_t seq) const {
+    SnapshotWriter writer(path);
+    for (size_t local = 0; local < engines.size(); ++local) {
+        if (engines[local]) {
+            writer.add_engine(static_cast<SymbolId>(local * shard_count + index), *engines[local]);
+        }
+    }
+    return writer.finish(seq);
+}
+
+// Called right after a commit, so the journal holds no pending records and
+// the books reflect exactly journal seq next_seq() - 1
+void EngineRouter::Shard::maybe_snapshot() {
+    if (!journal) return;
+    if (snapshot_pid > 0) {
+        reap_snapshot(false);
+        if (snapshot_pid > 0) return;
+    }
+
+    uint64_t seq = journal->next_seq() - 1;
+    bool due = snapshot_records > 0 && seq - last_snapshot_seq >= snapshot_records;
+    if (!due && !snapshot_requested.load(std::memory_order_relaxed)) return;
+    snapshot_requested.store(false, std::memory_order_relaxed);
+    if (seq == last_snapshot_seq) return;   // nothing new since the last one
+
+    // The child gets a copy-on-write image of the books as of seq and
+    // writes it out while this thread keeps matching. It only touches
+    // this shard's books, and leaves with _exit so nothing the other
+    // threads owned (journal maps, sockets) is flushed or closed twice.
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::perror("snapshot fork");
+        return;
+    }
+    if (pid == 0) {
+        _exit(write_snapshot(snapshot_path(dir, stream, seq), seq) ? 0 : 1);
+    }
+    snapshot_pid = pid;
+    snapshot_seq = seq;
+}
+
+void EngineRouter::Shard::reap_snapshot(bool block) {
+    int status = 0;
+    pid_t r = waitpid(snapshot_pid, &status, block ? 0 : WNOHANG);
+    if (r == 0) return;
+    snapshot_pid = -1;
+    if (r < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::fprintf(stderr, "snapshot of %s at %llu failed\n", stream.c_str(),
+                     static_cast<unsigned long long>(snapshot_seq));
+        return;
+    }
+
+    // The snapshot is durable: what it covers is no longer needed
+    last_snapshot_seq = snapshot_seq;
+    journal->drop_segments_through(snapshot_seq);
+    for (uint64_t seq : list_snapshots(dir, stream)) {
+        if (seq < snapshot_seq) std::filesystem::remove(snapshot_path(dir, stream, seq));
+    }
+    snapshots_written.fetch_add(1, std::memory_order_release);
+}
+
+void EngineRouter::Shard::run() {
+    pin_current_thread(core);
+#ifdef OB_INSTRUMENT
+    instrument::set_thread_name("shard" + std::to_string(index));
+#endif
+
+    InboundMessage batch[BATCH_SIZE];
+    OrderMessage msgs[BATCH_SIZE];
+    uint64_t sessions[BATCH_SIZE];
+    uint8_t session_flags[BATCH_SIZE];
+    std::vector<RoutedResponse> responses;
+    size_t unpublished = 0;   // requests whose responses are in `responses`
+    Backoff backoff(busy_poll);
+
+    // Group commit: one sync makes every journaled request durable, then
+    // their responses go out together
+    auto commit = [&] {
+        if (journal) journal->sync();
+        publish(responses);
+        completed.fetch_add(unpublished, std::memory_order_release);
+        responses.clear();
+        unpublished = 0;
+        // Depth goes out only for requests that are durable and answered
+        if (market_data && market_data->flush_due()) market_data->flush();
+        maybe_snapshot();
+    };
+
+    while (true) {
+        size_t n = inbound.pop_bulk(batch, BATCH_SIZE);
+        if (n == 0) {
+            // Nothing more arriving right now: don't sit on responses
+            if (unpublished > 0) {
+                commit();
+                continue;
+            }
+            // stop() is only set after the last submit, so one more look
+            // after seeing it catches anything published just before
+            if (stopping.load(std::memory_order_acquire)) {
+                n = inbound.pop_bulk(batch, BATCH_SIZE);
+                if (n == 0) break;
+            } else {
+                if (market_data && market_data->flush_due()) market_data->flush();
+                maybe_snapshot();
+                OB_PUBLISH();
+                backoff.idle();
+                continue;
+            }
+        }
+        backoff.reset();
+
+        for (size_t i = 0; i < n; ++i) {
+            msgs[i] = batch[i].msg;
+            sessions[i] = batch[i].session;
+            session_flags[i] = batch[i].session_flags;
+            if (journal) journal->append(batch[i].msg);
+        }
+        process(std::span<const OrderMessage>(msgs, n), sessions, session_flags, responses);
+        unpublished += n;
+
+        if (!journal || journal->sync_due()) commit();
+    }
+
+    if (market_data && market_data->has_pending()) market_data->flush();
+    if (snapshot_pid > 0) reap_snapshot(true);
+#ifdef OB_INSTRUMENT
+    instrument::publish();
+#endif
+}
+
+EngineRouter::EngineRouter(RouterOptions options)
+    : journal_(std::move(options.journal)),
+      snapshot_records_(options.snapshot_records),
+      market_data_address_(std::move(options.market_data_address)),
+      market_data_port_(options.market_data_port),
+      market_data_(options.market_data) {
+    size_t n = options.shards ? options.shards : 1;
+    for (size_t i = 0; i < n; ++i) {
+        int core = i < options.cores.size() ? options.cores[i] : -1;
+        // A pinned shard's orders live on its own core's node
+        PoolOptions pool = options.pool;
+        if (pool.numa_node < 0) pool.numa_node = numa_node_of(core);
+
+        auto shard = std::make_unique<Shard>(pool);
+        shard->index = i;
+        shard->shard_count = n;
+        shard->snapshot_records = snapshot_records_;
+        shard->core = core;
+        shard->busy_poll = options.busy_poll;
+        shards_.push_back(std::move(shard));
+    }
+}
+
+EngineRouter::~EngineRouter() {
+    stop();
+}
+
+void EngineRouter::start() {
+    if (running_) return;
+
+    // Only the first start() recovers; after a stop() the books are
+    // already up to date and the journal is still open
+    if (!journal_.dir.empty() && !recovered_once_) {
+        std::error_code ec;
+        std::filesystem::create_directories(journal_.dir, ec);
+        check_shard_count(journal_.dir, shards_.size());
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            Shard& shard = *shards_[i];
+            shard.dir = journal_.dir;
+            shard.stream = journal_stream(i, shards_.size());
+
+            uint64_t snapshot_seq = shard.load_snapshot();
+            shard.last_snapshot_seq = snapshot_seq;
+            recovered_ += shard.replay(snapshot_seq);
+
+            std::string name = journal_.dir + "/" + shard.stream;
+            shard.journal = std::make_unique<JournalWriter>(journal_, shard.stream);
+            if (!shard.journal->open(snapshot_seq + 1)) {
+                throw std::runtime_error("cannot open journal " + name);
+            }
+            if (shard.journal->next_seq() <= snapshot_seq) {
+                throw std::runtime_error("journal " + name + " ends before its snapshot at " +
+                                         std::to_string(snapshot_seq));
+            }
+        }
+        recovered_once_ = true;
+    }
+
+    // After recovery, so replayed requests don't re-publish stale depth
+    if (!market_data_address_.empty()) {
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            if (shards_[i]->market_data) continue;
+            MarketDataOptions md = market_data_;
+            md.channel = static_cast<uint16_t>(i);
+            shards_[i]->attach_market_data(std::make_unique<MarketDataPublisher>(
+                std::make_unique<UdpDepthTransport>(market_data_address_, market_data_port_), md));
+        }
+    }
+
+    running_ = true;
+    for (auto& shard : shards_) {
+        shard->stopping.store(false, std::memory_order_relaxed);
+        shard->thread = std::thread([s = shard.get()] { s->run(); });
+    }
+}
+
+void EngineRouter::stop() {
+    if (!running_) return;
+    for (auto& shard : shards_) {
+        shard->stopping.store(true, std::memory_order_release);
+    }
+    // Keep draining so no shard can block on a full response ring
+    Backoff backoff;
+    while (in_flight() > 0) {
+        if (poll_responses(backlog_) == 0) backoff.idle();
+    }
+    for (auto& shard : shards_) {
+        shard->thread.join();
+    }
+    poll_responses(backlog_);
+    running_ = false;
+}
+
+bool EngineRouter::submit(uint64_t session, const OrderMessage& msg, uint8_t session_flags) {
+    Shard& shard = *shards_[shard_of(msg.symbol_id)];
+    if (!shard.inbound.try_push(InboundMessage{session, msg, session_flags})) {
+        return false;
+    }
+    ++submitted_;
+    return true;
+}
+
+size_t EngineRouter::poll_responses(std::vector<RoutedResponse>& out) {
+    size_t before = out.size();
+    if (!backlog_.empty() && &out != &backlog_) {
+        out.insert(out.end(), backlog_.begin(), backlog_.end());
+        backlog_.clear();
+    }
+
+    RoutedResponse chunk[BATCH_SIZE];
+    for (auto& shard : shards_) {
+        size_t n;
+        while ((n = shard->outbound.pop_bulk(chunk, BATCH_SIZE)) > 0) {
+            out.insert(out.end(), chunk, chunk + n);
+        }
+    }
+    return out.size() - before;
+}
+
+void EngineRouter::request_snapshot() {
+    for (auto& shard : shards_) {
+        shard->snapshot_requested.store(true, std::memory_order_relaxed);
+    }
+}
+
+uint64_t EngineRouter::snapshots_written() const {
+    uint64_t n = 0;
+    for (const auto& shard : shards_) {
+        n += shard->snapshots_written.load(std::memory_order_acquire);
+    }
+    return n;
+}
+
+bool EngineRouter::huge_pages() const {
+    for (const auto& shard : shards_) {
+        if (!shard->pool.huge_pages()) return false;
+    }
+    return true;
+}
+
+size_t EngineRouter::in_flight() const {
+    uint64_t completed = 0;
+    for (const auto& shard : shards_) {
+        completed += shard->completed.load(std::memory_order_acquire);
+    }
+    return static_cast<size_t>(submitted_ - completed);
+}
+
+} // namespace ob
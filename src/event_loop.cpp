@@ -0,0 +1,18 @@
+#include "event_loop.h"
+
+namespace ob {
+
+std::unique_ptr<EventLoop> make_event_loop(const std::string& name) {
+    if (name == "epoll") return make_epoll_loop();
+    if (name == "io_uring") return make_io_uring_loop();
+    if (name == "kqueue") return make_kqueue_loop();
+    if (!name.empty()) return nullptr;
+
+#if defined(__linux__)
+    return make_epoll_loop();
+#else
+    return make_kqueue_loop();
+#endif
+}
+
+} // namespace ob
@@ -0,0 +1,121 @@
+#include "event_loop.h"
+
+#ifdef __linux__
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <cstdio>
+
+namespace ob {
+
+namespace {
+
+// Edge-triggered epoll: one notification per state change, so a READABLE
+// event means "read until EAGAIN". The listener stays level-triggered.
+class EpollLoop final : public EventLoop {
+public:
+    EpollLoop() {
+        epfd_ = epoll_create1(EPOLL_CLOEXEC);
+        if (epfd_ < 0) perror("epoll_create1");
+    }
+
+    ~EpollLoop() override {
+        if (epfd_ >= 0) close(epfd_);
+    }
+
+    bool valid() const { return epfd_ >= 0; }
+
+    const char* name() const override { return "epoll"; }
+
+    bool add_listener(int fd) override {
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        return epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) == 0;
+    }
+
+    bool add_client(int fd) override {
+        epoll_event ev{};
+        ev.events = CLIENT_EVENTS;
+        ev.data.fd = fd;
+        return epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) == 0;
+    }
+
+    void remove_client(int fd) override {
+        epoll_ctl(epfd_, EPOLL_CTL_DEL, fd, nullptr);
+    }
+
+    ssize_t send(int fd, const iovec* iov, int iovcnt) override {
+        while (true) {
+            ssize_t n = writev(fd, iov, iovcnt);
+            if (n >= 0) return n;
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+            return -1;
+        }
+    }
+
+    void want_writable(int fd, bool enable) override {
+        epoll_event ev{};
+        ev.events = CLIENT_EVENTS | (enable ? EPOLLOUT : 0u);
+        ev.data.fd = fd;
+        epoll_ctl(epfd_, EPOLL_CTL_MOD, fd, &ev);
+    }
+
+    int wait(IoEvent* events, int max_events, int64_t timeout_us) override {
+        if (max_events > MAX_EVENTS) max_events = MAX_EVENTS;
+
+        int n;
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 35))
+        // Microsecond timeouts, so a short poll doesn't round up to 1 ms
+        timespec ts{static_cast<time_t>(timeout_us / 1'000'000),
+                    static_cast<long>((timeout_us % 1'000'000) * 1000)};
+        n = epoll_pwait2(epfd_, raw_, max_events, timeout_us < 0 ? nullptr : &ts, nullptr);
+#else
+        int timeout_ms = timeout_us < 0 ? -1 : static_cast<int>((timeout_us + 999) / 1000);
+        n = epoll_wait(epfd_, raw_, max_events, timeout_ms);
+#endif
+        if (n < 0) return errno == EINTR ? 0 : -1;
+
+        for (int i = 0; i < n; ++i) {
+            uint32_t e = raw_[i].events;
+            uint32_t flags = 0;
+            if (e & EPOLLIN) flags |= IoEvent::READABLE;
+            if (e & EPOLLOUT) flags |= IoEvent::WRITABLE;
+            if (e & (EPOLLHUP | EPOLLERR)) flags |= IoEvent::HANGUP;
+            // RDHUP with data still queued: let the reader drain it and see EOF
+            if ((e & EPOLLRDHUP) && !(e & EPOLLIN)) flags |= IoEvent::HANGUP;
+            events[i] = IoEvent{raw_[i].data.fd, flags};
+        }
+        return n;
+    }
+
+private:
+    static constexpr int MAX_EVENTS = 256;
+    static constexpr uint32_t CLIENT_EVENTS = EPOLLIN | EPOLLRDHUP | EPOLLET;
+
+    int epfd_ = -1;
+    epoll_event raw_[MAX_EVENTS];
+};
+
+} // namespace
+
+std::unique_ptr<EventLoop> make_epoll_loop() {
+    auto loop = std::make_unique<EpollLoop>();
+    if (!loop->valid()) return nullptr;
+    return loop;
+}
+
+} // namespace ob
+
+#else
+
+namespace ob {
+std::unique_ptr<EventLoop> make_epoll_loop() { return nullptr; }
+} // namespace ob
+
+#endif
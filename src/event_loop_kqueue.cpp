@@ -0,0 +1,101 @@
+#include "event_loop.h"
+
+#if defined(__APPLE__) || defined(__FreeBSD__)
+
+#include <sys/event.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <ctime>
+
+namespace ob {
+
+namespace {
+
+class KqueueLoop final : public EventLoop {
+public:
+    KqueueLoop() {
+        kq_ = kqueue();
+        if (kq_ < 0) perror("kqueue");
+    }
+
+    ~KqueueLoop() override {
+        if (kq_ >= 0) close(kq_);
+    }
+
+    bool valid() const { return kq_ >= 0; }
+
+    const char* name() const override { return "kqueue"; }
+
+    bool add_listener(int fd) override { return change(fd, EVFILT_READ, EV_ADD); }
+
+    bool add_client(int fd) override { return change(fd, EVFILT_READ, EV_ADD); }
+
+    void remove_client(int fd) override {
+        change(fd, EVFILT_READ, EV_DELETE);
+        change(fd, EVFILT_WRITE, EV_DELETE);
+    }
+
+    ssize_t send(int fd, const iovec* iov, int iovcnt) override {
+        while (true) {
+            ssize_t n = writev(fd, iov, iovcnt);
+            if (n >= 0) return n;
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+            return -1;
+        }
+    }
+
+    void want_writable(int fd, bool enable) override {
+        change(fd, EVFILT_WRITE, enable ? EV_ADD : EV_DELETE);
+    }
+
+    int wait(IoEvent* events, int max_events, int64_t timeout_us) override {
+        if (max_events > MAX_EVENTS) max_events = MAX_EVENTS;
+
+        timespec ts{static_cast<time_t>(timeout_us / 1'000'000),
+                    static_cast<long>((timeout_us % 1'000'000) * 1000)};
+        int n = kevent(kq_, nullptr, 0, raw_, max_events, timeout_us < 0 ? nullptr : &ts);
+        if (n < 0) return errno == EINTR ? 0 : -1;
+
+        for (int i = 0; i < n; ++i) {
+            const struct kevent& e = raw_[i];
+            uint32_t flags = 0;
+            if (e.filter == EVFILT_READ && e.data > 0) flags |= IoEvent::READABLE;
+            if (e.filter == EVFILT_WRITE) flags |= IoEvent::WRITABLE;
+            if (e.flags & (EV_EOF | EV_ERROR)) flags |= IoEvent::HANGUP;
+            events[i] = IoEvent{static_cast<int>(e.ident), flags};
+        }
+        return n;
+    }
+
+private:
+    static constexpr int MAX_EVENTS = 256;
+
+    int kq_ = -1;
+    struct kevent raw_[MAX_EVENTS];
+
+    bool change(int fd, int16_t filter, uint16_t flags) {
+        struct kevent ev;
+        EV_SET(&ev, fd, filter, flags, 0, 0, nullptr);
+        return kevent(kq_, &ev, 1, nullptr, 0, nullptr) == 0;
+    }
+};
+
+} // namespace
+
+std::unique_ptr<EventLoop> make_kqueue_loop() {
+    auto loop = std::make_unique<KqueueLoop>();
+    if (!loop->valid()) return nullptr;
+    return loop;
+}
+
+} // namespace ob
+
+#else
+
+namespace ob {
+std::unique_ptr<EventLoop> make_kqueue_loop() { return nullptr; }
+} // namespace ob
+
+#endif
@@ -0,0 +1,657 @@
+#include "event_loop.h"
+#include "event_loop_uring_testing.h"
+
+#ifdef __linux__
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <poll.h>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+namespace ob {
+
+namespace {
+
+int sys_io_uring_setup(unsigned entries, io_uring_params* p) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags,
+                       const void* arg, size_t argsz) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                                    flags, arg, argsz));
+}
+
+// io_uring on raw syscalls (no liburing dependency).
+//
+// Each client has one multishot recv that draws from a group of provided
+// buffers, so the kernel keeps receiving into our buffers without a new
+// SQE per read. Buffers go back to the group in contiguous runs with one
+// PROVIDE_BUFFERS per run, queued alongside everything else. (The mapped
+// buffer-ring variant, IORING_REGISTER_PBUF_RING, avoids even that SQE
+// but registered without error and then never handed out a buffer on
+// some of our kernels, so the classic interface it is.) Output is appended per client and turned
+// into at most one SEND per client per wait(), and every SQE queued in an
+// iteration goes to the kernel in the same io_uring_enter that waits for
+// completions.
+//
+// Anything that finds the submission queue full (a SEND, a recv or
+// listener arm, a cancel, a buffer hand-back) is kept and retried on the
+// next wait(), never dropped.
+//
+// Testing: built with fault injection, for make_io_uring_loop_for_test
+template <bool Testing>
+class BasicUringLoop final : public EventLoop {
+public:
+    explicit BasicUringLoop(const bool* sq_full = nullptr) : sq_full_(sq_full) {}
+
+    ~BasicUringLoop() override {
+        if (buffers_) munmap(buffers_, BUF_COUNT * BUF_SIZE);
+        if (sqes_) munmap(sqes_, sqes_bytes_);
+        if (cq_ptr_ && cq_ptr_ != sq_ptr_) munmap(cq_ptr_, cq_bytes_);
+        if (sq_ptr_) munmap(sq_ptr_, sq_bytes_);
+        if (ring_fd_ >= 0) close(ring_fd_);
+    }
+
+    bool init() {
+        io_uring_params p{};
+        p.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_COOP_TASKRUN;
+        p.cq_entries = SQ_ENTRIES * 8;   // multishot recvs post many CQEs per SQE
+        ring_fd_ = sys_io_uring_setup(SQ_ENTRIES, &p);
+        if (ring_fd_ < 0 && errno == EINVAL) {
+            // Older kernels: drop the optional setup flags
+            p = io_uring_params{};
+            p.flags = IORING_SETUP_CQSIZE;
+            p.cq_entries = SQ_ENTRIES * 8;
+            ring_fd_ = sys_io_uring_setup(SQ_ENTRIES, &p);
+        }
+        if (ring_fd_ < 0) {
+            perror("io_uring_setup");
+            return false;
+        }
+        if (!(p.features & IORING_FEAT_EXT_ARG)) {
+            std::fprintf(stderr, "io_uring: kernel lacks IORING_FEAT_EXT_ARG\n");
+            return false;
+        }
+        return map_rings(p) && setup_buffers();
+    }
+
+    const char* name() const override { return "io_uring"; }
+
+    bool add_listener(int fd) override {
+        listen_fd_ = fd;
+        arm_listener();   // or on the next wait(), if the SQ is full
+        return true;
+    }
+
+    bool add_client(int fd) override {
+        Conn& c = conn(fd);
+        c.active = true;
+        c.pending.clear();
+        arm_recv(fd);
+        return true;
+    }
+
+    void remove_client(int fd) override {
+        Conn& c = conn(fd);
+        if (!c.active) return;
+
+        cancel(tag(OP_RECV, fd, c.generation));
+        if (c.sending) {
+            // The kernel may still be reading the in-flight buffer; keep it
+            // alive until the (now stale) SEND completes. A cancel that has
+            // to wait for an SQE still reaches it: io_uring matches on
+            // user_data and holds the socket open until then.
+            cancel(tag(OP_SEND, fd, c.generation));
+            orphans_.push_back({tag(OP_SEND, fd, c.generation), std::move(c.inflight)});
+        }
+        // Push the cancels out now: the caller closes fd right after this,
+        // and the socket stays open while io_uring still holds requests on it
+        submit(0, 0);
+
+        c.active = false;
+        c.sending = false;
+        c.recv_starved = false;
+        c.want_writable = false;
+        c.inflight.clear();
+        c.inflight_sent = 0;
+        c.pending.clear();
+        ++c.generation;
+    }
+
+    // Takes at most MAX_PENDING bytes per client beyond what is in flight,
+    // so a client that stops reading backs up into the caller's buffer
+    // (and its backlog limit) rather than here
+    ssize_t send(int fd, const iovec* iov, int iovcnt) override {
+        Conn& c = conn(fd);
+        if (!c.active) return -1;
+
+        size_t total = 0;
+        for (int i = 0; i < iovcnt && c.pending.size() < MAX_PENDING; ++i) {
+            const char* p = static_cast<const char*>(iov[i].iov_base);
+            size_t n = std::min(iov[i].iov_len, MAX_PENDING - c.pending.size());
+            c.pending.insert(c.pending.end(), p, p + n);
+            total += n;
+        }
+        if (total > 0 && !c.send_queued && !c.sending) {
+            c.send_queued = true;
+            dirty_.push_back(fd);
+        }
+        return static_cast<ssize_t>(total);
+    }
+
+    // WRITABLE is reported when a SEND completes and pending has room again
+    void want_writable(int fd, bool enable) override {
+        Conn& c = conn(fd);
+        if (c.active) c.want_writable = enable;
+    }
+
+    int wait(IoEvent* events, int max_events, int64_t timeout_us) override {
+        retry_deferred();
+        flush_sends();
+        return_buffers();   // before re-arming recvs that ran dry
+        rearm_starved();
+
+        unsigned to_submit = unsubmitted();
+        if (cq_ready() == 0 && timeout_us != 0) {
+            __kernel_timespec ts{};
+            io_uring_getevents_arg arg{};
+            arg.sigmask_sz = _NSIG / 8;
+            if (timeout_us > 0) {
+                ts.tv_sec = timeout_us / 1'000'000;
+                ts.tv_nsec = (timeout_us % 1'000'000) * 1000;
+                arg.ts = reinterpret_cast<uint64_t>(&ts);
+            }
+            if (!enter(to_submit, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                       &arg, sizeof(arg))) {
+                return -1;
+            }
+        } else if (to_submit > 0) {
+            if (!enter(to_submit, 0, 0, nullptr, 0)) return -1;
+        }
+
+        return reap(events, max_events);
+    }
+
+    void release(const IoEvent& event) override {
+        if (!(event.flags & IoEvent::DATA)) return;
+        released_.push_back(static_cast<uint16_t>(event.buffer_id));
+    }
+
+private:
+    static constexpr unsigned SQ_ENTRIES = 1024;
+    static constexpr unsigned BUF_COUNT = 1024;   // power of two
+    static constexpr unsigned BUF_SIZE = 4096;
+    static constexpr uint16_t BUF_GROUP = 0;
+    static constexpr size_t MAX_PENDING = 1 << 20;   // bytes send() queues per client
+
+    enum Op : uint64_t { OP_LISTEN = 1, OP_RECV, OP_SEND, OP_CANCEL, OP_PROVIDE };
+
+    // user_data: op (8 bits) | generation (24 bits) | fd (32 bits). The
+    // generation lets completions for a closed client (whose fd may already
+    // belong to someone new) be recognised and dropped.
+    static uint64_t tag(Op op, int fd, uint32_t generation) {
+        return (static_cast<uint64_t>(op) << 56) |
+               (static_cast<uint64_t>(generation & 0xffffff) << 32) |
+               static_cast<uint32_t>(fd);
+    }
+    static Op tag_op(uint64_t t) { return static_cast<Op>(t >> 56); }
+    static uint32_t tag_generation(uint64_t t) { return (t >> 32) & 0xffffff; }
+    static int tag_fd(uint64_t t) { return static_cast<int>(t & 0xffffffffu); }
+
+    struct Conn {
+        uint32_t generation = 0;
+        bool active = false;
+        bool sending = false;        // a SEND is in the kernel
+        bool send_queued = false;    // on dirty_, waiting for flush_sends()
+                                     // (also when inflight got no SQE)
+        bool recv_starved = false;   // recv to re-arm: ran out of buffers, or no SQE
+        bool want_writable = false;  // the caller holds output send() refused
+        std::vector<char> inflight;  // bytes of the outstanding SEND
+        size_t inflight_sent = 0;
+        std::vector<char> pending;   // appended since the last SEND went out
+    };
+
+    struct Orphan {
+        uint64_t tag;
+        std::vector<char> buffer;
+    };
+
+    int ring_fd_ = -1;
+    int listen_fd_ = -1;
+
+    // Submission queue
+    void* sq_ptr_ = nullptr;
+    size_t sq_bytes_ = 0;
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ptr_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_entries_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_bytes_ = 0;
+    unsigned sq_tail_ = 0;        // local tail, published by enter()
+
+    // Completion queue
+    void* cq_ptr_ = nullptr;
+    size_t cq_bytes_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    // Provided buffers
+    char* buffers_ = nullptr;
+    std::vector<uint16_t> released_;   // buffer ids to hand back
+
+    std::vector<Conn> conns_;     // by fd
+    std::vector<int> dirty_;      // fds with pending output
+    std::vector<int> flushing_;   // dirty_ as flush_sends() walks it
+    std::vector<int> starved_;    // fds whose recv needs re-arming
+    std::vector<int> rearming_;   // starved_ as rearm_starved() walks it
+    std::vector<Orphan> orphans_;
+    std::vector<uint64_t> cancels_;   // cancels that found no SQE
+    bool listener_armed_ = false;
+    const bool* sq_full_;         // Testing only
+
+    Conn& conn(int fd) {
+        if (static_cast<size_t>(fd) >= conns_.size()) conns_.resize(fd + 1);
+        return conns_[fd];
+    }
+
+    bool map_rings(const io_uring_params& p) {
+        sq_bytes_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_bytes_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+        if (single) sq_bytes_ = cq_bytes_ = std::max(sq_bytes_, cq_bytes_);
+
+        sq_ptr_ = mmap(nullptr, sq_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) {
+            sq_ptr_ = nullptr;
+            perror("mmap sq ring");
+            return false;
+        }
+        if (single) {
+            cq_ptr_ = sq_ptr_;
+        } else {
+            cq_ptr_ = mmap(nullptr, cq_bytes_, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+            if (cq_ptr_ == MAP_FAILED) {
+                cq_ptr_ = nullptr;
+                perror("mmap cq ring");
+                return false;
+            }
+        }
+
+        sqes_bytes_ = p.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, sqes_bytes_, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            perror("mmap sqes");
+            return false;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(sq_ptr_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+        sq_tail_ptr_ = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        sq_entries_ = p.sq_entries;
+        // SQE slot i is always array entry i
+        unsigned* array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        for (unsigned i = 0; i < sq_entries_; ++i) array[i] = i;
+        sq_tail_ = *sq_tail_ptr_;
+
+        char* cq = static_cast<char*>(cq_ptr_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+        return true;
+    }
+
+    bool setup_buffers() {
+        void* bufs = mmap(nullptr, BUF_COUNT * BUF_SIZE, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (bufs == MAP_FAILED) {
+            perror("mmap buffers");
+            return false;
+        }
+        buffers_ = static_cast<char*>(bufs);
+
+        // Everything starts in the group; wait for it so the first recv
+        // can't race ahead of the buffers
+        if (!provide(0, BUF_COUNT)) return false;
+        submit(1, IORING_ENTER_GETEVENTS);
+        if (cq_ready() == 0) return false;
+        const io_uring_cqe& cqe = cqes_[*cq_head_ & cq_mask_];
+        int res = cqe.res;
+        __atomic_store_n(cq_head_, *cq_head_ + 1, __ATOMIC_RELEASE);
+        if (res < 0) {
+            std::fprintf(stderr, "io_uring PROVIDE_BUFFERS: %s\n", std::strerror(-res));
+            return false;
+        }
+        return true;
+    }
+
+    bool provide(uint16_t first, unsigned count) {
+        io_uring_sqe* sqe = get_sqe();
+        if (!sqe) return false;
+        sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+        sqe->fd = static_cast<int>(count);
+        sqe->addr = reinterpret_cast<uint64_t>(buffers_ + static_cast<size_t>(first) * BUF_SIZE);
+        sqe->len = BUF_SIZE;
+        sqe->off = first;
+        sqe->buf_group = BUF_GROUP;
+        sqe->user_data = tag(OP_PROVIDE, 0, 0);
+        return true;
+    }
+
+    void return_buffers() {
+        if (released_.empty()) return;
+        std::sort(released_.begin(), released_.end());
+        size_t i = 0;
+        while (i < released_.size()) {
+            size_t j = i + 1;
+            while (j < released_.size() && released_[j] == released_[j - 1] + 1) ++j;
+            if (!provide(released_[i], static_cast<unsigned>(j - i))) {
+                // Keep the rest for the next wait()
+                released_.erase(released_.begin(), released_.begin() + i);
+                return;
+            }
+            i = j;
+        }
+        released_.clear();
+    }
+
+    io_uring_sqe* get_sqe() {
+        if constexpr (Testing) {
+            if (*sq_full_) return nullptr;
+        }
+        unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (sq_tail_ - head >= sq_entries_) {
+            // Full: hand what we have to the kernel and try again
+            submit(0, 0);
+            head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            if (sq_tail_ - head >= sq_entries_) return nullptr;
+        }
+        io_uring_sqe* sqe = &sqes_[sq_tail_ & sq_mask_];
+        std::memset(sqe, 0, sizeof(*sqe));
+        ++sq_tail_;
+        return sqe;
+    }
+
+    bool enter(unsigned to_submit, unsigned min_complete, unsigned flags,
+               const void* arg, size_t argsz) {
+        __atomic_store_n(sq_tail_ptr_, sq_tail_, __ATOMIC_RELEASE);
+        int ret = sys_io_uring_enter(ring_fd_, to_submit, min_complete, flags, arg, argsz);
+        if (ret < 0 && errno != ETIME && errno != EINTR && errno != EBUSY) {
+            perror("io_uring_enter");
+            return false;
+        }
+        // Timed out, interrupted or CQ backed up: reap what is there and go on
+        return true;
+    }
+
+    // SQEs the kernel has not consumed yet
+    unsigned unsubmitted() const {
+        return sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    }
+
+    void submit(unsigned min_complete, unsigned flags) {
+        unsigned to_submit = unsubmitted();
+        if (to_submit == 0 && min_complete == 0) return;
+        enter(to_submit, min_complete, flags, nullptr, 0);
+    }
+
+    unsigned cq_ready() const {
+        return __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE) - *cq_head_;
+    }
+
+    void arm_listener() {
+        io_uring_sqe* sqe = get_sqe();
+        listener_armed_ = sqe != nullptr;
+        if (!sqe) return;
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = listen_fd_;
+        sqe->poll32_events = POLLIN;
+        sqe->len = IORING_POLL_ADD_MULTI;
+        sqe->user_data = tag(OP_LISTEN, listen_fd_, 0);
+    }
+
+    void arm_recv(int fd) {
+        io_uring_sqe* sqe = get_sqe();
+        if (!sqe) {
+            Conn& c = conn(fd);
+            if (!c.recv_starved) {
+                c.recv_starved = true;
+                starved_.push_back(fd);
+            }
+            return;
+        }
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = fd;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = BUF_GROUP;
+        sqe->user_data = tag(OP_RECV, fd, conn(fd).generation);
+    }
+
+    void cancel(uint64_t target) {
+        io_uring_sqe* sqe = get_sqe();
+        if (!sqe) {
+            cancels_.push_back(target);
+            return;
+        }
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = target;
+        sqe->user_data = tag(OP_CANCEL, 0, 0);
+    }
+
+    void start_send(int fd, Conn& c) {
+        c.inflight.swap(c.pending);
+        c.pending.clear();
+        c.inflight_sent = 0;
+        c.sending = true;
+        submit_send(fd, c);
+    }
+
+    // With no SQE to be had, the unsent rest of inflight stays put and the
+    // fd goes back on dirty_ for the next flush_sends() to resubmit
+    void submit_send(int fd, Conn& c) {
+        io_uring_sqe* sqe = get_sqe();
+        if (!sqe) {
+            c.sending = false;
+            if (!c.send_queued) {
+                c.send_queued = true;
+                dirty_.push_back(fd);
+            }
+            return;
+        }
+        sqe->opcode = IORING_OP_SEND;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(c.inflight.data() + c.inflight_sent);
+        sqe->len = static_cast<uint32_t>(c.inflight.size() - c.inflight_sent);
+        sqe->msg_flags = MSG_NOSIGNAL;
+        sqe->user_data = tag(OP_SEND, fd, c.generation);
+    }
+
+    void flush_sends() {
+        flushing_.swap(dirty_);   // a stalled send requeues onto dirty_
+        for (int fd : flushing_) {
+            Conn& c = conn(fd);
+            c.send_queued = false;
+            if (!c.active || c.sending) continue;
+            if (c.inflight_sent < c.inflight.size()) {
+                c.sending = true;   // finish the stalled one first
+                submit_send(fd, c);
+            } else if (!c.pending.empty()) {
+                start_send(fd, c);
+            }
+        }
+        flushing_.clear();
+    }
+
+    void rearm_starved() {
+        rearming_.swap(starved_);   // an arm that finds no SQE requeues
+        for (int fd : rearming_) {
+            Conn& c = conn(fd);
+            if (c.active && c.recv_starved) {
+                c.recv_starved = false;
+                arm_recv(fd);
+            }
+        }
+        rearming_.clear();
+    }
+
+    void retry_deferred() {
+        if (listen_fd_ >= 0 && !listener_armed_) arm_listener();
+        size_t done = 0;
+        while (done < cancels_.size()) {
+            io_uring_sqe* sqe = get_sqe();
+            if (!sqe) break;
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = cancels_[done++];
+            sqe->user_data = tag(OP_CANCEL, 0, 0);
+        }
+        cancels_.erase(cancels_.begin(), cancels_.begin() + done);
+    }
+
+    void drop_orphan(uint64_t t) {
+        for (size_t i = 0; i < orphans_.size(); ++i) {
+            if (orphans_[i].tag == t) {
+                orphans_[i] = std::move(orphans_.back());
+                orphans_.pop_back();
+                return;
+            }
+        }
+    }
+
+    int reap(IoEvent* events, int max_events) {
+        int count = 0;
+        unsigned head = *cq_head_;
+        unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+
+        // A CQE can yield two events (last DATA, then HANGUP)
+        while (head != tail && count + 2 <= max_events) {
+            const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+            ++head;
+            handle_cqe(cqe, events, count);
+        }
+
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+        return count;
+    }
+
+    void handle_cqe(const io_uring_cqe& cqe, IoEvent* events, int& count) {
+        uint64_t t = cqe.user_data;
+        Op op = tag_op(t);
+        int fd = tag_fd(t);
+        bool more = cqe.flags & IORING_CQE_F_MORE;
+
+        switch (op) {
+        case OP_LISTEN:
+            if (cqe.res >= 0) events[count++] = IoEvent{fd, IoEvent::READABLE};
+            if (!more) arm_listener();
+            return;
+
+        case OP_RECV: {
+            Conn& c = conn(fd);
+            bool live = c.active && tag_generation(t) == (c.generation & 0xffffff);
+            if (cqe.flags & IORING_CQE_F_BUFFER) {
+                uint16_t bid = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+                if (live && cqe.res > 0) {
+                    IoEvent ev{fd, IoEvent::DATA};
+                    ev.data = buffers_ + static_cast<size_t>(bid) * BUF_SIZE;
+                    ev.len = static_cast<size_t>(cqe.res);
+                    ev.buffer_id = bid;
+                    events[count++] = ev;
+                } else {
+                    released_.push_back(bid);
+                }
+            }
+            if (!live) return;
+            if (cqe.res == 0 || (cqe.res < 0 && cqe.res != -ENOBUFS)) {
+                events[count++] = IoEvent{fd, IoEvent::HANGUP};
+            } else if (cqe.res == -ENOBUFS) {
+                // Out of buffers: wait until the caller releases some
+                c.recv_starved = true;
+                starved_.push_back(fd);
+            } else if (!more) {
+                arm_recv(fd);
+            }
+            return;
+        }
+
+        case OP_SEND: {
+            Conn& c = conn(fd);
+            bool live = c.active && tag_generation(t) == (c.generation & 0xffffff);
+            if (!live) {
+                drop_orphan(t);
+                return;
+            }
+            if (cqe.res < 0) {
+                c.sending = false;
+                events[count++] = IoEvent{fd, IoEvent::HANGUP};
+                return;
+            }
+            c.inflight_sent += static_cast<size_t>(cqe.res);
+            if (c.inflight_sent < c.inflight.size()) {
+                submit_send(fd, c);              // short send: push the rest
+                return;
+            }
+            if (!c.pending.empty()) {
+                start_send(fd, c);               // more queued meanwhile
+            } else {
+                c.sending = false;
+            }
+            if (c.want_writable) events[count++] = IoEvent{fd, IoEvent::WRITABLE};
+            return;
+        }
+
+        case OP_CANCEL:
+            return;
+
+        case OP_PROVIDE:
+            if (cqe.res < 0) {
+                std::fprintf(stderr, "io_uring PROVIDE_BUFFERS: %s\n", std::strerror(-cqe.res));
+            }
+            return;
+        }
+    }
+};
+
+} // namespace
+
+std::unique_ptr<EventLoop> make_io_uring_loop() {
+    auto loop = std::make_unique<BasicUringLoop<false>>();
+    if (!loop->init()) return nullptr;
+    return loop;
+}
+
+std::unique_ptr<EventLoop> make_io_uring_loop_for_test(const bool* sq_full) {
+    auto loop = std::make_unique<BasicUringLoop<true>>(sq_full);
+    if (!loop->init()) return nullptr;
+    return loop;
+}
+
+} // namespace ob
+
+#else
+
+namespace ob {
+std::unique_ptr<EventLoop> make_io_uring_loop() { return nullptr; }
+std::unique_ptr<EventLoop> make_io_uring_loop_for_test(const bool*) { return nullptr; }
+} // namespace ob
+
+#endif
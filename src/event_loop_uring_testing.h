@@ -0,0 +1,13 @@
+#pragma once
+
+#include "event_loop.h"
+#include <memory>
+
+namespace ob {
+
+// Test seam for the io_uring backend, kept out of the public interface.
+// While *sq_full is true the loop finds its submission queue full, as when
+// the kernel stops taking entries. nullptr where io_uring is unavailable.
+std::unique_ptr<EventLoop> make_io_uring_loop_for_test(const bool* sq_full);
+
+} // namespace ob
@@ -0,0 +1,151 @@
+#include "instrument.h"
+
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+namespace ob::instrument {
+
+namespace {
+
+// One per thread that ever recorded; never freed, so the last publish of
+// a finished thread stays readable
+struct alignas(64) Slot {
+    std::mutex lock;
+    std::string name;
+    Stats published;
+};
+
+struct Registry {
+    std::mutex lock;
+    std::vector<std::unique_ptr<Slot>> slots;
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+struct Local {
+    Stats stats;
+    Slot* slot = nullptr;
+    uint64_t next_publish = 0;
+
+    Local() {
+        auto owned = std::make_unique<Slot>();
+        slot = owned.get();
+        Registry& r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        slot->name = "thread" + std::to_string(r.slots.size());
+        r.slots.push_back(std::move(owned));
+    }
+
+    ~Local() {
+        std::lock_guard<std::mutex> guard(slot->lock);
+        slot->published = stats;
+    }
+};
+
+Local& local_state() {
+    thread_local std::unique_ptr<Local> state;
+    if (!state) [[unlikely]] state = std::make_unique<Local>();
+    return *state;
+}
+
+constexpr const char* TIMER_NAMES[] = {
+    "decode", "match", "level_walk", "book_insert", "encode", "socket_write",
+};
+constexpr const char* COUNTER_NAMES[] = {
+    "orders", "cancels", "amends", "trades", "pool_growth",
+};
+constexpr const char* DIST_NAMES[] = {
+    "levels_swept", "queue_depth",
+};
+static_assert(std::size(TIMER_NAMES) == static_cast<size_t>(Timer::COUNT));
+static_assert(std::size(COUNTER_NAMES) == static_cast<size_t>(Counter::COUNT));
+static_assert(std::size(DIST_NAMES) == static_cast<size_t>(Dist::COUNT));
+
+void print_histogram(std::ostream& os, const char* name, const LatencyHistogram& h,
+                     double scale) {
+    os << "  " << std::left << std::setw(14) << name << std::right
+       << " n=" << h.count()
+       << " mean=" << h.mean() * scale
+       << " p50=" << h.percentile(50) * scale
+       << " p99=" << h.percentile(99) * scale
+       << " p99.9=" << h.percentile(99.9) * scale
+       << " max=" << h.max() * scale << "\n";
+}
+
+} // namespace
+
+void Stats::merge(const Stats& other) {
+    for (size_t i = 0; i < timers.size(); ++i) timers[i].merge(other.timers[i]);
+    for (size_t i = 0; i < dists.size(); ++i) dists[i].merge(other.dists[i]);
+    for (size_t i = 0; i < counters.size(); ++i) counters[i] += other.counters[i];
+}
+
+Stats& local() {
+    return local_state().stats;
+}
+
+void set_thread_name(std::string name) {
+    Slot* slot = local_state().slot;
+    std::lock_guard<std::mutex> guard(slot->lock);
+    slot->name = std::move(name);
+}
+
+void publish() {
+    Local& l = local_state();
+    l.next_publish = TscClock::now() + PUBLISH_TICKS;
+    // Never wait on a reader; the next attempt catches up
+    if (l.slot->lock.try_lock()) {
+        l.slot->published = l.stats;
+        l.slot->lock.unlock();
+    }
+}
+
+void maybe_publish() {
+    if (TscClock::now() >= local_state().next_publish) publish();
+}
+
+std::vector<ThreadStats> collect() {
+    std::vector<Slot*> slots;
+    {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        for (const auto& s : r.slots) slots.push_back(s.get());
+    }
+
+    std::vector<ThreadStats> out;
+    for (Slot* s : slots) {
+        std::lock_guard<std::mutex> guard(s->lock);
+        out.push_back({s->name, s->published});
+    }
+    return out;
+}
+
+void report(std::ostream& os, const std::vector<ThreadStats>& threads, const TscClock& clock) {
+    os << std::fixed << std::setprecision(1);
+    for (const auto& t : threads) {
+        const Stats& s = t.stats;
+        bool empty = true;
+        for (uint64_t c : s.counters) empty &= c == 0;
+        for (const auto& h : s.timers) empty &= h.count() == 0;
+        if (empty) continue;
+
+        os << "[" << t.name << "]";
+        for (size_t i = 0; i < s.counters.size(); ++i) {
+            if (s.counters[i]) os << " " << COUNTER_NAMES[i] << "=" << s.counters[i];
+        }
+        os << "\n";
+        for (size_t i = 0; i < s.timers.size(); ++i) {
+            if (s.timers[i].count()) print_histogram(os, TIMER_NAMES[i], s.timers[i], clock.ns_per_tick());
+        }
+        for (size_t i = 0; i < s.dists.size(); ++i) {
+            if (s.dists[i].count()) print_histogram(os, DIST_NAMES[i], s.dists[i], 1.0);
+        }
+    }
+}
+
+} // namespace ob::instrument
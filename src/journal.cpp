@@ -0,0 +1,296 @@
+#include "journal.h"
+#include "crc32.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace ob {
+
+namespace {
+
+std::string segment_path(const std::string& dir, const std::string& stream, uint32_t number) {
+    char name[32];
+    std::snprintf(name, sizeof(name), ".%06u.journal", number);
+    return dir + "/" + stream + name;
+}
+
+// Segment numbers present for stream, ascending
+std::vector<uint32_t> list_segments(const std::string& dir, const std::string& stream) {
+    std::vector<uint32_t> out;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        std::string name = entry.path().filename().string();
+        std::string prefix = stream + ".";
+        const std::string suffix = ".journal";
+        if (name.size() != prefix.size() + 6 + suffix.size()) continue;
+        if (name.compare(0, prefix.size(), prefix) != 0) continue;
+        if (name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) continue;
+        std::string digits = name.substr(prefix.size(), 6);
+        if (!std::all_of(digits.begin(), digits.end(), ::isdigit)) continue;
+        out.push_back(static_cast<uint32_t>(std::stoul(digits)));
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+// Intact records at the start of a segment, given the seq the first one
+// must carry (0: take whatever the first record says)
+size_t scan_segment(const char* data, size_t bytes, uint64_t& expected_seq) {
+    size_t off = 0;
+    while (off + sizeof(JournalRecord) <= bytes) {
+        JournalRecord r;
+        std::memcpy(&r, data + off, sizeof(r));
+        if (r.seq == 0 || r.crc != journal_crc(r)) break;
+        if (expected_seq != 0 && r.seq != expected_seq) break;
+        expected_seq = r.seq + 1;
+        off += sizeof(JournalRecord);
+    }
+    return off;
+}
+
+void sync_dir(const std::string& dir) {
+    int fd = ::open(dir.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+    close(fd);
+}
+
+} // namespace
+
+uint32_t journal_crc(const JournalRecord& record) {
+    return crc32(&record.msg, sizeof(record.msg), crc32(&record.seq, sizeof(record.seq)));
+}
+
+JournalWriter::JournalWriter(JournalOptions options, std::string stream)
+    : options_(std::move(options)), stream_(std::move(stream)) {
+    // Whole records per segment
+    options_.segment_bytes = std::max(options_.segment_bytes / sizeof(JournalRecord), size_t{1}) *
+                             sizeof(JournalRecord);
+}
+
+JournalWriter::~JournalWriter() {
+    if (map_) sync();
+    close_segment();
+}
+
+bool JournalWriter::open(uint64_t first_seq) {
+    std::error_code ec;
+    std::filesystem::create_directories(options_.dir, ec);
+    if (ec) {
+        std::fprintf(stderr, "journal: cannot create %s: %s\n",
+                     options_.dir.c_str(), ec.message().c_str());
+        return false;
+    }
+
+    auto segments = list_segments(options_.dir, stream_);
+    segments_.clear();
+    if (segments.empty()) {
+        next_seq_ = first_seq;
+        segments_.push_back({0, first_seq});
+        return open_segment(0, true);
+    }
+
+    // Walk the existing segments to find where the intact log ends
+    uint64_t expected = 0;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (!open_segment(segments[i], false)) return false;
+        uint64_t segment_first = expected;
+        size_t end = scan_segment(map_, map_bytes_, expected);
+        if (end > 0 && segment_first == 0) {
+            JournalRecord r;
+            std::memcpy(&r, map_, sizeof(r));
+            segment_first = r.seq;
+        }
+        segments_.push_back({segments[i], segment_first ? segment_first : first_seq});
+        bool last = i + 1 == segments.size();
+        if (!last && end == map_bytes_) {
+            close_segment();
+            continue;
+        }
+        if (!last) {
+            // Replay stops here, so later segments are unreachable; move
+            // them aside (kept for inspection) so the numbers are free
+            std::fprintf(stderr, "journal: %s is damaged before its end; "
+                         "appending there and setting later segments aside\n",
+                         segment_path(options_.dir, stream_, segments[i]).c_str());
+            for (size_t j = i + 1; j < segments.size(); ++j) {
+                std::string path = segment_path(options_.dir, stream_, segments[j]);
+                std::filesystem::rename(path, path + ".damaged", ec);
+            }
+        }
+
+        // Clear whatever lies past the intact prefix. Pages can reach disk
+        // out of order, so a record after a torn one may look valid and
+        // would otherwise come back to life behind the records we append.
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        bool cleared = false;
+        for (size_t off = end; off < map_bytes_;) {
+            size_t chunk = std::min(map_bytes_ - off, page - off % page);
+            char* p = map_ + off;
+            if (std::any_of(p, p + chunk, [](char c) { return c != 0; })) {
+                std::memset(p, 0, chunk);
+                cleared = true;
+            }
+            off += chunk;
+        }
+        if (cleared && msync(map_, map_bytes_, MS_SYNC) != 0) {
+            // Stale records could come back behind the ones appended next
+            std::perror("journal msync");
+            close_segment();
+            return false;
+        }
+        write_off_ = synced_off_ = end;
+        next_seq_ = expected ? expected : first_seq;
+        return true;
+    }
+    return false;
+}
+
+bool JournalWriter::open_segment(uint32_t number, bool create) {
+    std::string path = segment_path(options_.dir, stream_, number);
+    int flags = O_RDWR | (create ? O_CREAT | O_EXCL : 0);
+    fd_ = ::open(path.c_str(), flags, 0644);
+    if (fd_ < 0) {
+        std::perror(path.c_str());
+        return false;
+    }
+
+    auto fail = [&](const char* what) {
+        std::fprintf(stderr, "journal: %s: %s\n", what, path.c_str());
+        close(fd_);
+        fd_ = -1;
+        return false;
+    };
+
+    size_t bytes = options_.segment_bytes;
+    if (create) {
+        if (ftruncate(fd_, static_cast<off_t>(bytes)) != 0) return fail("ftruncate failed");
+#ifdef __linux__
+        // Reserve the blocks now so a full disk is an error here, not a
+        // SIGBUS on some later store into the mapping
+        if (posix_fallocate(fd_, 0, static_cast<off_t>(bytes)) != 0) {
+            return fail("cannot reserve segment space");
+        }
+#endif
+        sync_dir(options_.dir);
+    } else {
+        struct stat st;
+        if (fstat(fd_, &st) != 0) return fail("fstat failed");
+        bytes = static_cast<size_t>(st.st_size) / sizeof(JournalRecord) * sizeof(JournalRecord);
+        if (bytes == 0) return fail("empty segment");
+    }
+
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) return fail("mmap failed");
+    map_ = static_cast<char*>(p);
+    map_bytes_ = bytes;
+    write_off_ = synced_off_ = 0;
+    segment_ = number;
+    return true;
+}
+
+void JournalWriter::close_segment() {
+    if (map_) munmap(map_, map_bytes_);
+    if (fd_ >= 0) close(fd_);
+    map_ = nullptr;
+    map_bytes_ = 0;
+    fd_ = -1;
+}
+
+void JournalWriter::append(const OrderMessage& msg) {
+    if (write_off_ + sizeof(JournalRecord) > map_bytes_) {
+        sync();
+        close_segment();
+        if (!open_segment(segment_ + 1, true)) {
+            std::fprintf(stderr, "journal: cannot roll to segment %u\n", segment_ + 1);
+            std::abort();   // acknowledging unjournaled requests would lose them
+        }
+        segments_.push_back({segment_, next_seq_});
+    }
+
+    JournalRecord r{};
+    r.seq = next_seq_++;
+    r.msg = msg;
+    r.crc = journal_crc(r);
+    std::memcpy(map_ + write_off_, &r, sizeof(r));
+    write_off_ += sizeof(r);
+
+    if (pending_++ == 0) first_pending_ = std::chrono::steady_clock::now();
+}
+
+void JournalWriter::drop_segments_through(uint64_t seq) {
+    size_t drop = 0;
+    // Segment i ends right before segment i + 1 begins
+    while (drop + 1 < segments_.size() && segments_[drop + 1].first_seq <= seq + 1) {
+        std::string path = segment_path(options_.dir, stream_, segments_[drop].number);
+        if (::unlink(path.c_str()) != 0) std::perror(path.c_str());
+        ++drop;
+    }
+    segments_.erase(segments_.begin(), segments_.begin() + drop);
+}
+
+bool JournalWriter::sync_due() const {
+    if (pending_ == 0) return false;
+    if (options_.sync_records == 0 || pending_ >= options_.sync_records) return true;
+    return std::chrono::steady_clock::now() - first_pending_ >= options_.sync_interval;
+}
+
+void JournalWriter::sync() {
+    if (write_off_ > synced_off_) {
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t start = synced_off_ / page * page;
+        if (msync(map_ + start, write_off_ - start, MS_SYNC) != 0) {
+            // The caller acknowledges these requests as durable next
+            std::perror("journal msync");
+            std::abort();
+        }
+        synced_off_ = write_off_;
+    }
+    pending_ = 0;
+}
+
+size_t replay_journal(const std::string& dir, const std::string& stream,
+                      const std::function<void(const JournalRecord&)>& fn) {
+    size_t count = 0;
+    uint64_t expected = 0;
+
+    for (uint32_t number : list_segments(dir, stream)) {
+        std::string path = segment_path(dir, stream, number);
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) break;
+
+        struct stat st;
+        size_t bytes = fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+        void* p = bytes ? mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        close(fd);
+        if (p == MAP_FAILED) break;
+
+#ifdef MADV_SEQUENTIAL
+        madvise(p, bytes, MADV_SEQUENTIAL);
+#endif
+        const char* data = static_cast<const char*>(p);
+        size_t end = scan_segment(data, bytes, expected);
+        for (size_t off = 0; off < end; off += sizeof(JournalRecord)) {
+            JournalRecord r;
+            std::memcpy(&r, data + off, sizeof(r));
+            fn(r);
+            ++count;
+        }
+        munmap(p, bytes);
+
+        // A segment that ends early is where the log ends
+        if (end + sizeof(JournalRecord) <= bytes) break;
+    }
+    return count;
+}
+
+} // namespace ob
@@ -1,21 +1,33 @@
 #include "matching_engine.h"
 #include "csv_parser.h"
 #include <iostream>
-#include <fstream>
 #include <memory>
+#include <string>
 
+// Usage: order-book [FILE] [--threads N]
+//   --threads N  parse FILE with N threads (one of them also matching)
 int main(int argc, char* argv[]) {
     try {
         auto engine = std::make_unique<ob::MatchingEngine>();
         ob::CsvParser parser(*engine);
 
-        if (argc > 1) {
-            std::ifstream file(argv[1]);
-            if (!file.is_open()) {
-                std::cerr << "Error: cannot open file '" << argv[1] << "'\n";
+        std::string path;
+        size_t threads = 1;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--threads" && i + 1 < argc) {
+                threads = std::stoul(argv[++i]);
+            } else {
+                path = arg;
+            }
+        }
+
+        if (!path.empty()) {
+            // Mapped and parsed in place
+            if (!parser.process_file(path, std::cout, threads)) {
+                std::cerr << "Error: cannot open file '" << path << "'\n";
                 return 1;
             }
-            parser.process_stream(file, std::cout);
         } else {
             parser.process_stream(std::cin, std::cout);
         }
@@ -0,0 +1,162 @@
+#include "market_data.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace ob {
+
+namespace {
+
+// Prices use the low 47 bits: distinct for any book narrower than 2^47 ticks
+uint64_t level_key(SymbolId symbol, Side side, Price price) {
+    return (static_cast<uint64_t>(symbol) << 48) | (static_cast<uint64_t>(side) << 47) |
+           (static_cast<uint64_t>(price) & ((uint64_t{1} << 47) - 1));
+}
+
+} // namespace
+
+UdpDepthTransport::UdpDepthTransport(const std::string& address, uint16_t port, int ttl,
+                                     const std::string& interface) {
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+        throw std::runtime_error("bad market data address " + address);
+    }
+
+    fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd_ < 0) {
+        throw std::runtime_error(std::string("market data socket: ") + std::strerror(errno));
+    }
+
+    if (IN_MULTICAST(ntohl(addr.sin_addr.s_addr))) {
+        unsigned char hops = static_cast<unsigned char>(ttl);
+        setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_TTL, &hops, sizeof(hops));
+        unsigned char loop = 1;   // subscribers on this host see the feed too
+        setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+        if (!interface.empty()) {
+            in_addr iface{};
+            if (inet_pton(AF_INET, interface.c_str(), &iface) != 1 ||
+                setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_IF, &iface, sizeof(iface)) != 0) {
+                ::close(fd_);
+                throw std::runtime_error("bad market data interface " + interface);
+            }
+        }
+    }
+
+    addr_.resize(sizeof(addr));
+    std::memcpy(addr_.data(), &addr, sizeof(addr));
+}
+
+UdpDepthTransport::~UdpDepthTransport() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+void UdpDepthTransport::send(const void* data, size_t len) {
+    // Best effort, like the medium: a full socket buffer drops the packet
+    // and receivers see the gap in first_seq
+    ssize_t n = ::sendto(fd_, data, len, MSG_DONTWAIT,
+                         reinterpret_cast<const sockaddr*>(addr_.data()),
+                         static_cast<socklen_t>(addr_.size()));
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        std::perror("market data sendto");
+    }
+}
+
+MarketDataPublisher::MarketDataPublisher(std::unique_ptr<DepthTransport> transport,
+                                         MarketDataOptions options)
+    : transport_(std::move(transport)), options_(options) {
+    packet_.resize(sizeof(DepthPacketHeader) + UPDATES_PER_PACKET * sizeof(DepthUpdate));
+    pending_.reserve(options_.levels);
+    if (options_.conflate) rehash(std::bit_ceil(std::max<size_t>(options_.levels * 2, 16)));
+}
+
+uint32_t MarketDataPublisher::find_or_add(uint64_t key, uint32_t index) {
+    if ((static_cast<size_t>(index) + 1) * 4 > slots_.size() * 3) [[unlikely]] {
+        rehash(slots_.size() * 2);
+    }
+    // Fibonacci hashing: neighbouring prices spread across the table
+    size_t i = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> shift_);
+    while (slots_[i].epoch == epoch_) {
+        if (slots_[i].key == key) return slots_[i].index;
+        i = (i + 1) & mask_;
+    }
+    slots_[i] = {key, index, epoch_};
+    return index;
+}
+
+// Only when an interval outgrows MarketDataOptions::levels
+void MarketDataPublisher::rehash(size_t capacity) {
+    slots_.assign(capacity, Slot{0, 0, 0});
+    mask_ = capacity - 1;
+    shift_ = 64 - static_cast<unsigned>(std::countr_zero(capacity));
+    epoch_ = 1;
+    for (uint32_t k = 0; k < pending_.size(); ++k) {
+        const DepthUpdate& u = pending_[k];
+        find_or_add(level_key(u.symbol_id, static_cast<Side>(u.side), u.price), k);
+    }
+}
+
+void MarketDataPublisher::on_depth(SymbolId symbol, Side side, Price price, Quantity quantity) {
+    if (pending_.empty()) first_pending_ = std::chrono::steady_clock::now();
+
+    if (options_.conflate) {
+        auto next = static_cast<uint32_t>(pending_.size());
+        uint32_t slot = find_or_add(level_key(symbol, side, price), next);
+        if (slot != next) {
+            pending_[slot].quantity = quantity;
+            return;
+        }
+    }
+
+    DepthUpdate u{};
+    u.price = price;
+    u.quantity = quantity;
+    u.symbol_id = symbol;
+    u.side = static_cast<uint8_t>(side);
+    pending_.push_back(u);
+}
+
+bool MarketDataPublisher::flush_due() const {
+    if (pending_.empty()) return false;
+    return options_.interval.count() == 0 ||
+           std::chrono::steady_clock::now() - first_pending_ >= options_.interval;
+}
+
+void MarketDataPublisher::flush() {
+    size_t i = 0;
+    while (i < pending_.size()) {
+        size_t count = std::min(UPDATES_PER_PACKET, pending_.size() - i);
+
+        DepthPacketHeader header{};
+        header.first_seq = next_seq_;
+        header.count = static_cast<uint16_t>(count);
+        header.channel = options_.channel;
+        std::memcpy(packet_.data(), &header, sizeof(header));
+
+        char* out = packet_.data() + sizeof(header);
+        for (size_t k = 0; k < count; ++k) {
+            DepthUpdate u = pending_[i + k];
+            u.seq = next_seq_++;
+            std::memcpy(out + k * sizeof(u), &u, sizeof(u));
+        }
+        transport_->send(packet_.data(), sizeof(header) + count * sizeof(DepthUpdate));
+        i += count;
+    }
+    pending_.clear();
+    if (++epoch_ == 0) {
+        // Wrapped: stale slots could pass for live ones again
+        std::fill(slots_.begin(), slots_.end(), Slot{0, 0, 0});
+        epoch_ = 1;
+    }
+}
+
+} // namespace ob
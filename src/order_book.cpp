@@ -1,100 +1,133 @@
 #include "order_book.h"
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 namespace ob {
 
-void OrderBook::add_order(Order* order) {
-    order_lookup_[order->id] = order;
+template <template <Side> class Levels, typename Index>
+void BasicOrderBook<Levels, Index>::add_order(Order* order) {
+    const OrderInfo& info = order->info();
+    order_lookup_.insert(order->id, order);
 
-    if (order->side == Side::BUY) {
-        bids_[order->price].add(order);
+    if (info.side == Side::BUY) {
+        bids_.add(order);
     } else {
-        asks_[order->price].add(order);
+        asks_.add(order);
     }
+    if (touches_top(info.side, info.price)) refresh_top(info.side);
 }
 
-Order* OrderBook::cancel_order(OrderId order_id) {
-    auto it = order_lookup_.find(order_id);
-    if (it == order_lookup_.end()) {
+template <template <Side> class Levels, typename Index>
+void BasicOrderBook<Levels, Index>::restore_level(Side side, Order* const* orders, size_t count) {
+    if (count == 0) return;
+
+    auto fill = [&](auto& levels) {
+        levels.add(orders[0]);
+        PriceLevel* level = levels.find(orders[0]->info().price);
+        for (size_t i = 1; i < count; ++i) level->add(orders[i]);
+    };
+    if (side == Side::BUY) {
+        fill(bids_);
+    } else {
+        fill(asks_);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        order_lookup_.insert(orders[i]->id, orders[i]);
+    }
+    refresh_top(side);
+}
+
+template <template <Side> class Levels, typename Index>
+Order* BasicOrderBook<Levels, Index>::cancel_order(OrderId order_id) {
+    Order* order = order_lookup_.find(order_id);
+    if (order == nullptr) {
         return nullptr;
     }
+    order_lookup_.erase(order_id);
+    const OrderInfo& info = order->info();
 
-    Order* order = it->second;
-    order_lookup_.erase(it);
-
-    if (order->side == Side::BUY) {
-        auto level_it = bids_.find(order->price);
-        if (level_it != bids_.end()) {
-            level_it->second.remove(order);
-            if (level_it->second.is_empty()) {
-                bids_.erase(level_it);
-            }
-        }
+    if (info.side == Side::BUY) {
+        bids_.remove(order);
     } else {
-        auto level_it = asks_.find(order->price);
-        if (level_it != asks_.end()) {
-            level_it->second.remove(order);
-            if (level_it->second.is_empty()) {
-                asks_.erase(level_it);
-            }
-        }
+        asks_.remove(order);
     }
+    if (info.price == top(info.side).price) refresh_top(info.side);
 
     return order;
 }
 
-std::optional<Price> OrderBook::best_bid() const {
-    if (bids_.empty()) return std::nullopt;
-    return bids_.begin()->first;
+template <template <Side> class Levels, typename Index>
+void BasicOrderBook<Levels, Index>::reduce_order(Order* order, Quantity qty) {
+    const OrderInfo& info = order->info();
+    PriceLevel* level = info.side == Side::BUY ? bids_.find(info.price)
+                                                 : asks_.find(info.price);
+    order->quantity -= qty;
+    level->reduce_quantity(qty);
+    if (info.price == top(info.side).price) refresh_top(info.side);
 }
 
-std::optional<Price> OrderBook::best_ask() const {
-    if (asks_.empty()) return std::nullopt;
-    return asks_.begin()->first;
+template <template <Side> class Levels, typename Index>
+void BasicOrderBook<Levels, Index>::unlink_order(Order* order) {
+    const OrderInfo& info = order->info();
+    if (info.side == Side::BUY) {
+        bids_.remove(order);
+    } else {
+        asks_.remove(order);
+    }
+    if (info.price == top(info.side).price) refresh_top(info.side);
 }
 
-Quantity OrderBook::get_volume_at_price(Side side, Price price) const {
-    if (side == Side::BUY) {
-        auto it = bids_.find(price);
-        return it != bids_.end() ? it->second.total_quantity() : 0;
+template <template <Side> class Levels, typename Index>
+void BasicOrderBook<Levels, Index>::relink_order(Order* order) {
+    const OrderInfo& info = order->info();
+    if (info.side == Side::BUY) {
+        bids_.add(order);
     } else {
-        auto it = asks_.find(price);
-        return it != asks_.end() ? it->second.total_quantity() : 0;
+        asks_.add(order);
     }
+    if (touches_top(info.side, info.price)) refresh_top(info.side);
 }
 
-bool OrderBook::has_order(OrderId id) const {
-    return order_lookup_.count(id) > 0;
+template <template <Side> class Levels, typename Index>
+std::optional<Price> BasicOrderBook<Levels, Index>::best_bid() const {
+    if (top_[0].order_count == 0) return std::nullopt;
+    return top_[0].price;
 }
 
-void OrderBook::remove_from_lookup(OrderId id) {
-    order_lookup_.erase(id);
+template <template <Side> class Levels, typename Index>
+std::optional<Price> BasicOrderBook<Levels, Index>::best_ask() const {
+    if (top_[1].order_count == 0) return std::nullopt;
+    return top_[1].price;
 }
 
-void OrderBook::remove_empty_level(Side side, Price price) {
-    if (side == Side::BUY) {
-        auto it = bids_.find(price);
-        if (it != bids_.end() && it->second.is_empty()) {
-            bids_.erase(it);
-        }
-    } else {
-        auto it = asks_.find(price);
-        if (it != asks_.end() && it->second.is_empty()) {
-            asks_.erase(it);
-        }
-    }
+template <template <Side> class Levels, typename Index>
+Quantity BasicOrderBook<Levels, Index>::get_volume_at_price(Side side, Price price) const {
+    const PriceLevel* level = (side == Side::BUY) ? bids_.find(price) : asks_.find(price);
+    return level ? level->total_quantity() : 0;
 }
 
-void OrderBook::print(std::ostream& os) const {
+template <template <Side> class Levels, typename Index>
+bool BasicOrderBook<Levels, Index>::has_order(OrderId id) const {
+    return order_lookup_.find(id) != nullptr;
+}
+
+template <template <Side> class Levels, typename Index>
+void BasicOrderBook<Levels, Index>::remove_from_lookup(OrderId id) {
+    order_lookup_.erase(id);
+}
+
+template <template <Side> class Levels, typename Index>
+void BasicOrderBook<Levels, Index>::print(std::ostream& os) const {
     os << "=== ORDER BOOK ===\n";
     os << "--- ASKS (lowest first) ---\n";
 
     // Print asks in reverse (highest to lowest) for visual display
     std::vector<std::pair<Price, const PriceLevel*>> ask_levels;
-    for (const auto& [price, level] : asks_) {
+    asks_.for_each([&](Price price, const PriceLevel& level) {
         ask_levels.emplace_back(price, &level);
-    }
+    });
     for (auto it = ask_levels.rbegin(); it != ask_levels.rend(); ++it) {
         os << "  " << std::setw(10) << price_to_string(it->first)
            << "  |  " << std::setw(8) << it->second->total_quantity()
@@ -104,12 +137,16 @@ void OrderBook::print(std::ostream& os) const {
     os << "--- SPREAD ---\n";
 
     os << "--- BIDS (highest first) ---\n";
-    for (const auto& [price, level] : bids_) {
+    bids_.for_each([&](Price price, const PriceLevel& level) {
         os << "  " << std::setw(10) << price_to_string(price)
            << "  |  " << std::setw(8) << level.total_quantity()
            << "  (" << level.order_count() << " orders)\n";
-    }
+    });
     os << "==================\n";
 }
 
+template class BasicOrderBook<MapLevels>;
+template class BasicOrderBook<LadderLevels>;
+template class BasicOrderBook<MapLevels, FlatOrderMap>;
+
 } // namespace ob
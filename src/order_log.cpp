@@ -0,0 +1,129 @@
+#include "order_log.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace ob {
+
+namespace {
+
+constexpr char LOG_MAGIC[8] = {'O', 'B', 'O', 'R', 'D', 'L', 'O', 'G'};
+constexpr uint32_t LOG_VERSION = 1;
+
+bool write_all(int fd, const void* data, size_t len) {
+    const char* p = static_cast<const char*>(data);
+    while (len > 0) {
+        ssize_t n = ::write(fd, p, len);
+        if (n < 0) return false;
+        p += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+OrderLogHeader make_header(uint64_t count) {
+    OrderLogHeader h{};
+    std::memcpy(h.magic, LOG_MAGIC, sizeof(h.magic));
+    h.version = LOG_VERSION;
+    h.record_size = sizeof(OrderLogRecord);
+    h.record_count = count;
+    return h;
+}
+
+} // namespace
+
+OrderLogWriter::~OrderLogWriter() {
+    close();
+}
+
+bool OrderLogWriter::open(const std::string& path) {
+    close();
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        std::perror(path.c_str());
+        return false;
+    }
+    count_ = 0;
+    failed_ = false;
+    buf_.reserve(BUFFER_RECORDS);
+
+    // The count is patched in by close()
+    OrderLogHeader header = make_header(0);
+    failed_ = !write_all(fd_, &header, sizeof(header));
+    return !failed_;
+}
+
+void OrderLogWriter::append(uint64_t timestamp_ns, const OrderMessage& msg) {
+    buf_.push_back({timestamp_ns, msg});
+    ++count_;
+    if (buf_.size() == BUFFER_RECORDS) flush();
+}
+
+void OrderLogWriter::flush() {
+    if (!failed_ && !buf_.empty() &&
+        !write_all(fd_, buf_.data(), buf_.size() * sizeof(OrderLogRecord))) {
+        std::perror("order log write");
+        failed_ = true;
+    }
+    buf_.clear();
+}
+
+bool OrderLogWriter::close() {
+    if (fd_ < 0) return !failed_;
+    flush();
+    OrderLogHeader header = make_header(count_);
+    if (!failed_ && ::pwrite(fd_, &header, sizeof(header), 0) != sizeof(header)) {
+        std::perror("order log header");
+        failed_ = true;
+    }
+    ::close(fd_);
+    fd_ = -1;
+    return !failed_;
+}
+
+OrderLogReader::~OrderLogReader() {
+    if (map_) munmap(map_, map_bytes_);
+}
+
+bool OrderLogReader::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    size_t bytes = fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    void* p = bytes >= sizeof(OrderLogHeader)
+                  ? mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0)
+                  : MAP_FAILED;
+    ::close(fd);
+    if (p == MAP_FAILED) return false;
+
+    OrderLogHeader header;
+    std::memcpy(&header, p, sizeof(header));
+    if (std::memcmp(header.magic, LOG_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != LOG_VERSION || header.record_size != sizeof(OrderLogRecord)) {
+        munmap(p, bytes);
+        return false;
+    }
+
+#ifdef MADV_SEQUENTIAL
+    madvise(p, bytes, MADV_SEQUENTIAL);
+#endif
+    if (map_) munmap(map_, map_bytes_);
+    map_ = p;
+    map_bytes_ = bytes;
+
+    // A writer that died before close() left count 0: trust the file size
+    uint64_t on_disk = (bytes - sizeof(OrderLogHeader)) / sizeof(OrderLogRecord);
+    uint64_t count = header.record_count ? std::min(header.record_count, on_disk) : on_disk;
+    records_ = std::span<const OrderLogRecord>(
+        reinterpret_cast<const OrderLogRecord*>(static_cast<const char*>(p) + sizeof(header)),
+        static_cast<size_t>(count));
+    return true;
+}
+
+} // namespace ob
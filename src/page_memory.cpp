@@ -0,0 +1,154 @@
+#include "page_memory.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ob {
+
+namespace {
+
+size_t round_up(size_t n, size_t to) {
+    return (n + to - 1) / to * to;
+}
+
+size_t base_page() {
+    static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return page;
+}
+
+// Prefer node for the pages of [addr, addr + len) not yet faulted in.
+// Raw syscall, so there is no libnuma dependency; best effort.
+void prefer_node(void* addr, size_t len, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr int MPOL_PREFERRED_MODE = 1;   // MPOL_PREFERRED in <numaif.h>
+    constexpr int MASK_BITS = 8 * sizeof(unsigned long);
+    if (node < 0 || node >= MASK_BITS) return;
+    unsigned long mask = 1ul << node;
+    ::syscall(SYS_mbind, addr, len, MPOL_PREFERRED_MODE, &mask, MASK_BITS + 1, 0);
+#else
+    (void)addr;
+    (void)len;
+    (void)node;
+#endif
+}
+
+// Touch one byte per page to fault the range in now
+void prefault(char* data, size_t size, size_t page) {
+    for (size_t off = 0; off < size; off += page) {
+        static_cast<volatile char*>(data)[off] = 0;
+    }
+}
+
+} // namespace
+
+size_t PageMemory::page_bytes(PageSize pages) {
+    switch (pages) {
+        case PageSize::HUGE_2MB: return size_t{2} << 20;
+        case PageSize::HUGE_1GB: return size_t{1} << 30;
+        case PageSize::NORMAL: break;
+    }
+    return base_page();
+}
+
+PageMemory::PageMemory(size_t bytes, PageSize pages, bool lock, int numa_node) {
+    size_ = round_up(bytes ? bytes : 1, page_bytes(pages));
+
+#if defined(MAP_HUGETLB) && defined(MAP_POPULATE)
+    if (pages != PageSize::NORMAL) {
+        // Populating has to wait for the NUMA binding
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+        if (numa_node < 0) flags |= MAP_POPULATE;
+#if defined(MAP_HUGE_2MB) && defined(MAP_HUGE_1GB)
+        flags |= pages == PageSize::HUGE_1GB ? MAP_HUGE_1GB : MAP_HUGE_2MB;
+#endif
+        void* p = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (p != MAP_FAILED) {
+            map_base_ = p;
+            map_size_ = size_;
+            huge_ = true;
+            if (numa_node >= 0) {
+                prefer_node(p, size_, numa_node);
+                prefault(static_cast<char*>(p), size_, page_bytes(pages));
+            }
+        }
+    }
+#endif
+
+    if (!map_base_) {
+        // Ordinary pages. For a huge page request, over-map so the range
+        // can start on a 2 MB boundary, which THP needs to use huge pages.
+        size_t align = pages == PageSize::NORMAL ? base_page() : page_bytes(PageSize::HUGE_2MB);
+        size_t slack = align > base_page() ? align : 0;
+        void* p = ::mmap(nullptr, size_ + slack, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) throw std::bad_alloc();
+        map_base_ = p;
+        map_size_ = size_ + slack;
+
+        auto start = reinterpret_cast<uintptr_t>(p);
+        data_ = reinterpret_cast<char*>(round_up(start, align));
+#ifdef MADV_HUGEPAGE
+        if (pages != PageSize::NORMAL) ::madvise(data_, size_, MADV_HUGEPAGE);
+#endif
+        if (numa_node >= 0) prefer_node(data_, size_, numa_node);
+        prefault(data_, size_, base_page());
+    } else {
+        data_ = static_cast<char*>(map_base_);
+    }
+
+    if (lock) {
+        if (::mlock(data_, size_) != 0) {
+            int err = errno;
+            release();
+            throw std::runtime_error(std::string("mlock: ") + std::strerror(err));
+        }
+        locked_ = true;
+    }
+}
+
+PageMemory::~PageMemory() {
+    release();
+}
+
+PageMemory::PageMemory(PageMemory&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      map_base_(std::exchange(other.map_base_, nullptr)),
+      map_size_(std::exchange(other.map_size_, 0)),
+      huge_(std::exchange(other.huge_, false)),
+      locked_(std::exchange(other.locked_, false)) {}
+
+PageMemory& PageMemory::operator=(PageMemory&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        map_base_ = std::exchange(other.map_base_, nullptr);
+        map_size_ = std::exchange(other.map_size_, 0);
+        huge_ = std::exchange(other.huge_, false);
+        locked_ = std::exchange(other.locked_, false);
+    }
+    return *this;
+}
+
+void PageMemory::release() {
+    if (map_base_) {
+        if (locked_) ::munlock(data_, size_);
+        ::munmap(map_base_, map_size_);
+    }
+    data_ = nullptr;
+    map_base_ = nullptr;
+    size_ = map_size_ = 0;
+    huge_ = locked_ = false;
+}
+
+} // namespace ob
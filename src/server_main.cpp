@@ -0,0 +1,174 @@
+#include "tcp_server.h"
+#include "instrument.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Usage: order-book-server [port] [--shards N] [--cores c0,c1,...]
+//                          [--io epoll|io_uring|kqueue]
+//                          [--journal DIR] [--sync-records N] [--sync-us N]
+//                          [--snapshot-records N]
+//                          [--md ADDR:PORT] [--md-interval-us N] [--md-no-conflate]
+//                          [--pool-capacity N] [--huge-pages 2m|1g] [--mlock]
+//                          [--pool-no-grow] [--stats-interval-s N]
+//                          [--busy-poll] [--io-core C] [--socket-busy-poll-us N]
+//                          [--shm NAME] [--shm-slots N] [--shm-wait spin|futex]
+//
+// --busy-poll spins the I/O thread and every shard instead of letting them
+// sleep between requests; give each its own isolated core with --io-core
+// and --cores (e.g. booted with isolcpus=).
+//
+// --shm NAME also serves clients on this host through shared memory
+// (/dev/shm/NAME, see tools/shm_client.h).
+int main(int argc, char* argv[]) {
+    uint16_t port = 9000;
+    ob::RouterOptions options;
+    ob::ServerOptions server_options;
+    int stats_interval_s = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--shards" && i + 1 < argc) {
+            options.shards = std::stoul(argv[++i]);
+        } else if (arg == "--cores" && i + 1 < argc) {
+            std::stringstream ss(argv[++i]);
+            std::string core;
+            while (std::getline(ss, core, ',')) {
+                options.cores.push_back(std::stoi(core));
+            }
+        } else if (arg == "--io" && i + 1 < argc) {
+            server_options.backend = argv[++i];
+        } else if (arg == "--journal" && i + 1 < argc) {
+            options.journal.dir = argv[++i];
+        } else if (arg == "--sync-records" && i + 1 < argc) {
+            options.journal.sync_records = std::stoul(argv[++i]);
+        } else if (arg == "--sync-us" && i + 1 < argc) {
+            options.journal.sync_interval = std::chrono::microseconds(std::stol(argv[++i]));
+        } else if (arg == "--snapshot-records" && i + 1 < argc) {
+            options.snapshot_records = std::stoul(argv[++i]);
+        } else if (arg == "--md" && i + 1 < argc) {
+            std::string target = argv[++i];
+            size_t colon = target.rfind(':');
+            options.market_data_address = target.substr(0, colon);
+            if (colon != std::string::npos) {
+                options.market_data_port = static_cast<uint16_t>(std::stoi(target.substr(colon + 1)));
+            }
+        } else if (arg == "--md-interval-us" && i + 1 < argc) {
+            options.market_data.interval = std::chrono::microseconds(std::stol(argv[++i]));
+        } else if (arg == "--md-no-conflate") {
+            options.market_data.conflate = false;
+        } else if (arg == "--pool-capacity" && i + 1 < argc) {
+            options.pool.capacity = std::stoul(argv[++i]);
+        } else if (arg == "--huge-pages" && i + 1 < argc) {
+            std::string size = argv[++i];
+            if (size == "2m") {
+                options.pool.pages = ob::PageSize::HUGE_2MB;
+            } else if (size == "1g") {
+                options.pool.pages = ob::PageSize::HUGE_1GB;
+            } else {
+                std::cerr << "Error: --huge-pages takes 2m or 1g\n";
+                return 1;
+            }
+        } else if (arg == "--mlock") {
+            options.pool.lock = true;
+        } else if (arg == "--pool-no-grow") {
+            options.pool.grow = false;
+        } else if (arg == "--stats-interval-s" && i + 1 < argc) {
+            stats_interval_s = std::stoi(argv[++i]);
+        } else if (arg == "--busy-poll") {
+            server_options.busy_poll = true;
+            options.busy_poll = true;
+        } else if (arg == "--io-core" && i + 1 < argc) {
+            server_options.core = std::stoi(argv[++i]);
+        } else if (arg == "--socket-busy-poll-us" && i + 1 < argc) {
+            server_options.socket_busy_poll_us = std::stoi(argv[++i]);
+        } else if (arg == "--shm" && i + 1 < argc) {
+            server_options.shm_name = argv[++i];
+            if (server_options.shm_name.front() != '/') {
+                server_options.shm_name.insert(0, "/");
+            }
+        } else if (arg == "--shm-slots" && i + 1 < argc) {
+            server_options.shm_slots = std::stoul(argv[++i]);
+        } else if (arg == "--shm-wait" && i + 1 < argc) {
+            std::string mode = argv[++i];
+            if (mode == "spin") {
+                server_options.shm_wait = ob::ShmWait::SPIN;
+            } else if (mode == "futex") {
+                server_options.shm_wait = ob::ShmWait::FUTEX;
+            } else {
+                std::cerr << "Error: --shm-wait takes spin or futex\n";
+                return 1;
+            }
+        } else {
+            port = static_cast<uint16_t>(std::stoi(arg));
+        }
+    }
+
+    bool all_pinned = server_options.core >= 0 && options.cores.size() >= options.shards;
+    if (server_options.busy_poll && !all_pinned) {
+        std::cerr << "Warning: --busy-poll spins every thread; "
+                     "pin them with --io-core and --cores\n";
+    }
+
+    // Shard pools are mapped (and locked) here, so this can throw too
+    std::unique_ptr<ob::EngineRouter> owned_router;
+    try {
+        owned_router = std::make_unique<ob::EngineRouter>(options);
+        if (options.pool.pages != ob::PageSize::NORMAL && !owned_router->huge_pages()) {
+            std::cerr << "Warning: no reserved huge pages for the order pool; "
+                         "using transparent huge pages\n";
+        }
+        owned_router->start();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    ob::EngineRouter& router = *owned_router;
+    if (router.recovered() > 0) {
+        std::cout << "Recovered " << router.recovered() << " requests from "
+                  << options.journal.dir << "\n";
+    }
+
+    // Stats go to stderr on a timer rather than over the order protocol:
+    // a report does not fit the fixed 32-byte response
+    std::atomic<bool> reporting{stats_interval_s > 0};
+    std::thread reporter;
+#ifdef OB_INSTRUMENT
+    ob::TscClock clock;
+    if (reporting) {
+        reporter = std::thread([&] {
+            auto next = std::chrono::steady_clock::now();
+            while (reporting) {
+                next += std::chrono::seconds(stats_interval_s);
+                while (reporting && std::chrono::steady_clock::now() < next) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+                if (reporting) ob::instrument::report(std::cerr, ob::instrument::collect(), clock);
+            }
+        });
+    }
+#else
+    if (reporting) {
+        std::cerr << "Warning: --stats-interval-s needs a build with -DOB_INSTRUMENT=ON\n";
+        reporting = false;
+    }
+#endif
+
+    ob::TcpServer server(port, router, server_options);
+    server.run();
+
+    router.stop();
+    if (reporter.joinable()) {
+        reporting = false;
+        reporter.join();
+#ifdef OB_INSTRUMENT
+        ob::instrument::report(std::cerr, ob::instrument::collect(), clock);
+#endif
+    }
+    return 0;
+}
@@ -0,0 +1,280 @@
+#include "shm_transport.h"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace ob {
+
+namespace {
+
+std::runtime_error shm_error(const std::string& what, const std::string& name) {
+    return std::runtime_error(what + " " + name + ": " + std::strerror(errno));
+}
+
+uint32_t* futex_word(std::atomic<uint32_t>& a) {
+    return reinterpret_cast<uint32_t*>(&a);
+}
+
+} // namespace
+
+void ShmDoorbell::ring() {
+    seq.fetch_add(1);
+    if (waiting.load()) {
+#ifdef __linux__
+        ::syscall(SYS_futex, futex_word(seq), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+}
+
+void ShmDoorbell::sleep(uint32_t seen, int64_t timeout_us) {
+#ifdef __linux__
+    timespec ts{};
+    if (timeout_us >= 0) {
+        ts.tv_sec = timeout_us / 1'000'000;
+        ts.tv_nsec = (timeout_us % 1'000'000) * 1000;
+    }
+    // Not FUTEX_PRIVATE_FLAG: the word is shared between processes
+    ::syscall(SYS_futex, futex_word(seq), FUTEX_WAIT, seen,
+              timeout_us >= 0 ? &ts : nullptr, nullptr, 0);
+#else
+    (void)seen;
+    ::usleep(timeout_us >= 0 && timeout_us < 50 ? static_cast<useconds_t>(timeout_us) : 50);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// ShmMapping
+
+ShmMapping ShmMapping::create(const std::string& name, size_t bytes) {
+    // A segment left by a server that died is replaced, not reused
+    ::shm_unlink(name.c_str());
+    int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) throw shm_error("shm_open", name);
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        int err = errno;
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        errno = err;
+        throw shm_error("ftruncate", name);
+    }
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        throw shm_error("mmap", name);
+    }
+
+    ShmMapping m;
+    m.data_ = p;
+    m.size_ = bytes;
+    m.unlink_name_ = name;
+    return m;
+}
+
+ShmMapping ShmMapping::open(const std::string& name) {
+    int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) throw shm_error("shm_open", name);
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(ShmSegment))) {
+        ::close(fd);
+        throw std::runtime_error("shm segment " + name + " is not an order-book segment");
+    }
+    size_t bytes = static_cast<size_t>(st.st_size);
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) throw shm_error("mmap", name);
+
+    ShmMapping m;
+    m.data_ = p;
+    m.size_ = bytes;
+    return m;
+}
+
+ShmMapping::ShmMapping(ShmMapping&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      unlink_name_(std::move(other.unlink_name_)) {
+    other.unlink_name_.clear();
+}
+
+ShmMapping& ShmMapping::operator=(ShmMapping&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        unlink_name_ = std::move(other.unlink_name_);
+        other.unlink_name_.clear();
+    }
+    return *this;
+}
+
+ShmMapping::~ShmMapping() {
+    release();
+}
+
+void ShmMapping::release() {
+    if (data_) ::munmap(data_, size_);
+    if (!unlink_name_.empty()) ::shm_unlink(unlink_name_.c_str());
+    data_ = nullptr;
+    size_ = 0;
+    unlink_name_.clear();
+}
+
+// ---------------------------------------------------------------------------
+// ShmServer
+
+ShmServer::ShmServer(const std::string& name, size_t slots, ShmWait wait)
+    : mapping_(ShmMapping::create(name, ShmSegment::bytes(slots ? slots : 1))),
+      wait_(wait),
+      channels_(slots ? slots : 1) {
+    segment_ = new (mapping_.data()) ShmSegment();
+    segment_->slot_count = static_cast<uint32_t>(channels_.size());
+    for (uint32_t i = 0; i < segment_->slot_count; ++i) {
+        new (&segment_->slots()[i]) ShmSlot();
+    }
+    // Publish the layout last: a client checks magic before anything else
+    segment_->version = ShmSegment::VERSION;
+    std::atomic_ref<uint32_t>(segment_->magic).store(ShmSegment::MAGIC, std::memory_order_release);
+
+    if (wait_ == ShmWait::FUTEX) {
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, notify_) != 0) {
+            throw std::runtime_error(std::string("socketpair: ") + std::strerror(errno));
+        }
+        ::fcntl(notify_[0], F_SETFL, ::fcntl(notify_[0], F_GETFL, 0) | O_NONBLOCK);
+        ::fcntl(notify_[1], F_SETFL, ::fcntl(notify_[1], F_GETFL, 0) | O_NONBLOCK);
+        watcher_ = std::make_unique<std::thread>([this] { watch(); });
+    }
+}
+
+ShmServer::~ShmServer() {
+    segment_->server_alive.store(0);
+    for (uint32_t i = 0; i < segment_->slot_count; ++i) {
+        segment_->slots()[i].response_bell.ring();   // let sleeping clients see it
+    }
+    if (watcher_) {
+        stop_ = true;
+        segment_->request_bell.ring();
+        watcher_->join();
+    }
+    for (int fd : notify_) {
+        if (fd >= 0) ::close(fd);
+    }
+}
+
+// FUTEX mode: sleep on the request doorbell and poke the I/O thread's
+// event loop through the socketpair whenever a client rings
+void ShmServer::watch() {
+    uint32_t seen = segment_->request_bell.seq.load();
+    while (!stop_) {
+        segment_->request_bell.wait([&] { return segment_->request_bell.seq.load() != seen; },
+                                    100'000);
+        uint32_t now = segment_->request_bell.seq.load();
+        if (now != seen) {
+            seen = now;
+            char byte = 0;
+            // A full socketpair already has a wakeup pending
+            [[maybe_unused]] ssize_t n = ::write(notify_[1], &byte, 1);
+        }
+    }
+}
+
+void ShmServer::drain_notify() {
+    char buf[256];
+    while (::read(notify_[0], buf, sizeof(buf)) > 0) {}
+}
+
+void ShmServer::reset_slot(uint32_t index) {
+    ShmSlot* slot = &segment_->slots()[index];
+    std::destroy_at(slot);
+    new (slot) ShmSlot();   // state FREE, empty rings
+}
+
+void ShmServer::check_slots() {
+    bool check_liveness = ++polls_ % LIVENESS_POLLS == 0;
+    for (uint32_t i = 0; i < channels_.size(); ++i) {
+        Channel& ch = channels_[i];
+        ShmSlot& slot = segment_->slots()[i];
+        uint32_t state = slot.state.load(std::memory_order_acquire);
+
+        if (state == ShmSlot::ATTACHED && ch.session == 0) {
+            ch.session = (next_generation_++ << 32) | SESSION_FLAG | i;
+            ch.backlog.clear();
+            ch.session_flags = 0;
+            ch.first_message = true;
+            ++attached_;
+        } else if (ch.session != 0 &&
+                   (state == ShmSlot::CLOSING ||
+                    (check_liveness && ::kill(slot.pid, 0) != 0 && errno == ESRCH))) {
+            // Responses still in flight for the old session are dropped by send()
+            ch.session = 0;
+            ch.backlog.clear();
+            --attached_;
+            reset_slot(i);
+        } else if (ch.session == 0 &&
+                   (state == ShmSlot::CLOSING ||
+                    (state == ShmSlot::EVICTED && check_liveness &&
+                     ::kill(slot.pid, 0) != 0 && errno == ESRCH))) {
+            reset_slot(i);   // evicted, and now gone
+        }
+    }
+}
+
+bool ShmServer::send(uint64_t session, const ResponseMessage& msg) {
+    uint32_t index = static_cast<uint32_t>(session & (SESSION_FLAG - 1));
+    if (index >= channels_.size()) return false;
+    Channel& ch = channels_[index];
+    if (ch.session != session) return false;
+
+    ShmSlot& slot = segment_->slots()[index];
+    if (!ch.backlog.empty() || !slot.responses.try_push(msg)) {
+        ch.backlog.push_back(msg);
+    }
+    if (!ch.dirty) {
+        ch.dirty = true;
+        dirty_.push_back(index);
+    }
+    return true;
+}
+
+void ShmServer::flush() {
+    for (uint32_t index : dirty_) {
+        Channel& ch = channels_[index];
+        ch.dirty = false;
+        if (ch.session == 0) continue;
+        ShmSlot& slot = segment_->slots()[index];
+
+        if (!ch.backlog.empty()) {
+            size_t pushed = slot.responses.push_bulk(ch.backlog.data(), ch.backlog.size());
+            ch.backlog.erase(ch.backlog.begin(), ch.backlog.begin() + pushed);
+            if (ch.backlog.size() > MAX_BACKLOG) {
+                // Not reading its responses; cut it off rather than buffer forever
+                slot.state.store(ShmSlot::EVICTED, std::memory_order_release);
+                ch.session = 0;
+                ch.backlog.clear();
+                --attached_;
+            } else if (!ch.backlog.empty()) {
+                ch.dirty = true;   // retried on the next flush
+            }
+        }
+        slot.response_bell.ring();
+    }
+    // Keep the ones still backed up
+    std::erase_if(dirty_, [&](uint32_t index) { return !channels_[index].dirty; });
+}
+
+} // namespace ob
@@ -0,0 +1,133 @@
+#include "snapshot.h"
+#include "crc32.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <filesystem>
+
+namespace ob {
+
+namespace {
+
+constexpr char SNAPSHOT_MAGIC[8] = {'O', 'B', 'S', 'N', 'A', 'P', '0', '1'};
+constexpr size_t WRITE_CHUNK = 1u << 20;
+
+bool write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = ::write(fd, data, len);
+        if (n < 0) return false;
+        data += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+SnapshotWriter::SnapshotWriter(std::string path)
+    : path_(std::move(path)), tmp_path_(path_ + ".tmp") {
+    fd_ = ::open(tmp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        std::perror(tmp_path_.c_str());
+        failed_ = true;
+        return;
+    }
+    // Header goes in last, once the body's size and crc are known
+    SnapshotHeader blank{};
+    buf_.reserve(WRITE_CHUNK);
+    failed_ = !write_all(fd_, reinterpret_cast<const char*>(&blank), sizeof(blank));
+}
+
+SnapshotWriter::~SnapshotWriter() {
+    if (fd_ >= 0) ::close(fd_);
+    if (!finished_) ::unlink(tmp_path_.c_str());
+}
+
+void SnapshotWriter::write(const void* data, size_t len) {
+    crc_ = crc32(data, len, crc_);
+    body_bytes_ += len;
+    const char* p = static_cast<const char*>(data);
+    buf_.insert(buf_.end(), p, p + len);
+    if (buf_.size() >= WRITE_CHUNK) flush_buffer();
+}
+
+void SnapshotWriter::flush_buffer() {
+    if (!failed_ && !write_all(fd_, buf_.data(), buf_.size())) failed_ = true;
+    buf_.clear();
+}
+
+bool SnapshotWriter::finish(uint64_t journal_seq) {
+    flush_buffer();
+    if (failed_) return false;
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.journal_seq = journal_seq;
+    header.body_bytes = body_bytes_;
+    header.engine_count = engines_;
+    header.body_crc = crc_;
+
+    if (::pwrite(fd_, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) ||
+        ::fsync(fd_) != 0) {
+        std::perror(tmp_path_.c_str());
+        failed_ = true;
+        return false;
+    }
+    ::close(fd_);
+    fd_ = -1;
+
+    if (::rename(tmp_path_.c_str(), path_.c_str()) != 0) {
+        std::perror(path_.c_str());
+        failed_ = true;
+        return false;
+    }
+    finished_ = true;
+
+    // Make the rename itself durable
+    std::string dir = std::filesystem::path(path_).parent_path().string();
+    int dfd = ::open(dir.empty() ? "." : dir.c_str(), O_RDONLY);
+    if (dfd >= 0) {
+        ::fsync(dfd);
+        ::close(dfd);
+    }
+    return true;
+}
+
+SnapshotReader::~SnapshotReader() {
+    if (data_) munmap(const_cast<char*>(data_), size_);
+}
+
+bool SnapshotReader::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    size_t bytes = fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    void* p = bytes >= sizeof(SnapshotHeader)
+                  ? mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0)
+                  : MAP_FAILED;
+    close(fd);
+    if (p == MAP_FAILED) return false;
+
+#ifdef MADV_SEQUENTIAL
+    madvise(p, bytes, MADV_SEQUENTIAL);
+#endif
+    data_ = static_cast<const char*>(p);
+    size_ = bytes;
+
+    const SnapshotHeader& h = header();
+    bool ok = std::memcmp(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic)) == 0 &&
+              h.body_bytes == size_ - sizeof(SnapshotHeader) &&
+              crc32(data_ + sizeof(SnapshotHeader), h.body_bytes) == h.body_crc;
+    if (!ok) {
+        munmap(p, bytes);
+        data_ = nullptr;
+        size_ = 0;
+    }
+    return ok;
+}
+
+} // namespace ob
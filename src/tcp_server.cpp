@@ -1,7 +1,9 @@
 #include "tcp_server.h"
+#include "backoff.h"
+#include "cpu_affinity.h"
+#include "instrument.h"
 
 #include <sys/socket.h>
-#include <sys/event.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <unistd.h>
@@ -11,18 +13,21 @@
 #include <cstring>
 #include <iostream>
 #include <algorithm>
+#include <string>
 
 namespace ob {
 
 static volatile sig_atomic_t g_shutdown = 0;
 static void signal_handler(int) { g_shutdown = 1; }
 
-TcpServer::TcpServer(uint16_t port, MatchingEngine& engine)
-    : port_(port), engine_(engine) {}
+TcpServer::TcpServer(uint16_t port, EngineRouter& router, ServerOptions options)
+    : port_(port), router_(router), options_(std::move(options)) {}
 
 TcpServer::~TcpServer() {
-    if (kqueue_fd_ >= 0) close(kqueue_fd_);
-    for (auto& c : clients_) close(c.fd);
+    loop_.reset();
+    for (auto& c : clients_) {
+        if (c.fd >= 0) close(c.fd);
+    }
     if (listen_fd_ >= 0) close(listen_fd_);
 }
 
@@ -31,6 +36,31 @@ void TcpServer::set_nonblocking(int fd) {
     fcntl(fd, F_SETFL, flags | O_NONBLOCK);
 }
 
+// Options that must be set on each connection: accepted sockets don't
+// reliably inherit them from the listener
+void TcpServer::tune_client(int fd) {
+    int opt = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+
+#ifdef __linux__
+    if (options_.core >= 0) {
+        setsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &options_.core, sizeof(options_.core));
+    }
+#ifdef SO_BUSY_POLL
+    if (options_.busy_poll && options_.socket_busy_poll_us > 0) {
+        // Spin in the driver for arrivals on a blocking receive rather
+        // than waiting for the interrupt
+        if (setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &options_.socket_busy_poll_us,
+                       sizeof(options_.socket_busy_poll_us)) < 0 && !busy_poll_warned_) {
+            std::cerr << "Warning: SO_BUSY_POLL: " << std::strerror(errno)
+                      << " (needs CAP_NET_ADMIN above net.core.busy_read)\n";
+            busy_poll_warned_ = true;
+        }
+    }
+#endif
+#endif
+}
+
 void TcpServer::setup_listener() {
     listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
     if (listen_fd_ < 0) {
@@ -66,128 +96,280 @@ void TcpServer::setup_listener() {
     set_nonblocking(listen_fd_);
 }
 
-void TcpServer::accept_client() {
-    sockaddr_in client_addr{};
-    socklen_t len = sizeof(client_addr);
-    int client_fd = accept(listen_fd_, (sockaddr*)&client_addr, &len);
-    if (client_fd < 0) return;
+void TcpServer::accept_clients() {
+    // Take every pending connection: edge-triggered and multishot
+    // backends won't report the listener again for ones already queued
+    while (true) {
+        sockaddr_in client_addr{};
+        socklen_t len = sizeof(client_addr);
+        int client_fd = accept(listen_fd_, (sockaddr*)&client_addr, &len);
+        if (client_fd < 0) return;
 
-    set_nonblocking(client_fd);
+        set_nonblocking(client_fd);
+        tune_client(client_fd);
 
-    int opt = 1;
-    setsockopt(client_fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
-
-    // Register with kqueue
-    struct kevent ev;
-    EV_SET(&ev, client_fd, EVFILT_READ, EV_ADD, 0, 0, nullptr);
-    kevent(kqueue_fd_, &ev, 1, nullptr, 0, nullptr);
+        if (!loop_->add_client(client_fd)) {
+            close(client_fd);
+            continue;
+        }
 
-    ClientState cs;
-    cs.fd = client_fd;
-    cs.bytes_read = 0;
-    clients_.push_back(cs);
+        if (static_cast<size_t>(client_fd) >= clients_.size()) {
+            clients_.resize(client_fd + 1);
+        }
+        ClientState& cs = clients_[client_fd];
+        cs.fd = client_fd;
+        cs.session = (next_generation_++ << 32) | static_cast<uint32_t>(client_fd);
+        if (!cs.recv_buf) cs.recv_buf = std::make_unique<char[]>(RECV_BUFFER_SIZE);
+        cs.recv_len = 0;
+        cs.send_buf.clear();
+        cs.send_off = 0;
+        cs.want_writable = false;
+        cs.session_flags = 0;
+        cs.first_message = true;
+        cs.frame_open = false;
+
+        std::cout << "Client connected (fd=" << client_fd << ")\n";
+    }
+}
 
-    std::cout << "Client connected (fd=" << client_fd << ")\n";
+TcpServer::ClientState* TcpServer::find_client(int fd) {
+    if (fd < 0 || static_cast<size_t>(fd) >= clients_.size()) return nullptr;
+    ClientState& c = clients_[fd];
+    return c.fd == fd ? &c : nullptr;
 }
 
 void TcpServer::remove_client(int client_fd) {
-    struct kevent ev;
-    EV_SET(&ev, client_fd, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
-    kevent(kqueue_fd_, &ev, 1, nullptr, 0, nullptr);
+    ClientState* client = find_client(client_fd);
+    if (!client) return;
 
+    loop_->remove_client(client_fd);
     close(client_fd);
-    clients_.erase(
-        std::remove_if(clients_.begin(), clients_.end(),
-            [client_fd](const ClientState& c) { return c.fd == client_fd; }),
-        clients_.end());
+
+    // Keep the buffers for whoever gets this fd next; a stale dirty_ entry
+    // finds an empty send_buf
+    client->fd = -1;
+    client->session = 0;
+    client->recv_len = 0;
+    client->send_buf.clear();
+    client->send_off = 0;
+    client->frame_open = false;
 
     std::cout << "Client disconnected (fd=" << client_fd << ")\n";
 }
 
-void TcpServer::handle_client_data(int client_fd) {
-    auto it = std::find_if(clients_.begin(), clients_.end(),
-        [client_fd](const ClientState& c) { return c.fd == client_fd; });
+size_t TcpServer::decode(ClientState& client, const char* data, size_t len) {
+    constexpr size_t MSG_SIZE = sizeof(OrderMessage);
+    size_t used = 0;
+    OrderMessage msg;
+    while (len - used >= MSG_SIZE) {
+        OB_TIME(DECODE);
+        deserialize(data + used, msg);
+        used += MSG_SIZE;
+        if (client.first_message && open_session(client, msg)) continue;
+        submit(client.session, msg, client.session_flags);
+    }
+    return used;
+}
 
-    if (it == clients_.end()) return;
-    ClientState& client = *it;
+// A SESSION request is only honoured first, while nothing is in flight:
+// its ACK is then in order, and so is a switch to FRAMED
+bool TcpServer::open_session(ClientState& client, const OrderMessage& msg) {
+    client.first_message = false;
+    if (msg.msg_type != static_cast<uint8_t>(MsgType::SESSION)) return false;
+    client.session_flags = msg.flags;
+    queue_response(client, make_ack(msg.symbol_id, 0));
+    return true;
+}
 
-    constexpr size_t MSG_SIZE = sizeof(OrderMessage);
+void TcpServer::handle_client_data(ClientState& client) {
+    int fd = client.fd;
+    char* buf = client.recv_buf.get();
 
     while (true) {
-        ssize_t n = read(client_fd, client.read_buf + client.bytes_read,
-                         MSG_SIZE - client.bytes_read);
+        size_t space = RECV_BUFFER_SIZE - client.recv_len;
+        ssize_t n = read(fd, buf + client.recv_len, space);
         if (n <= 0) {
-            if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
-                remove_client(client_fd);
+            if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                remove_client(fd);
             }
             return;
         }
 
-        client.bytes_read += n;
+        client.recv_len += n;
+        size_t used = decode(client, buf, client.recv_len);
+        client.recv_len -= used;
+        if (client.recv_len > 0) std::memmove(buf, buf + used, client.recv_len);
 
-        if (client.bytes_read == MSG_SIZE) {
-            OrderMessage msg;
-            deserialize(client.read_buf, msg);
-            process_message(client_fd, msg);
-            client.bytes_read = 0;
-        }
+        // A short read drained the socket; the next arrival is a new edge
+        if (static_cast<size_t>(n) < space) return;
     }
 }
 
-void TcpServer::process_message(int client_fd, const OrderMessage& msg) {
-    MsgType type = static_cast<MsgType>(msg.msg_type);
+void TcpServer::consume(ClientState& client, const char* data, size_t len) {
+    constexpr size_t MSG_SIZE = sizeof(OrderMessage);
+    char* buf = client.recv_buf.get();
+
+    // Finish a message split across receives first
+    if (client.recv_len > 0) {
+        size_t take = std::min(len, MSG_SIZE - client.recv_len);
+        std::memcpy(buf + client.recv_len, data, take);
+        client.recv_len += take;
+        data += take;
+        len -= take;
+        if (client.recv_len < MSG_SIZE) return;
+        decode(client, buf, MSG_SIZE);
+        client.recv_len = 0;
+    }
+
+    // Whole messages straight out of the backend's buffer
+    size_t used = decode(client, data, len);
+    std::memcpy(buf, data + used, len - used);
+    client.recv_len = len - used;
+}
 
-    if (type == MsgType::CANCEL) {
-        bool ok = engine_.cancel_order(msg.order_id);
-        ResponseMessage resp{};
-        resp.msg_type = ok ? static_cast<uint8_t>(MsgType::ACK)
-                           : static_cast<uint8_t>(MsgType::REJECT);
-        resp.order_id = msg.order_id;
-        send_response(client_fd, resp);
+void TcpServer::handle_event(const IoEvent& event) {
+    if (event.fd == listen_fd_) {
+        if (event.flags & IoEvent::READABLE) accept_clients();
+        return;
+    }
+    if (shm_ && event.fd == shm_->notify_fd()) {
+        // Only a wakeup; the rings are polled every pass
+        if (event.flags & IoEvent::DATA) loop_->release(event);
+        if (event.flags & IoEvent::READABLE) shm_->drain_notify();
         return;
     }
 
-    if (type == MsgType::NEW_ORDER) {
-        Side side = static_cast<Side>(msg.side);
-        OrderType otype = static_cast<OrderType>(msg.order_type);
+    if (event.flags & IoEvent::DATA) {
+        if (ClientState* client = find_client(event.fd)) {
+            consume(*client, event.data, event.len);
+        }
+        loop_->release(event);
+    }
+    if (event.flags & IoEvent::READABLE) {
+        if (ClientState* client = find_client(event.fd)) handle_client_data(*client);
+    }
+    if (event.flags & IoEvent::WRITABLE) {
+        if (ClientState* client = find_client(event.fd)) flush_client(*client);
+    }
+    if (event.flags & IoEvent::HANGUP) {
+        remove_client(event.fd);
+    }
+}
 
-        auto trades = engine_.process_order(side, otype, msg.price, msg.quantity);
+void TcpServer::submit(uint64_t session, const OrderMessage& msg, uint8_t session_flags) {
+    // Everything, including unknown types, goes through the owning shard so
+    // each client sees its responses in request order
+    Backoff backoff;
+    while (!router_.submit(session, msg, session_flags)) {
+        // Request ring full: drain responses so the shard can make progress
+        flush_responses();
+        backoff.idle();
+    }
+}
 
-        // Send ACK with assigned order ID
-        ResponseMessage ack{};
-        ack.msg_type = static_cast<uint8_t>(MsgType::ACK);
-        ack.order_id = engine_.next_order_id() - 1;
-        send_response(client_fd, ack);
+void TcpServer::flush_responses() {
+    responses_.clear();
+    router_.poll_responses(responses_);
+
+    // Coalesce each client's responses, then one send per client
+    {
+        OB_TIME(ENCODE);
+        for (const auto& r : responses_) {
+            if (ShmServer::owns(r.session)) {
+                if (shm_) shm_->send(r.session, r.msg);
+                continue;
+            }
+            ClientState* client = find_client(static_cast<int>(r.session & 0xffffffffu));
+            if (!client || client->session != r.session) continue;   // client went away
+            queue_response(*client, r.msg);
+        }
+    }
 
-        // Send FILL messages for each trade
-        for (const auto& trade : trades) {
-            ResponseMessage fill{};
-            fill.msg_type = static_cast<uint8_t>(MsgType::FILL);
-            fill.order_id = ack.order_id;
-            fill.price = trade.price;
-            fill.quantity = trade.quantity;
-            fill.match_id = (side == Side::BUY) ? trade.seller_order_id : trade.buyer_order_id;
-            send_response(client_fd, fill);
+    for (int fd : dirty_) {
+        ClientState& client = clients_[fd];
+        client.send_dirty = false;
+        // Already waiting for WRITABLE: the flush happens when it arrives,
+        // unless the backlog is already over the limit
+        if (client.fd < 0) continue;
+        if (!client.want_writable ||
+            client.send_buf.size() - client.send_off > MAX_SEND_BACKLOG) {
+            flush_client(client);
         }
-        return;
     }
+    dirty_.clear();
+    if (shm_) shm_->flush();
+}
+
+// Append msg to the client's send buffer; on FRAMED sessions into the open
+// frame, patching its header, or a new one
+void TcpServer::queue_response(ClientState& client, const ResponseMessage& msg) {
+    bool framed = client.session_flags & SessionFlags::FRAMED;
+    if (framed && (!client.frame_open || client.frame_count == MAX_FRAME_MESSAGES)) {
+        client.frame_open = true;
+        client.frame_at = client.send_buf.size();
+        client.frame_count = 0;
+        client.send_buf.resize(client.frame_at + sizeof(FrameHeader));
+    }
+
+    size_t off = client.send_buf.size();
+    client.send_buf.resize(off + sizeof(ResponseMessage));
+    serialize(msg, client.send_buf.data() + off);
 
-    // Unknown message type
-    ResponseMessage reject{};
-    reject.msg_type = static_cast<uint8_t>(MsgType::REJECT);
-    send_response(client_fd, reject);
+    if (framed) {
+        ++client.frame_count;
+        FrameHeader header{static_cast<uint32_t>(client.frame_count * sizeof(ResponseMessage)),
+                           client.frame_count};
+        std::memcpy(client.send_buf.data() + client.frame_at, &header, sizeof(header));
+    }
+    if (!client.send_dirty) {
+        client.send_dirty = true;
+        dirty_.push_back(client.fd);
+    }
 }
 
-void TcpServer::send_response(int client_fd, const ResponseMessage& resp) {
-    char buf[sizeof(ResponseMessage)];
-    serialize(resp, buf);
+void TcpServer::flush_client(ClientState& client) {
+    client.frame_open = false;   // about to send, and maybe to compact
+    size_t pending = client.send_buf.size() - client.send_off;
+    if (pending > 0) {
+        iovec iov{client.send_buf.data() + client.send_off, pending};
+        ssize_t n;
+        {
+            OB_TIME(SOCKET_WRITE);
+            n = loop_->send(client.fd, &iov, 1);
+        }
+        if (n < 0) {
+            // Let the backend report the hangup and clean up there; the
+            // caller may still be holding this client
+            ::shutdown(client.fd, SHUT_RDWR);
+            client.send_buf.clear();
+            client.send_off = 0;
+            return;
+        }
+        client.send_off += n;
+        pending -= n;
+    }
 
-    // For simplicity, blocking write (messages are small)
-    size_t total = 0;
-    while (total < sizeof(buf)) {
-        ssize_t n = write(client_fd, buf + total, sizeof(buf) - total);
-        if (n <= 0) return;
-        total += n;
+    if (pending == 0) {
+        client.send_buf.clear();
+        client.send_off = 0;
+    } else if (pending > MAX_SEND_BACKLOG) {
+        // Not reading its responses; cut it off rather than buffer forever
+        std::cerr << "Client fd=" << client.fd << " send backlog over limit, disconnecting\n";
+        ::shutdown(client.fd, SHUT_RDWR);
+        client.send_buf.clear();
+        client.send_off = 0;
+        pending = 0;
+    } else if (client.send_off >= pending) {
+        // Compact once the sent prefix outweighs what is left
+        client.send_buf.erase(client.send_buf.begin(),
+                              client.send_buf.begin() + client.send_off);
+        client.send_off = 0;
+    }
+
+    bool want = pending > 0;
+    if (want != client.want_writable) {
+        client.want_writable = want;
+        loop_->want_writable(client.fd, want);
     }
 }
 
@@ -201,43 +383,79 @@ void TcpServer::run() {
         return;
     }
 
-    kqueue_fd_ = kqueue();
-    if (kqueue_fd_ < 0) {
-        perror("kqueue");
+    loop_ = make_event_loop(options_.backend);
+    if (!loop_) {
+        std::cerr << "Event loop backend '" << options_.backend << "' is not available\n";
+        return;
+    }
+    if (!loop_->add_listener(listen_fd_)) {
+        perror("add_listener");
         return;
     }
 
-    // Register listener fd
-    struct kevent ev;
-    EV_SET(&ev, listen_fd_, EVFILT_READ, EV_ADD, 0, 0, nullptr);
-    kevent(kqueue_fd_, &ev, 1, nullptr, 0, nullptr);
+    if (!options_.shm_name.empty()) {
+        try {
+            shm_ = std::make_unique<ShmServer>(options_.shm_name, options_.shm_slots,
+                                               options_.shm_wait);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << "\n";
+            return;
+        }
+        if (shm_->notify_fd() >= 0 && !loop_->add_client(shm_->notify_fd())) {
+            perror("add_client");
+            return;
+        }
+    }
+
+    if (options_.core >= 0 && !pin_current_thread(options_.core)) {
+        std::cerr << "Warning: could not pin the I/O thread to core " << options_.core << "\n";
+    }
 
     running_ = true;
-    std::cout << "Order book server listening on port " << port_ << "\n";
+    std::cout << "Order book server listening on port " << port_
+              << " (" << loop_->name() << (options_.busy_poll ? ", busy-poll" : "") << ")\n";
+    if (shm_) std::cout << "Shared-memory clients on " << options_.shm_name << "\n";
 
-    struct kevent events[64];
+    IoEvent events[256];
+#ifdef OB_INSTRUMENT
+    instrument::set_thread_name("io");
+#endif
 
+    uint32_t passes = 0;
     while (running_ && !g_shutdown) {
-        struct timespec timeout = {1, 0}; // 1 second timeout for shutdown check
-        int n = kevent(kqueue_fd_, nullptr, 0, events, 64, &timeout);
-
-        for (int i = 0; i < n; ++i) {
-            int fd = static_cast<int>(events[i].ident);
-
-            if (events[i].flags & EV_EOF) {
-                if (fd != listen_fd_) remove_client(fd);
-                continue;
-            }
-
-            if (fd == listen_fd_) {
-                accept_client();
-            } else {
-                handle_client_data(fd);
+        // Busy-poll never sleeps. Otherwise poll briefly while shards still
+        // owe responses, and sleep up to 1 second between shutdown checks.
+        bool spin = options_.busy_poll || (shm_ && shm_->spinning());
+        int64_t timeout_us = spin ? 0 : router_.in_flight() > 0 ? 20 : 1'000'000;
+
+        // While spinning for shared-memory clients, a socket poll (a system
+        // call) on every pass would dominate their round trip
+        if (!spin || !shm_ || (++passes & 15) == 0) {
+            int n = loop_->wait(events, 256, timeout_us);
+            if (n < 0) break;
+
+            for (int i = 0; i < n; ++i) {
+                handle_event(events[i]);
             }
         }
+        if (shm_) {
+            shm_->poll([this](uint64_t session, const OrderMessage& msg, uint8_t session_flags) {
+                submit(session, msg, session_flags);
+            });
+        }
+
+        flush_responses();
+        OB_PUBLISH();
     }
+#ifdef OB_INSTRUMENT
+    instrument::publish();
+#endif
 
     std::cout << "Server shutting down...\n";
+    if (shm_) {
+        if (shm_->notify_fd() >= 0) loop_->remove_client(shm_->notify_fd());
+        shm_.reset();
+    }
     running_ = false;
 }
 
@@ -245,18 +463,4 @@ void TcpServer::shutdown() {
     running_ = false;
 }
 
-// Entry point for the server binary
 } // namespace ob
-
-int main(int argc, char* argv[]) {
-    uint16_t port = 9000;
-    if (argc > 1) {
-        port = static_cast<uint16_t>(std::stoi(argv[1]));
-    }
-
-    ob::MatchingEngine engine;
-    ob::TcpServer server(port, engine);
-    server.run();
-
-    return 0;
-}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include "csv_parser.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+using namespace ob;
+
+namespace {
+
+std::string run(const std::string& input) {
+    MatchingEngine engine;
+    CsvParser parser(engine);
+    std::ostringstream os;
+    {
+        OutputBuffer out(os);
+        parser.process_buffer(input, out);
+    }
+    return os.str();
+}
+
+} // namespace
+
+TEST(ParsePrice, FixedPointWithoutDoubles) {
+    Price p = 0;
+    ASSERT_TRUE(parse_price("150.25", p));
+    EXPECT_EQ(p, 15025);
+    ASSERT_TRUE(parse_price("150", p));
+    EXPECT_EQ(p, 15000);
+    ASSERT_TRUE(parse_price("150.2", p));
+    EXPECT_EQ(p, 15020);
+    ASSERT_TRUE(parse_price(".5", p));
+    EXPECT_EQ(p, 50);
+    ASSERT_TRUE(parse_price("-1.25", p));
+    EXPECT_EQ(p, -125);
+    ASSERT_TRUE(parse_price("100.005", p));   // rounds half away from zero
+    EXPECT_EQ(p, 10001);
+    ASSERT_TRUE(parse_price("100.00499", p));
+    EXPECT_EQ(p, 10000);
+
+    EXPECT_FALSE(parse_price("", p));
+    EXPECT_FALSE(parse_price(".", p));
+    EXPECT_FALSE(parse_price("1.2x", p));
+    EXPECT_FALSE(parse_price("abc", p));
+    EXPECT_FALSE(parse_price("--1", p));
+}
+
+TEST(OutputBuffer, FormatsLikeStreams) {
+    std::ostringstream os;
+    {
+        OutputBuffer out(os, 8);   // forces several flushes
+        out.put("TRADE ");
+        out.put_uint(18446744073709551615ull);
+        out.put(' ');
+        out.put_price(15025);
+        out.put(' ');
+        out.put_price(7);
+        out.put('\n');
+    }
+    EXPECT_EQ(os.str(), "TRADE 18446744073709551615 150.25 0.07\n");
+    EXPECT_EQ(price_to_string(7), "0.07");
+}
+
+TEST(CsvParser, TradesCancelsAndSymbols) {
+    std::string out = run(
+        "# comment\n"
+        "LIMIT,SELL,100.50,10\n"
+        "  limit,b,100.50,4  \r\n"
+        "\n"
+        "LIMIT,SELL,20.00,5,,AAPL\n"
+        "MARKET,BUY,,5,,AAPL\n"
+        "CANCEL,,,,1\n"
+        "CANCEL,,,,1\n"
+        "CANCEL,,,,9,AAPL");
+
+    EXPECT_EQ(out,
+              "TRADE 2 1 100.50 4\n"
+              "TRADE 2 1 20.00 5 AAPL\n"
+              "CANCELLED 1\n"
+              "CANCEL_REJECT 1 (not found)\n"
+              "CANCEL_REJECT 9 AAPL (not found)\n");
+}
+
+TEST(CsvParser, Amends) {
+    std::string out = run(
+        "LIMIT,SELL,100.50,10\n"
+        "LIMIT,BUY,100.00,10\n"
+        "AMEND,,100.50,6,2\n"      // re-priced to cross: trades 6
+        "AMEND,,100.50,3,1\n"      // 4 of the seller's 10 left; shrink to 3 total
+        "AMEND,,100.50,5,7\n"
+        "AMEND,,,5,1\n");
+
+    EXPECT_EQ(out,
+              "AMENDED 2\n"
+              "TRADE 2 1 100.50 6\n"
+              "AMENDED 1\n"
+              "AMEND_REJECT 7 (not found)\n"
+              "ERROR: AMEND requires a price and order_id as 5th field\n");
+}
+
+TEST(CsvParser, ReportsBadLines) {
+    std::string out = run(
+        "FOO,BUY,1,1\n"
+        "LIMIT,up,1,1\n"
+        "LIMIT,BUY,,1\n"
+        "LIMIT,BUY,1.x,1\n"
+        "LIMIT,BUY,1,0\n"
+        "LIMIT,BUY,1,lots\n"
+        "LIMIT,BUY,1\n"
+        "CANCEL,,,,\n");
+
+    EXPECT_EQ(out,
+              "ERROR: unknown command 'FOO'\n"
+              "ERROR: unknown side 'UP'\n"
+              "ERROR: LIMIT order requires a price\n"
+              "ERROR: bad price '1.x'\n"
+              "ERROR: quantity must be > 0\n"
+              "ERROR: bad quantity 'lots'\n"
+              "ERROR: expected TYPE,SIDE,PRICE,QTY\n"
+              "ERROR: CANCEL requires order_id as 5th field\n");
+}
+
+TEST(CsvParser, FileAndStreamAgree) {
+    std::string input;
+    for (int i = 0; i < 500; ++i) {
+        input += (i % 2 ? "LIMIT,BUY,99." : "LIMIT,SELL,99.") + std::to_string(i % 50) + "," +
+                 std::to_string(1 + i % 7) + "\n";
+    }
+    input += "PRINT\n";
+
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("ob-csv-" + std::to_string(getpid()) + ".csv")).string();
+    std::ofstream(path) << input;
+
+    MatchingEngine a;
+    CsvParser mapped(a);
+    std::ostringstream from_file;
+    ASSERT_TRUE(mapped.process_file(path, from_file));
+    std::remove(path.c_str());
+
+    MatchingEngine b;
+    CsvParser streamed(b);
+    std::istringstream is(input);
+    std::ostringstream from_stream;
+    streamed.process_stream(is, from_stream);
+
+    EXPECT_FALSE(from_file.str().empty());
+    EXPECT_EQ(from_file.str(), from_stream.str());
+    EXPECT_FALSE(mapped.process_file("/nonexistent/input.csv", from_file));
+}
+
+TEST(CsvParser, ParallelIngestMatchesSerial) {
+    // Several parallel chunks' worth, with symbols, cancels and errors mixed in
+    std::string input;
+    for (int i = 0; input.size() < 3 * (1u << 20); ++i) {
+        switch (i % 9) {
+        case 0: input += "CANCEL,,,," + std::to_string(i / 3) + "\n"; break;
+        case 1: input += "LIMIT,BUY,100." + std::to_string(i % 97) + ",5,,XYZ\n"; break;
+        case 2: input += "MARKET,SELL,,3\n"; break;
+        case 3: input += "LIMIT,SIDEWAYS,1,1\n"; break;
+        default:
+            input += (i % 2 ? "LIMIT,BUY,99." : "LIMIT,SELL,99.") + std::to_string(i % 89) + "," +
+                     std::to_string(1 + i % 13) + "\n";
+        }
+    }
+    input += "PRINT\nPRINT,XYZ";   // last line without a newline
+
+    MatchingEngine a;
+    CsvParser serial(a);
+    std::ostringstream expect;
+    {
+        OutputBuffer out(expect);
+        serial.process_buffer(input, out, 1);
+    }
+
+    MatchingEngine b;
+    CsvParser parallel(b);
+    std::ostringstream got;
+    {
+        OutputBuffer out(got);
+        parallel.process_buffer(input, out, 4);
+    }
+
+    EXPECT_GT(expect.str().size(), 0u);
+    EXPECT_TRUE(got.str() == expect.str());
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "engine_router.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace ob;
+
+namespace {
+
+OrderMessage new_order(SymbolId symbol, Side side, Price price, Quantity qty) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::NEW_ORDER);
+    m.side = static_cast<uint8_t>(side);
+    m.order_type = static_cast<uint8_t>(OrderType::LIMIT);
+    m.symbol_id = symbol;
+    m.price = price;
+    m.quantity = qty;
+    return m;
+}
+
+OrderMessage cancel(SymbolId symbol, OrderId id) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::CANCEL);
+    m.symbol_id = symbol;
+    m.order_id = id;
+    return m;
+}
+
+std::vector<RoutedResponse> drain(EngineRouter& router) {
+    std::vector<RoutedResponse> out;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (router.in_flight() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    router.poll_responses(out);
+    return out;
+}
+
+std::vector<RoutedResponse> for_session(const std::vector<RoutedResponse>& all, uint64_t session) {
+    std::vector<RoutedResponse> out;
+    for (const auto& r : all) {
+        if (r.session == session) out.push_back(r);
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(EngineRouter, SymbolsHaveIndependentBooks) {
+    EngineRouter router({.shards = 2});
+    router.start();
+
+    // Same prices on two symbols: each crosses only within its own book
+    router.submit(1, new_order(0, Side::SELL, 10000, 100));
+    router.submit(2, new_order(1, Side::SELL, 10000, 100));
+    router.submit(1, new_order(0, Side::BUY, 10000, 40));
+    router.submit(2, cancel(1, 1));
+
+    auto all = drain(router);
+    ASSERT_EQ(router.in_flight(), 0);
+
+    auto s1 = for_session(all, 1);
+    ASSERT_EQ(s1.size(), 3);   // ACK, ACK, FILL
+    EXPECT_EQ(s1[0].msg.msg_type, static_cast<uint8_t>(MsgType::ACK));
+    EXPECT_EQ(s1[0].msg.order_id, 1);
+    EXPECT_EQ(s1[1].msg.order_id, 2);
+    EXPECT_EQ(s1[2].msg.msg_type, static_cast<uint8_t>(MsgType::FILL));
+    EXPECT_EQ(s1[2].msg.quantity, 40);
+    EXPECT_EQ(s1[2].msg.match_id, 1);
+
+    auto s2 = for_session(all, 2);
+    ASSERT_EQ(s2.size(), 2);   // ACK for order 1 on symbol 1, ACK for its cancel
+    EXPECT_EQ(s2[0].msg.order_id, 1);
+    EXPECT_EQ(s2[0].msg.symbol_id, 1);
+    EXPECT_EQ(s2[1].msg.msg_type, static_cast<uint8_t>(MsgType::ACK));
+}
+
+TEST(EngineRouter, PerSymbolOrderIsPreservedAcrossShards) {
+    EngineRouter router({.shards = 3});
+    router.start();
+
+    constexpr SymbolId symbols = 7;
+    constexpr int per_symbol = 200;
+    for (int i = 0; i < per_symbol; ++i) {
+        for (SymbolId s = 0; s < symbols; ++s) {
+            router.submit(s, new_order(s, Side::BUY, 10000 - i, 10));
+        }
+    }
+
+    auto all = drain(router);
+    ASSERT_EQ(all.size(), symbols * per_symbol);
+    for (SymbolId s = 0; s < symbols; ++s) {
+        auto acks = for_session(all, s);
+        ASSERT_EQ(acks.size(), per_symbol);
+        for (int i = 0; i < per_symbol; ++i) {
+            EXPECT_EQ(acks[i].msg.order_id, static_cast<OrderId>(i + 1));
+            EXPECT_EQ(acks[i].msg.symbol_id, s);
+        }
+    }
+}
+
+TEST(EngineRouter, AmendFillsCarryTheAmendedOrder) {
+    EngineRouter router;
+    router.start();
+
+    router.submit(1, new_order(0, Side::SELL, 10100, 30));   // 1
+    router.submit(2, new_order(0, Side::BUY, 9900, 50));     // 2
+    OrderMessage amend{};
+    amend.msg_type = static_cast<uint8_t>(MsgType::AMEND);
+    amend.order_id = 2;
+    amend.price = 10100;
+    amend.quantity = 50;   // side left unset: the engine knows it
+    router.submit(2, amend);
+
+    auto s2 = for_session(drain(router), 2);
+    ASSERT_EQ(s2.size(), 3);   // ACK order 2, ACK the amend, FILL
+    EXPECT_EQ(s2[1].msg.msg_type, static_cast<uint8_t>(MsgType::ACK));
+    EXPECT_EQ(s2[1].msg.order_id, 2);
+    EXPECT_EQ(s2[2].msg.msg_type, static_cast<uint8_t>(MsgType::FILL));
+    EXPECT_EQ(s2[2].msg.order_id, 2);
+    EXPECT_EQ(s2[2].msg.match_id, 1);
+    EXPECT_EQ(s2[2].msg.quantity, 30);
+    router.stop();
+}
+
+TEST(EngineRouter, StopDrainsSubmittedWork) {
+    EngineRouter router({.shards = 2});
+    router.start();
+    for (int i = 0; i < 1000; ++i) {
+        router.submit(0, new_order(static_cast<SymbolId>(i % 4), Side::SELL, 10000 + i, 1));
+    }
+    router.stop();
+
+    std::vector<RoutedResponse> out;
+    router.poll_responses(out);
+    EXPECT_EQ(out.size(), 1000);
+    EXPECT_EQ(router.in_flight(), 0);
+}
+
+TEST(EngineRouter, BusyPollShardsAnswerAndStop) {
+    // Pinned, so the pool is also bound to core 0's NUMA node
+    EngineRouter router({.shards = 1, .cores = {0}, .busy_poll = true});
+    router.start();
+
+    router.submit(1, new_order(0, Side::SELL, 10000, 100));
+    router.submit(1, new_order(0, Side::BUY, 10000, 100));
+    auto all = drain(router);
+    ASSERT_EQ(all.size(), 3);   // ACK, ACK, FILL
+    EXPECT_EQ(all[2].msg.msg_type, static_cast<uint8_t>(MsgType::FILL));
+    EXPECT_EQ(all[2].msg.quantity, 100);
+    router.stop();
+}
+
+TEST(EngineRouter, AggregatedSweepReportsOneFillPerLevel) {
+    EngineRouter router;
+    router.start();
+
+    // Resting asks: three at 10000, two at 10010, one at 10020
+    for (Quantity q : {10, 20, 30}) router.submit(1, new_order(0, Side::SELL, 10000, q));
+    for (Quantity q : {5, 5}) router.submit(1, new_order(0, Side::SELL, 10010, q));
+    router.submit(1, new_order(0, Side::SELL, 10020, 100));
+    router.submit(2, new_order(0, Side::BUY, 10020, 80), SessionFlags::AGGREGATE_FILLS);
+
+    auto s2 = for_session(drain(router), 2);
+    ASSERT_EQ(s2.size(), 4);   // ACK with the summary, then one LEVEL_FILL per price
+    EXPECT_EQ(s2[0].msg.msg_type, static_cast<uint8_t>(MsgType::ACK));
+    EXPECT_EQ(s2[0].msg.order_id, 7);
+    EXPECT_EQ(s2[0].msg.quantity, 80);
+    EXPECT_EQ(s2[0].msg.match_id, 6);
+    EXPECT_EQ(s2[0].msg.price, 10020);
+
+    const Price prices[] = {10000, 10010, 10020};
+    const Quantity quantities[] = {60, 10, 10};
+    const uint64_t fills[] = {3, 2, 1};
+    for (size_t i = 0; i < 3; ++i) {
+        const ResponseMessage& level = s2[i + 1].msg;
+        EXPECT_EQ(level.msg_type, static_cast<uint8_t>(MsgType::LEVEL_FILL));
+        EXPECT_EQ(level.order_id, 7);
+        EXPECT_EQ(level.price, prices[i]);
+        EXPECT_EQ(level.quantity, quantities[i]);
+        EXPECT_EQ(level.match_id, fills[i]);
+    }
+    router.stop();
+}
+
+TEST(EngineRouter, FillDetailFollowsEachLevelFill) {
+    EngineRouter router;
+    router.start();
+
+    router.submit(1, new_order(0, Side::BUY, 10000, 10));   // 1
+    router.submit(1, new_order(0, Side::BUY, 10000, 10));   // 2
+    router.submit(1, new_order(0, Side::BUY, 9990, 10));    // 3
+    router.submit(2, new_order(0, Side::SELL, 9990, 25),
+                  SessionFlags::AGGREGATE_FILLS | SessionFlags::FILL_DETAIL);
+    // Without the flags the same session gets plain FILLs
+    router.submit(2, new_order(0, Side::SELL, 9990, 5));
+
+    auto s2 = for_session(drain(router), 2);
+    ASSERT_EQ(s2.size(), 8);
+    auto type = [&](size_t i) { return static_cast<MsgType>(s2[i].msg.msg_type); };
+    EXPECT_EQ(type(0), MsgType::ACK);
+    EXPECT_EQ(s2[0].msg.quantity, 25);
+    EXPECT_EQ(type(1), MsgType::LEVEL_FILL);
+    EXPECT_EQ(s2[1].msg.quantity, 20);
+    EXPECT_EQ(type(2), MsgType::FILL);
+    EXPECT_EQ(s2[2].msg.match_id, 1);
+    EXPECT_EQ(type(3), MsgType::FILL);
+    EXPECT_EQ(s2[3].msg.match_id, 2);
+    EXPECT_EQ(type(4), MsgType::LEVEL_FILL);
+    EXPECT_EQ(s2[4].msg.price, 9990);
+    EXPECT_EQ(s2[4].msg.quantity, 5);
+    EXPECT_EQ(type(5), MsgType::FILL);
+    EXPECT_EQ(s2[5].msg.match_id, 3);
+
+    EXPECT_EQ(type(6), MsgType::ACK);
+    EXPECT_EQ(s2[6].msg.quantity, 0);
+    EXPECT_EQ(type(7), MsgType::FILL);
+    EXPECT_EQ(s2[7].msg.quantity, 5);
+    router.stop();
+}
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include "event_loop.h"
+#include "event_loop_uring_testing.h"
+#include <sys/socket.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string>
+
+using namespace ob;
+
+// Every backend this platform has, driven over a socketpair
+class EventLoopTest : public ::testing::TestWithParam<const char*> {
+protected:
+    void SetUp() override {
+        loop = make_event_loop(GetParam());
+        if (!loop) GTEST_SKIP() << GetParam() << " not available here";
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+        fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL, 0) | O_NONBLOCK);
+        ASSERT_TRUE(loop->add_client(fds[0]));
+    }
+
+    void TearDown() override {
+        if (!loop) return;
+        loop->remove_client(fds[0]);
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    // Collect what the server side received, whichever way the backend reports it
+    std::string receive(size_t expected) {
+        std::string got;
+        IoEvent events[16];
+        for (int round = 0; round < 50 && got.size() < expected; ++round) {
+            int n = loop->wait(events, 16, 100'000);
+            for (int i = 0; i < n; ++i) {
+                if (events[i].flags & IoEvent::DATA) {
+                    got.append(events[i].data, events[i].len);
+                    loop->release(events[i]);
+                }
+                if (events[i].flags & IoEvent::READABLE) {
+                    char buf[256];
+                    ssize_t r;
+                    while ((r = read(fds[0], buf, sizeof(buf))) > 0) got.append(buf, r);
+                }
+            }
+        }
+        return got;
+    }
+
+    std::unique_ptr<EventLoop> loop;
+    int fds[2] = {-1, -1};
+};
+
+TEST_P(EventLoopTest, DeliversIncomingBytes) {
+    ASSERT_EQ(write(fds[1], "hello", 5), 5);
+    EXPECT_EQ(receive(5), "hello");
+
+    // Still armed after the first delivery
+    ASSERT_EQ(write(fds[1], "again", 5), 5);
+    EXPECT_EQ(receive(5), "again");
+}
+
+TEST_P(EventLoopTest, SendReachesPeer) {
+    const char a[] = "ab";
+    const char b[] = "cd";
+    iovec iov[2] = {{(void*)a, 2}, {(void*)b, 2}};
+    EXPECT_EQ(loop->send(fds[0], iov, 2), 4);
+
+    IoEvent events[16];
+    loop->wait(events, 16, 0);   // completion backends submit here
+
+    char buf[8] = {};
+    ASSERT_EQ(read(fds[1], buf, sizeof(buf)), 4);
+    EXPECT_STREQ(buf, "abcd");
+}
+
+TEST_P(EventLoopTest, ReportsPeerClose) {
+    close(fds[1]);
+    fds[1] = -1;
+
+    bool hangup = false;
+    IoEvent events[16];
+    for (int round = 0; round < 50 && !hangup; ++round) {
+        int n = loop->wait(events, 16, 100'000);
+        for (int i = 0; i < n; ++i) {
+            if (events[i].flags & IoEvent::HANGUP) hangup = true;
+            // Readiness backends: EOF shows up as a zero-byte read
+            if (events[i].flags & IoEvent::READABLE) {
+                char buf[16];
+                if (read(fds[0], buf, sizeof(buf)) == 0) hangup = true;
+            }
+        }
+    }
+    EXPECT_TRUE(hangup);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, EventLoopTest,
+                         ::testing::Values("epoll", "io_uring", "kqueue"),
+                         [](const auto& info) { return std::string(info.param); });
+
+// A send that finds the submission queue full is held, not dropped, and
+// goes out ahead of anything queued behind it once there is room
+TEST(UringLoop, SendSurvivesFullSubmissionQueue) {
+    bool sq_full = false;
+    auto loop = make_io_uring_loop_for_test(&sq_full);
+    if (!loop) GTEST_SKIP() << "io_uring not available here";
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL, 0) | O_NONBLOCK);
+    fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL, 0) | O_NONBLOCK);
+    ASSERT_TRUE(loop->add_client(fds[0]));
+
+    IoEvent events[16];
+    loop->wait(events, 16, 0);
+
+    sq_full = true;
+    iovec first{(void*)"abcd", 4};
+    loop->send(fds[0], &first, 1);
+    loop->wait(events, 16, 0);   // the SEND finds no slot
+    iovec second{(void*)"ef", 2};
+    loop->send(fds[0], &second, 1);
+    loop->wait(events, 16, 0);
+
+    char buf[16] = {};
+    EXPECT_LT(read(fds[1], buf, sizeof(buf)), 0);   // nothing out yet
+
+    sq_full = false;
+    std::string got;
+    for (int round = 0; round < 50 && got.size() < 6; ++round) {
+        loop->wait(events, 16, 10'000);
+        ssize_t r;
+        while ((r = read(fds[1], buf, sizeof(buf))) > 0) got.append(buf, r);
+    }
+    EXPECT_EQ(got, "abcdef");
+
+    loop->remove_client(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+// A client added while the SQ is full still gets its recv armed
+TEST(UringLoop, RecvArmSurvivesFullSubmissionQueue) {
+    bool sq_full = false;
+    auto loop = make_io_uring_loop_for_test(&sq_full);
+    if (!loop) GTEST_SKIP() << "io_uring not available here";
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    sq_full = true;
+    ASSERT_TRUE(loop->add_client(fds[0]));
+    sq_full = false;
+
+    ASSERT_EQ(write(fds[1], "hello", 5), 5);
+    std::string got;
+    IoEvent events[16];
+    for (int round = 0; round < 50 && got.size() < 5; ++round) {
+        int n = loop->wait(events, 16, 10'000);
+        for (int i = 0; i < n; ++i) {
+            if (events[i].flags & IoEvent::DATA) {
+                got.append(events[i].data, events[i].len);
+                loop->release(events[i]);
+            }
+        }
+    }
+    EXPECT_EQ(got, "hello");
+
+    loop->remove_client(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+// Output queued for a peer that isn't reading is capped: send() comes up
+// short, and WRITABLE follows once the peer drains it
+TEST(UringLoop, SendBacksUpIntoTheCaller) {
+    auto loop = make_io_uring_loop();
+    if (!loop) GTEST_SKIP() << "io_uring not available here";
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL, 0) | O_NONBLOCK);
+    ASSERT_TRUE(loop->add_client(fds[0]));
+
+    std::string data(4 << 20, 'x');
+    iovec iov{data.data(), data.size()};
+    ssize_t taken = loop->send(fds[0], &iov, 1);
+    ASSERT_GT(taken, 0);
+    EXPECT_LT(static_cast<size_t>(taken), data.size());
+    loop->want_writable(fds[0], true);
+
+    bool writable = false;
+    size_t drained = 0;
+    IoEvent events[16];
+    char buf[65536];
+    for (int round = 0; round < 500 && !writable; ++round) {
+        int n = loop->wait(events, 16, 1'000);
+        for (int i = 0; i < n; ++i) {
+            if (events[i].flags & IoEvent::WRITABLE) writable = true;
+        }
+        ssize_t r;
+        while ((r = read(fds[1], buf, sizeof(buf))) > 0) drained += r;
+    }
+    EXPECT_TRUE(writable);
+    EXPECT_GT(drained, 0u);
+
+    loop->remove_client(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
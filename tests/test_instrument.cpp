@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "instrument.h"
+#include "matching_engine.h"
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+using namespace ob;
+using namespace ob::instrument;
+
+namespace {
+
+const ThreadStats* find(const std::vector<ThreadStats>& threads, const std::string& name) {
+    auto it = std::find_if(threads.begin(), threads.end(),
+                           [&](const ThreadStats& t) { return t.name == name; });
+    return it == threads.end() ? nullptr : &*it;
+}
+
+} // namespace
+
+TEST(Instrument, PublishedStatsAreVisibleFromAnotherThread) {
+    std::thread worker([] {
+        set_thread_name("test-worker");
+        local().counter(Counter::ORDERS) += 5;
+        local().dist(Dist::LEVELS_SWEPT).record(3);
+        { ScopedTimer t(Timer::MATCH); }
+        publish();
+        // Not published: collect() sees the last publish only...
+        local().counter(Counter::ORDERS) += 1;
+    });
+    worker.join();
+
+    // ...until the thread exits, which publishes once more
+    auto threads = collect();
+    const ThreadStats* t = find(threads, "test-worker");
+    ASSERT_NE(t, nullptr);
+    Stats s = t->stats;
+    EXPECT_EQ(s.counter(Counter::ORDERS), 6u);
+    EXPECT_EQ(s.dist(Dist::LEVELS_SWEPT).count(), 1u);
+    EXPECT_EQ(s.timer(Timer::MATCH).count(), 1u);
+}
+
+TEST(Instrument, MergeAddsCountersAndHistograms) {
+    Stats a, b;
+    a.counter(Counter::TRADES) = 2;
+    b.counter(Counter::TRADES) = 3;
+    a.dist(Dist::QUEUE_DEPTH).record(1);
+    b.dist(Dist::QUEUE_DEPTH).record(100);
+    a.merge(b);
+    EXPECT_EQ(a.counter(Counter::TRADES), 5u);
+    EXPECT_EQ(a.dist(Dist::QUEUE_DEPTH).count(), 2u);
+    EXPECT_EQ(a.dist(Dist::QUEUE_DEPTH).max(), 100u);
+}
+
+TEST(Instrument, ReportNamesThreadsAndSkipsIdleOnes) {
+    std::vector<ThreadStats> threads(2);
+    threads[0].name = "idle";
+    threads[1].name = "busy";
+    threads[1].stats.counter(Counter::CANCELS) = 7;
+    threads[1].stats.timer(Timer::DECODE).record(1000);
+
+    TscClock clock(std::chrono::milliseconds(1));
+    std::ostringstream os;
+    report(os, threads, clock);
+    std::string text = os.str();
+    EXPECT_EQ(text.find("[idle]"), std::string::npos);
+    EXPECT_NE(text.find("[busy] cancels=7"), std::string::npos);
+    EXPECT_NE(text.find("decode"), std::string::npos);
+}
+
+TEST(Instrument, EnabledPolicyRecordsWhateverTheBuildFlag) {
+    std::thread worker([] {
+        set_thread_name("policy-worker");
+        BasicMatchingEngine<OrderBook, ObjectPool<Order>, Enabled> engine;
+        engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 10);
+        engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 10);
+
+        // Disabled records nothing, even in an instrumented build
+        BasicMatchingEngine<OrderBook, ObjectPool<Order>, Disabled> bare;
+        bare.process_order(Side::SELL, OrderType::LIMIT, 10000, 10);
+    });
+    worker.join();
+
+    auto threads = collect();
+    const ThreadStats* t = find(threads, "policy-worker");
+    ASSERT_NE(t, nullptr);
+    Stats s = t->stats;
+    EXPECT_EQ(s.counter(Counter::ORDERS), 2u);
+    EXPECT_EQ(s.counter(Counter::TRADES), 1u);
+    EXPECT_EQ(s.timer(Timer::MATCH).count(), 2u);
+}
+
+TEST(Instrument, BookAndPoolEventsGoThroughTheEnginePolicy) {
+    size_t blocks = 0;
+    std::thread worker([&blocks] {
+        set_thread_name("growth-worker");
+        PoolOptions options;
+        options.capacity = 1;
+        ObjectPool<Order> pool(options);
+        BasicMatchingEngine<OrderBook, ObjectPool<Order>, Enabled> engine(pool);
+        for (int i = 0; i < 20; ++i) {
+            engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 10);
+        }
+        blocks = pool.block_count();
+
+        // Disabled records nothing, even in an instrumented build
+        ObjectPool<Order> bare_pool(options);
+        BasicMatchingEngine<OrderBook, ObjectPool<Order>, Disabled> bare(bare_pool);
+        for (int i = 0; i < 20; ++i) {
+            bare.process_order(Side::BUY, OrderType::LIMIT, 10000, 10);
+        }
+        EXPECT_GT(bare_pool.block_count(), 1u);
+    });
+    worker.join();
+
+    auto threads = collect();
+    const ThreadStats* t = find(threads, "growth-worker");
+    ASSERT_NE(t, nullptr);
+    Stats s = t->stats;
+    EXPECT_EQ(s.dist(Dist::QUEUE_DEPTH).count(), 20u);
+    EXPECT_EQ(s.dist(Dist::QUEUE_DEPTH).max(), 20u);
+    EXPECT_GT(blocks, 1u);
+    EXPECT_EQ(s.counter(Counter::POOL_GROWTH), blocks - 1);   // the first came with the pool
+}
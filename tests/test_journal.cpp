@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include "journal.h"
+#include "engine_router.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace ob;
+
+namespace {
+
+struct TempDir {
+    std::string path;
+    TempDir() {
+        static int counter = 0;
+        path = (std::filesystem::temp_directory_path() /
+                ("ob-journal-" + std::to_string(getpid()) + "-" + std::to_string(counter++)))
+                   .string();
+        std::filesystem::remove_all(path);
+    }
+    ~TempDir() { std::filesystem::remove_all(path); }
+};
+
+OrderMessage new_order(SymbolId symbol, Side side, Price price, Quantity qty) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::NEW_ORDER);
+    m.side = static_cast<uint8_t>(side);
+    m.order_type = static_cast<uint8_t>(OrderType::LIMIT);
+    m.symbol_id = symbol;
+    m.price = price;
+    m.quantity = qty;
+    return m;
+}
+
+std::vector<JournalRecord> read_all(const std::string& dir, const std::string& stream) {
+    std::vector<JournalRecord> out;
+    replay_journal(dir, stream, [&](const JournalRecord& r) { out.push_back(r); });
+    return out;
+}
+
+std::vector<RoutedResponse> drain(EngineRouter& router) {
+    std::vector<RoutedResponse> out;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (router.in_flight() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    router.poll_responses(out);
+    return out;
+}
+
+} // namespace
+
+TEST(Journal, AppendSyncAndReplay) {
+    TempDir dir;
+    JournalOptions opts{.dir = dir.path};
+    {
+        JournalWriter w(opts, "s");
+        ASSERT_TRUE(w.open());
+        for (int i = 0; i < 10; ++i) w.append(new_order(0, Side::BUY, 100 + i, 1));
+        EXPECT_EQ(w.pending(), 10);
+        w.sync();
+        EXPECT_EQ(w.pending(), 0);
+    }
+
+    auto records = read_all(dir.path, "s");
+    ASSERT_EQ(records.size(), 10);
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].seq, i + 1);
+        EXPECT_EQ(records[i].msg.price, static_cast<Price>(100 + i));
+    }
+}
+
+TEST(Journal, ReopenContinuesSequence) {
+    TempDir dir;
+    JournalOptions opts{.dir = dir.path};
+    {
+        JournalWriter w(opts, "s");
+        ASSERT_TRUE(w.open());
+        w.append(new_order(0, Side::BUY, 1, 1));
+        w.append(new_order(0, Side::BUY, 2, 1));
+    }
+    {
+        JournalWriter w(opts, "s");
+        ASSERT_TRUE(w.open());
+        EXPECT_EQ(w.next_seq(), 3);
+        w.append(new_order(0, Side::BUY, 3, 1));
+    }
+
+    auto records = read_all(dir.path, "s");
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[2].seq, 3);
+    EXPECT_EQ(records[2].msg.price, 3);
+}
+
+TEST(Journal, RollsOverSegments) {
+    TempDir dir;
+    JournalOptions opts{.dir = dir.path, .segment_bytes = 4 * sizeof(JournalRecord)};
+    {
+        JournalWriter w(opts, "s");
+        ASSERT_TRUE(w.open());
+        for (int i = 0; i < 10; ++i) w.append(new_order(0, Side::SELL, i, 1));
+    }
+
+    size_t files = 0;
+    for (const auto& e : std::filesystem::directory_iterator(dir.path)) {
+        (void)e;
+        ++files;
+    }
+    EXPECT_EQ(files, 3);
+
+    auto records = read_all(dir.path, "s");
+    ASSERT_EQ(records.size(), 10);
+    EXPECT_EQ(records.back().seq, 10);
+}
+
+TEST(Journal, TornTailIsDroppedAndOverwritten) {
+    TempDir dir;
+    JournalOptions opts{.dir = dir.path};
+    {
+        JournalWriter w(opts, "s");
+        ASSERT_TRUE(w.open());
+        for (int i = 0; i < 5; ++i) w.append(new_order(0, Side::BUY, i, 1));
+    }
+
+    // Damage record 3; 4 and 5 survive on disk but come after the tear
+    std::string path = dir.path + "/s.000000.journal";
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(2 * sizeof(JournalRecord) + 20);
+        f.put('\x7f');
+    }
+    EXPECT_EQ(read_all(dir.path, "s").size(), 2);
+
+    {
+        JournalWriter w(opts, "s");
+        ASSERT_TRUE(w.open());
+        EXPECT_EQ(w.next_seq(), 3);
+        w.append(new_order(0, Side::BUY, 42, 1));
+    }
+
+    // Old records 4 and 5 must not reappear behind the new record 3
+    auto records = read_all(dir.path, "s");
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[2].msg.price, 42);
+}
+
+TEST(Journal, SyncDueByCountOrAge) {
+    TempDir dir;
+    JournalOptions opts{.dir = dir.path, .sync_records = 3,
+                        .sync_interval = std::chrono::microseconds(1'000'000)};
+    JournalWriter w(opts, "s");
+    ASSERT_TRUE(w.open());
+    EXPECT_FALSE(w.sync_due());
+    w.append(new_order(0, Side::BUY, 1, 1));
+    w.append(new_order(0, Side::BUY, 1, 1));
+    EXPECT_FALSE(w.sync_due());
+    w.append(new_order(0, Side::BUY, 1, 1));
+    EXPECT_TRUE(w.sync_due());
+    w.sync();
+
+    JournalOptions aged{.dir = dir.path + "/aged", .sync_records = 1000,
+                        .sync_interval = std::chrono::microseconds(1)};
+    JournalWriter a(aged, "s");
+    ASSERT_TRUE(a.open());
+    a.append(new_order(0, Side::BUY, 1, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_TRUE(a.sync_due());
+}
+
+TEST(Journal, RouterRecoversBooksAndIds) {
+    TempDir dir;
+    RouterOptions opts{.shards = 2, .journal = {.dir = dir.path}};
+
+    {
+        EngineRouter router(opts);
+        router.start();
+        router.submit(1, new_order(0, Side::SELL, 10000, 100));   // id 1 on symbol 0
+        router.submit(1, new_order(1, Side::SELL, 20000, 50));    // id 1 on symbol 1
+        router.submit(1, new_order(0, Side::SELL, 10100, 10));    // id 2 on symbol 0
+        drain(router);
+        router.stop();
+    }
+
+    EngineRouter router(opts);
+    router.start();
+    EXPECT_EQ(router.recovered(), 3);
+
+    // Resting orders are back and ids carry on where they stopped
+    router.submit(2, new_order(0, Side::BUY, 10000, 30));
+    auto out = drain(router);
+    ASSERT_EQ(out.size(), 2);
+    EXPECT_EQ(out[0].msg.msg_type, static_cast<uint8_t>(MsgType::ACK));
+    EXPECT_EQ(out[0].msg.order_id, 3);
+    EXPECT_EQ(out[1].msg.msg_type, static_cast<uint8_t>(MsgType::FILL));
+    EXPECT_EQ(out[1].msg.quantity, 30);
+    EXPECT_EQ(out[1].msg.match_id, 1);   // maker: the first sell
+}
+
+TEST(Journal, RouterRejectsDifferentShardCount) {
+    TempDir dir;
+    {
+        EngineRouter router({.shards = 2, .journal = {.dir = dir.path}});
+        router.start();
+        router.submit(1, new_order(0, Side::SELL, 10000, 100));
+        drain(router);
+    }
+    EngineRouter router({.shards = 3, .journal = {.dir = dir.path}});
+    EXPECT_THROW(router.start(), std::runtime_error);
+}
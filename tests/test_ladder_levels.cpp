@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "ladder_levels.h"
+#include "object_pool.h"
+#include <vector>
+
+using namespace ob;
+
+class LadderLevelsTest : public ::testing::Test {
+protected:
+    ObjectPool<Order> pool;
+    OrderId next_id = 1;
+
+    Order* make_order(Side side, Price price, Quantity qty) {
+        Order* o = pool.allocate();
+        o->id = next_id;
+        o->quantity = qty;
+        o->filled_qty = 0;
+        o->info() = {next_id++, price, side, OrderType::LIMIT};
+        return o;
+    }
+
+    template <typename Levels>
+    std::vector<Price> prices(const Levels& levels) {
+        std::vector<Price> out;
+        levels.for_each([&](Price p, const PriceLevel&) { out.push_back(p); });
+        return out;
+    }
+};
+
+TEST_F(LadderLevelsTest, FirstOrderCentersWindow) {
+    LadderLevels<Side::BUY> bids(64);
+    bids.add(make_order(Side::BUY, 10000, 100));
+
+    EXPECT_EQ(bids.window_base(), 10000 - 32);
+    EXPECT_EQ(bids.best_price(), 10000);
+    EXPECT_EQ(bids.sparse_size(), 0);
+}
+
+TEST_F(LadderLevelsTest, OutlierGoesToSparseFallback) {
+    LadderLevels<Side::BUY> bids(64);
+    bids.add(make_order(Side::BUY, 10000, 100));
+    bids.add(make_order(Side::BUY, 5000, 100));   // far below the touch
+
+    EXPECT_EQ(bids.size(), 2);
+    EXPECT_EQ(bids.sparse_size(), 1);
+    EXPECT_EQ(bids.best_price(), 10000);
+    ASSERT_NE(bids.find(5000), nullptr);
+    EXPECT_EQ(bids.find(5000)->total_quantity(), 100);
+}
+
+TEST_F(LadderLevelsTest, TouchLeavingWindowRecenters) {
+    LadderLevels<Side::SELL> asks(64);
+    asks.add(make_order(Side::SELL, 10000, 100));
+    asks.add(make_order(Side::SELL, 9000, 50));   // new best ask, out of window
+
+    EXPECT_EQ(asks.best_price(), 9000);
+    EXPECT_EQ(asks.window_base(), 9000 - 32);
+    // The old level no longer fits and moved to the fallback
+    EXPECT_EQ(asks.sparse_size(), 1);
+    EXPECT_EQ(asks.find(10000)->total_quantity(), 100);
+}
+
+TEST_F(LadderLevelsTest, RecenterPullsSparseLevelsIntoWindow) {
+    LadderLevels<Side::BUY> bids(64);
+    Order* touch = make_order(Side::BUY, 10000, 100);
+    bids.add(touch);
+    bids.add(make_order(Side::BUY, 5000, 10));
+    bids.add(make_order(Side::BUY, 5001, 20));
+    EXPECT_EQ(bids.sparse_size(), 2);
+
+    // Empty the ladder; the next add recenters and picks the outliers back up
+    bids.remove(touch);
+    EXPECT_EQ(bids.best_price(), 5001);
+    bids.add(make_order(Side::BUY, 5002, 30));
+
+    EXPECT_EQ(bids.sparse_size(), 0);
+    EXPECT_EQ(bids.size(), 3);
+    EXPECT_EQ(bids.best_price(), 5002);
+}
+
+TEST_F(LadderLevelsTest, IterationMergesLadderAndSparseInPriority) {
+    LadderLevels<Side::BUY> bids(16);
+    bids.add(make_order(Side::BUY, 100, 1));
+    bids.add(make_order(Side::BUY, 98, 1));
+    bids.add(make_order(Side::BUY, 50, 1));       // sparse, below window
+
+    EXPECT_EQ(prices(bids), (std::vector<Price>{100, 98, 50}));
+
+    LadderLevels<Side::SELL> asks(16);
+    asks.add(make_order(Side::SELL, 100, 1));
+    asks.add(make_order(Side::SELL, 103, 1));
+    asks.add(make_order(Side::SELL, 200, 1));     // sparse, above window
+
+    EXPECT_EQ(prices(asks), (std::vector<Price>{100, 103, 200}));
+}
+
+TEST_F(LadderLevelsTest, PopBestAdvancesToNextOccupiedSlot) {
+    LadderLevels<Side::SELL> asks(64);
+    Order* a = make_order(Side::SELL, 10000, 10);
+    asks.add(a);
+    asks.add(make_order(Side::SELL, 10007, 10));
+
+    PriceLevel& best = asks.best_level();
+    best.pop_front();
+    asks.pop_best();
+
+    EXPECT_EQ(asks.size(), 1);
+    EXPECT_EQ(asks.best_price(), 10007);
+}
+
+TEST_F(LadderLevelsTest, OffGridPricesUseFallback) {
+    LadderLevels<Side::BUY> bids(64, 5);
+    bids.add(make_order(Side::BUY, 10000, 10));
+    bids.add(make_order(Side::BUY, 10003, 10));   // not a multiple of the tick
+
+    EXPECT_EQ(bids.sparse_size(), 1);
+    EXPECT_EQ(bids.best_price(), 10003);
+    EXPECT_EQ(prices(bids), (std::vector<Price>{10003, 10000}));
+}
+
+TEST_F(LadderLevelsTest, SparseLadderFindsNextLevelAfterPoppingTouch) {
+    LadderLevels<Side::BUY> bids(4096);
+    // Widely spaced levels, all inside the window
+    for (Price p = 10000; p > 10000 - 2000; p -= 250) {
+        bids.add(make_order(Side::BUY, p, 10));
+    }
+    EXPECT_EQ(bids.sparse_size(), 0);
+    EXPECT_EQ(prices(bids), (std::vector<Price>{10000, 9750, 9500, 9250, 9000, 8750, 8500, 8250}));
+
+    for (Price expected = 10000; expected > 8250; expected -= 250) {
+        ASSERT_EQ(bids.best_price(), expected);
+        bids.pop_best();
+    }
+    EXPECT_EQ(bids.best_price(), 8250);
+    bids.pop_best();
+    EXPECT_TRUE(bids.empty());
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "latency_histogram.h"
+#include "tsc_clock.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ob;
+
+TEST(LatencyHistogram, SmallValuesAreExact) {
+    LatencyHistogram h;
+    for (uint64_t v = 1; v <= 50; ++v) h.record(v);
+    EXPECT_EQ(h.count(), 50u);
+    EXPECT_EQ(h.min(), 1u);
+    EXPECT_EQ(h.max(), 50u);
+    EXPECT_DOUBLE_EQ(h.mean(), 25.5);
+    EXPECT_EQ(h.percentile(50), 25u);
+    EXPECT_EQ(h.percentile(100), 50u);
+    EXPECT_EQ(h.percentile(0), 1u);
+}
+
+TEST(LatencyHistogram, PercentilesWithinBucketError) {
+    std::mt19937_64 rng(7);
+    std::lognormal_distribution<double> dist(6.0, 1.5);   // long right tail
+    std::vector<uint64_t> values;
+    LatencyHistogram h;
+    for (int i = 0; i < 100000; ++i) {
+        auto v = static_cast<uint64_t>(dist(rng)) + 1;
+        values.push_back(v);
+        h.record(v);
+    }
+    std::sort(values.begin(), values.end());
+
+    const double tolerance = 1.0 / (1 << LatencyHistogram::SUB_BITS);
+    for (double pct : {50.0, 90.0, 99.0, 99.9}) {
+        auto exact = static_cast<double>(values[static_cast<size_t>(pct / 100 * values.size()) - 1]);
+        auto got = static_cast<double>(h.percentile(pct));
+        EXPECT_GE(got, exact) << "p" << pct;
+        EXPECT_LE(got, exact * (1 + tolerance) + 1) << "p" << pct;
+    }
+    EXPECT_EQ(h.percentile(100), values.back());
+}
+
+TEST(LatencyHistogram, HandlesExtremesAndMerges) {
+    LatencyHistogram a;
+    LatencyHistogram b;
+    a.record(0);
+    a.record_n(1000, 3);
+    b.record(UINT64_MAX);
+    a.merge(b);
+
+    EXPECT_EQ(a.count(), 5u);
+    EXPECT_EQ(a.min(), 0u);
+    EXPECT_EQ(a.max(), UINT64_MAX);
+    EXPECT_EQ(a.percentile(100), UINT64_MAX);
+    EXPECT_NEAR(static_cast<double>(a.percentile(60)), 1000.0, 1000.0 / 32);
+
+    a.reset();
+    EXPECT_EQ(a.count(), 0u);
+    EXPECT_EQ(a.percentile(99), 0u);
+}
+
+TEST(TscClock, CalibratesAgainstSteadyClock) {
+    TscClock clock(std::chrono::milliseconds(5));
+    EXPECT_GT(clock.ns_per_tick(), 0.0);
+
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = TscClock::begin();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    uint64_t c1 = TscClock::end();
+    double steady_ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - t0).count();
+
+    ASSERT_GT(c1, c0);
+    double tsc_ns = clock.to_ns(c1 - c0);
+    EXPECT_GT(tsc_ns, steady_ns * 0.8);
+    EXPECT_LT(tsc_ns, steady_ns * 1.2);
+}
@@ -0,0 +1,253 @@
+#include <gtest/gtest.h>
+#include "market_data.h"
+#include "matching_engine.h"
+#include "engine_router.h"
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace ob;
+
+namespace {
+
+using Packets = std::vector<std::vector<char>>;
+
+struct CaptureTransport : DepthTransport {
+    Packets& packets;
+    explicit CaptureTransport(Packets& p) : packets(p) {}
+    void send(const void* data, size_t len) override {
+        const char* p = static_cast<const char*>(data);
+        packets.emplace_back(p, p + len);
+    }
+};
+
+std::vector<DepthUpdate> decode(const Packets& packets) {
+    std::vector<DepthUpdate> out;
+    for (const auto& p : packets) {
+        DepthPacketHeader h;
+        std::memcpy(&h, p.data(), sizeof(h));
+        EXPECT_EQ(p.size(), sizeof(h) + h.count * sizeof(DepthUpdate));
+        for (size_t i = 0; i < h.count; ++i) {
+            DepthUpdate u;
+            std::memcpy(&u, p.data() + sizeof(h) + i * sizeof(u), sizeof(u));
+            EXPECT_EQ(u.seq, h.first_seq + i);
+            out.push_back(u);
+        }
+    }
+    return out;
+}
+
+struct Feed {
+    Packets packets;
+    MarketDataPublisher publisher;
+    explicit Feed(bool conflate)
+        : publisher(std::make_unique<CaptureTransport>(packets), {.conflate = conflate}) {}
+
+    std::vector<DepthUpdate> take() {
+        publisher.flush();
+        auto out = decode(packets);
+        packets.clear();
+        return out;
+    }
+};
+
+// UDP socket on 127.0.0.1 with a receive timeout; port() is where it listens
+struct UdpReceiver {
+    int fd;
+    UdpReceiver() {
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        timeval tv{2, 0};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+    ~UdpReceiver() { close(fd); }
+    uint16_t port() const {
+        sockaddr_in addr{};
+        socklen_t len = sizeof(addr);
+        getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        return ntohs(addr.sin_port);
+    }
+    std::vector<char> receive() {
+        std::vector<char> buf(2048);
+        ssize_t n = recv(fd, buf.data(), buf.size(), 0);
+        buf.resize(n > 0 ? static_cast<size_t>(n) : 0);
+        return buf;
+    }
+};
+
+} // namespace
+
+TEST(MarketData, RestsAndCancelsUpdateTheirLevel) {
+    Feed feed(false);
+    MatchingEngine engine;
+    engine.set_depth_listener(&feed.publisher, 3);
+
+    engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+    engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 50);
+    engine.cancel_order(1);
+
+    auto u = feed.take();
+    ASSERT_EQ(u.size(), 3);
+    EXPECT_EQ(u[0].seq, 1);
+    EXPECT_EQ(u[0].symbol_id, 3);
+    EXPECT_EQ(u[0].side, static_cast<uint8_t>(Side::BUY));
+    EXPECT_EQ(u[0].price, 10000);
+    EXPECT_EQ(u[0].quantity, 100);
+    EXPECT_EQ(u[1].quantity, 150);
+    EXPECT_EQ(u[2].quantity, 50);
+    EXPECT_EQ(u[2].seq, 3);
+}
+
+TEST(MarketData, SweepReportsEachLevelOnce) {
+    Feed feed(false);
+    MatchingEngine engine;
+    for (Price p : {10100, 10200, 10300}) {
+        engine.process_order(Side::SELL, OrderType::LIMIT, p, 10);
+        engine.process_order(Side::SELL, OrderType::LIMIT, p, 10);
+    }
+    engine.set_depth_listener(&feed.publisher, 0);
+
+    // Six fills over three levels, the last one partial
+    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10300, 55);
+    EXPECT_EQ(trades.size(), 6);
+
+    auto u = feed.take();
+    ASSERT_EQ(u.size(), 3);
+    EXPECT_EQ(u[0].price, 10100);
+    EXPECT_EQ(u[0].quantity, 0);
+    EXPECT_EQ(u[1].price, 10200);
+    EXPECT_EQ(u[1].quantity, 0);
+    EXPECT_EQ(u[2].price, 10300);
+    EXPECT_EQ(u[2].quantity, 5);
+    EXPECT_EQ(u[2].side, static_cast<uint8_t>(Side::SELL));
+}
+
+TEST(MarketData, ConflationKeepsLatestPerLevel) {
+    Feed plain(false);
+    Feed conflated(true);
+    MatchingEngine a, b;
+    a.set_depth_listener(&plain.publisher, 0);
+    b.set_depth_listener(&conflated.publisher, 0);
+
+    for (auto* e : {&a, &b}) {
+        for (int i = 0; i < 5; ++i) e->process_order(Side::SELL, OrderType::LIMIT, 10100, 10);
+        e->process_order(Side::BUY, OrderType::LIMIT, 9900, 7);
+        e->process_order(Side::BUY, OrderType::LIMIT, 10100, 25);   // takes 25 of 50
+    }
+
+    EXPECT_EQ(plain.take().size(), 7);
+
+    auto u = conflated.take();
+    ASSERT_EQ(u.size(), 2);   // first-change order: the ask level, then the bid
+    EXPECT_EQ(u[0].price, 10100);
+    EXPECT_EQ(u[0].quantity, 25);
+    EXPECT_EQ(u[1].price, 9900);
+    EXPECT_EQ(u[1].quantity, 7);
+
+    // The next interval starts fresh, and seqs carry on
+    b.cancel_order(6);
+    u = conflated.take();
+    ASSERT_EQ(u.size(), 1);
+    EXPECT_EQ(u[0].seq, 3);
+    EXPECT_EQ(u[0].quantity, 0);
+}
+
+// More levels in one interval than the index was sized for: it grows
+// and still conflates, and later intervals start empty again
+TEST(MarketData, ConflationOutgrowsItsSizing) {
+    Packets packets;
+    MarketDataPublisher publisher(std::make_unique<CaptureTransport>(packets),
+                                  {.conflate = true, .levels = 8});
+    for (int interval = 0; interval < 3; ++interval) {
+        for (int pass = 0; pass < 2; ++pass) {
+            for (Price p = 0; p < 100; ++p) {
+                publisher.on_depth(1, p % 2 ? Side::BUY : Side::SELL, p, 10 * pass + interval);
+            }
+        }
+        publisher.flush();
+        auto u = decode(packets);
+        packets.clear();
+        ASSERT_EQ(u.size(), 100);
+        for (Price p = 0; p < 100; ++p) {
+            EXPECT_EQ(u[p].price, p);
+            EXPECT_EQ(u[p].quantity, static_cast<Quantity>(10 + interval));
+        }
+    }
+}
+
+TEST(MarketData, PacketsStayUnderMtu) {
+    Feed feed(true);
+    for (Price p = 0; p < 100; ++p) feed.publisher.on_depth(0, Side::BUY, p, 1);
+    feed.publisher.flush();
+
+    ASSERT_EQ(feed.packets.size(), 2);
+    for (const auto& p : feed.packets) {
+        EXPECT_LE(p.size(), MarketDataPublisher::MAX_PACKET_BYTES);
+    }
+    auto u = decode(feed.packets);
+    ASSERT_EQ(u.size(), 100);
+    EXPECT_EQ(u.back().seq, 100);
+    EXPECT_FALSE(feed.publisher.has_pending());
+}
+
+TEST(MarketData, UdpTransportDelivers) {
+    UdpReceiver rx;
+    MarketDataPublisher publisher(std::make_unique<UdpDepthTransport>("127.0.0.1", rx.port()),
+                                  {.channel = 9});
+    publisher.on_depth(1, Side::SELL, 12345, 77);
+    publisher.flush();
+
+    auto p = rx.receive();
+    ASSERT_EQ(p.size(), sizeof(DepthPacketHeader) + sizeof(DepthUpdate));
+    DepthPacketHeader h;
+    std::memcpy(&h, p.data(), sizeof(h));
+    EXPECT_EQ(h.first_seq, 1);
+    EXPECT_EQ(h.count, 1);
+    EXPECT_EQ(h.channel, 9);
+    DepthUpdate u;
+    std::memcpy(&u, p.data() + sizeof(h), sizeof(u));
+    EXPECT_EQ(u.price, 12345);
+    EXPECT_EQ(u.quantity, 77);
+    EXPECT_EQ(u.symbol_id, 1);
+}
+
+TEST(MarketData, BadAddressThrows) {
+    EXPECT_THROW(UdpDepthTransport("not-an-address", 1), std::runtime_error);
+}
+
+TEST(MarketData, RouterPublishesShardDepth) {
+    UdpReceiver rx;
+    EngineRouter router({.shards = 2, .market_data_address = "127.0.0.1",
+                         .market_data_port = rx.port()});
+    router.start();
+
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::NEW_ORDER);
+    m.side = static_cast<uint8_t>(Side::BUY);
+    m.order_type = static_cast<uint8_t>(OrderType::LIMIT);
+    m.symbol_id = 1;
+    m.price = 5000;
+    m.quantity = 40;
+    ASSERT_TRUE(router.submit(1, m));
+
+    auto p = rx.receive();
+    ASSERT_EQ(p.size(), sizeof(DepthPacketHeader) + sizeof(DepthUpdate));
+    DepthPacketHeader h;
+    std::memcpy(&h, p.data(), sizeof(h));
+    EXPECT_EQ(h.channel, 1);   // symbol 1 lives on shard 1
+    DepthUpdate u;
+    std::memcpy(&u, p.data() + sizeof(h), sizeof(u));
+    EXPECT_EQ(u.symbol_id, 1);
+    EXPECT_EQ(u.price, 5000);
+    EXPECT_EQ(u.quantity, 40);
+    router.stop();
+}
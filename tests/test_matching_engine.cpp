@@ -1,44 +1,54 @@
 #include <gtest/gtest.h>
 #include "matching_engine.h"
+#include <type_traits>
 
 using namespace ob;
 
+template <typename Engine>
 class MatchingEngineTest : public ::testing::Test {
 protected:
-    MatchingEngine engine;
+    Engine engine;
 };
 
+// The shipped engines plus one per alternative policy
+using FlatLookupEngine = BasicMatchingEngine<BasicOrderBook<MapLevels, FlatOrderMap>>;
+using HeapPoolEngine = BasicMatchingEngine<OrderBook, HeapPool<Order>>;
+using InstrumentedEngine = BasicMatchingEngine<OrderBook, ObjectPool<Order>, instrument::Enabled>;
+using EngineTypes = ::testing::Types<MatchingEngine, LadderMatchingEngine, FlatLookupEngine,
+                                     HeapPoolEngine, InstrumentedEngine>;
+TYPED_TEST_SUITE(MatchingEngineTest, EngineTypes);
+
 // --- Basic Limit Order Matching ---
 
-TEST_F(MatchingEngineTest, NoMatchWhenBookEmpty) {
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+TYPED_TEST(MatchingEngineTest, NoMatchWhenBookEmpty) {
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
     EXPECT_TRUE(trades.empty());
-    EXPECT_EQ(engine.book().total_order_count(), 1);
+    EXPECT_EQ(this->engine.book().total_order_count(), 1);
 }
 
-TEST_F(MatchingEngineTest, LimitBuyMatchesSell) {
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+TYPED_TEST(MatchingEngineTest, LimitBuyMatchesSell) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
 
     ASSERT_EQ(trades.size(), 1);
     EXPECT_EQ(trades[0].price, 10000);
     EXPECT_EQ(trades[0].quantity, 100);
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
 }
 
-TEST_F(MatchingEngineTest, LimitSellMatchesBuy) {
-    engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
-    auto trades = engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
+TYPED_TEST(MatchingEngineTest, LimitSellMatchesBuy) {
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+    auto trades = this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
 
     ASSERT_EQ(trades.size(), 1);
     EXPECT_EQ(trades[0].price, 10000);
     EXPECT_EQ(trades[0].quantity, 100);
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
 }
 
-TEST_F(MatchingEngineTest, BuyAtHigherPriceMatchesLowerAsk) {
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10100, 100);
+TYPED_TEST(MatchingEngineTest, BuyAtHigherPriceMatchesLowerAsk) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10100, 100);
 
     ASSERT_EQ(trades.size(), 1);
     // Matches at resting order's price (price-time priority)
@@ -46,155 +56,428 @@ TEST_F(MatchingEngineTest, BuyAtHigherPriceMatchesLowerAsk) {
     EXPECT_EQ(trades[0].quantity, 100);
 }
 
-TEST_F(MatchingEngineTest, NoMatchWhenPricesDontCross) {
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 100);
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+TYPED_TEST(MatchingEngineTest, NoMatchWhenPricesDontCross) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 100);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
 
     EXPECT_TRUE(trades.empty());
-    EXPECT_EQ(engine.book().total_order_count(), 2);
+    EXPECT_EQ(this->engine.book().total_order_count(), 2);
 }
 
 // --- Partial Fills ---
 
-TEST_F(MatchingEngineTest, PartialFillBuy) {
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 50);
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+TYPED_TEST(MatchingEngineTest, PartialFillBuy) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 50);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
 
     ASSERT_EQ(trades.size(), 1);
     EXPECT_EQ(trades[0].quantity, 50);
     // Remaining 50 should rest in the book
-    EXPECT_EQ(engine.book().total_order_count(), 1);
-    EXPECT_EQ(engine.book().get_volume_at_price(Side::BUY, 10000), 50);
+    EXPECT_EQ(this->engine.book().total_order_count(), 1);
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::BUY, 10000), 50);
 }
 
-TEST_F(MatchingEngineTest, PartialFillSell) {
-    engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 50);
-    auto trades = engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
+TYPED_TEST(MatchingEngineTest, PartialFillSell) {
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 50);
+    auto trades = this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
 
     ASSERT_EQ(trades.size(), 1);
     EXPECT_EQ(trades[0].quantity, 50);
-    EXPECT_EQ(engine.book().total_order_count(), 1);
-    EXPECT_EQ(engine.book().get_volume_at_price(Side::SELL, 10000), 50);
+    EXPECT_EQ(this->engine.book().total_order_count(), 1);
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::SELL, 10000), 50);
+}
+
+TYPED_TEST(MatchingEngineTest, FilledMakersLeaveLevelVolume) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 30);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 40);
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 45);
+
+    // First maker fully filled, second partly
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::SELL, 10000), 25);
+}
+
+TYPED_TEST(MatchingEngineTest, TopOfBookFollowsMatching) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 30);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 40);
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 10);
+
+    const auto& ask = this->engine.book().top(Side::SELL);
+    EXPECT_EQ(ask.price, 10000);
+    EXPECT_EQ(ask.quantity, 20);
+
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 20);   // level gone
+    EXPECT_EQ(ask.price, 10100);
+    EXPECT_EQ(ask.quantity, 40);
+    EXPECT_EQ(ask.order_count, 1);
+    EXPECT_EQ(this->engine.book().top(Side::BUY).order_count, 0);
 }
 
 // --- Multi-level Matching ---
 
-TEST_F(MatchingEngineTest, BuyMatchesMultipleAskLevels) {
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 50);
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 50);
+TYPED_TEST(MatchingEngineTest, BuyMatchesMultipleAskLevels) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 50);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 50);
 
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10100, 100);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10100, 100);
 
     ASSERT_EQ(trades.size(), 2);
     EXPECT_EQ(trades[0].price, 10000);
     EXPECT_EQ(trades[0].quantity, 50);
     EXPECT_EQ(trades[1].price, 10100);
     EXPECT_EQ(trades[1].quantity, 50);
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
 }
 
 // --- Time Priority (FIFO) ---
 
-TEST_F(MatchingEngineTest, FIFOWithinPriceLevel) {
+TYPED_TEST(MatchingEngineTest, FIFOWithinPriceLevel) {
     // First sell order (order_id = 1)
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
     // Second sell order (order_id = 2)
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);
 
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
 
     ASSERT_EQ(trades.size(), 1);
     // Should match with first order (id=1), not second
     EXPECT_EQ(trades[0].seller_order_id, 1);
 }
 
+TYPED_TEST(MatchingEngineTest, CancelFromMiddleKeepsQueueOrder) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);  // id 1
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);  // id 2
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);  // id 3
+
+    EXPECT_TRUE(this->engine.cancel_order(2));
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::SELL, 10000), 200);
+
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 200);
+    ASSERT_EQ(trades.size(), 2);
+    EXPECT_EQ(trades[0].seller_order_id, 1);
+    EXPECT_EQ(trades[1].seller_order_id, 3);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
+}
+
 // --- Market Orders ---
 
-TEST_F(MatchingEngineTest, MarketBuyMatchesAllAvailable) {
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 50);
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 50);
+TYPED_TEST(MatchingEngineTest, MarketBuyMatchesAllAvailable) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 50);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 50);
 
-    auto trades = engine.process_order(Side::BUY, OrderType::MARKET, 0, 100);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::MARKET, 0, 100);
 
     ASSERT_EQ(trades.size(), 2);
     EXPECT_EQ(trades[0].quantity, 50);
     EXPECT_EQ(trades[1].quantity, 50);
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
 }
 
-TEST_F(MatchingEngineTest, MarketSellMatchesBids) {
-    engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
-    auto trades = engine.process_order(Side::SELL, OrderType::MARKET, 0, 50);
+TYPED_TEST(MatchingEngineTest, MarketSellMatchesBids) {
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+    auto trades = this->engine.process_order(Side::SELL, OrderType::MARKET, 0, 50);
 
     ASSERT_EQ(trades.size(), 1);
     EXPECT_EQ(trades[0].quantity, 50);
     // Remaining 50 on bid side
-    EXPECT_EQ(engine.book().get_volume_at_price(Side::BUY, 10000), 50);
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::BUY, 10000), 50);
 }
 
-TEST_F(MatchingEngineTest, MarketOrderEmptyBookDoesNotRest) {
-    auto trades = engine.process_order(Side::BUY, OrderType::MARKET, 0, 100);
+TYPED_TEST(MatchingEngineTest, MarketOrderEmptyBookDoesNotRest) {
+    auto trades = this->engine.process_order(Side::BUY, OrderType::MARKET, 0, 100);
     EXPECT_TRUE(trades.empty());
     // Market order should not rest in book
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
 }
 
-TEST_F(MatchingEngineTest, MarketOrderPartialFillRemainsDiscarded) {
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 30);
-    auto trades = engine.process_order(Side::BUY, OrderType::MARKET, 0, 100);
+TYPED_TEST(MatchingEngineTest, MarketOrderPartialFillRemainsDiscarded) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 30);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::MARKET, 0, 100);
 
     ASSERT_EQ(trades.size(), 1);
     EXPECT_EQ(trades[0].quantity, 30);
     // Unfilled remainder of market order is discarded
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
 }
 
 // --- Cancel Orders ---
 
-TEST_F(MatchingEngineTest, CancelExistingOrder) {
-    engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
-    EXPECT_EQ(engine.book().total_order_count(), 1);
+TYPED_TEST(MatchingEngineTest, CancelExistingOrder) {
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+    EXPECT_EQ(this->engine.book().total_order_count(), 1);
 
-    bool cancelled = engine.cancel_order(1);
+    bool cancelled = this->engine.cancel_order(1);
     EXPECT_TRUE(cancelled);
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
 }
 
-TEST_F(MatchingEngineTest, CancelNonExistentOrder) {
-    bool cancelled = engine.cancel_order(999);
+TYPED_TEST(MatchingEngineTest, CancelNonExistentOrder) {
+    bool cancelled = this->engine.cancel_order(999);
     EXPECT_FALSE(cancelled);
 }
 
 // --- Order ID Assignment ---
 
-TEST_F(MatchingEngineTest, OrderIdsIncrement) {
-    engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
-    engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 100);
+TYPED_TEST(MatchingEngineTest, OrderIdsIncrement) {
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 100);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 100);
 
     // These orders should have IDs 1 and 2
-    EXPECT_TRUE(engine.book().has_order(1));
-    EXPECT_TRUE(engine.book().has_order(2));
+    EXPECT_TRUE(this->engine.book().has_order(1));
+    EXPECT_TRUE(this->engine.book().has_order(2));
 }
 
 // --- Stress: many orders ---
 
-TEST_F(MatchingEngineTest, ManyOrdersNoMatch) {
+TYPED_TEST(MatchingEngineTest, ManyOrdersNoMatch) {
     for (int i = 0; i < 1000; ++i) {
-        engine.process_order(Side::BUY, OrderType::LIMIT, 10000 - i, 10);
+        this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000 - i, 10);
     }
-    EXPECT_EQ(engine.book().total_order_count(), 1000);
-    EXPECT_EQ(engine.book().best_bid().value(), 10000);
+    EXPECT_EQ(this->engine.book().total_order_count(), 1000);
+    EXPECT_EQ(this->engine.book().best_bid().value(), 10000);
 }
 
-TEST_F(MatchingEngineTest, LargeMatchSweep) {
+TYPED_TEST(MatchingEngineTest, LargeMatchSweep) {
     // Place 100 sell orders at different prices
     for (int i = 0; i < 100; ++i) {
-        engine.process_order(Side::SELL, OrderType::LIMIT, 10000 + i, 10);
+        this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000 + i, 10);
     }
 
     // One big buy that sweeps them all
-    auto trades = engine.process_order(Side::BUY, OrderType::LIMIT, 10099, 1000);
+    auto trades = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10099, 1000);
 
     EXPECT_EQ(trades.size(), 100);
-    EXPECT_EQ(engine.book().total_order_count(), 0);
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
+}
+
+// --- Trade sink ---
+
+TYPED_TEST(MatchingEngineTest, SinkReceivesTradesInOrder) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 50);
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 50);
+
+    std::vector<Trade> seen;
+    OrderId id = this->engine.process_order(Side::BUY, OrderType::LIMIT, 10100, 80,
+        [&](const Trade& t) { seen.push_back(t); });
+
+    EXPECT_EQ(id, 3);
+    ASSERT_EQ(seen.size(), 2);
+    EXPECT_EQ(seen[0].seller_order_id, 1);
+    EXPECT_EQ(seen[0].buyer_order_id, 3);
+    EXPECT_EQ(seen[0].quantity, 50);
+    EXPECT_EQ(seen[1].seller_order_id, 2);
+    EXPECT_EQ(seen[1].quantity, 30);
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::SELL, 10100), 20);
+}
+
+// --- Batch submission ---
+
+namespace {
+
+struct RecordingSink {
+    std::vector<OrderId> accepted;
+    std::vector<Trade> trades;
+    std::vector<bool> cancels;
+    std::vector<bool> amends;
+    size_t rejects = 0;
+
+    void on_accept(const OrderMessage&, OrderId id) { accepted.push_back(id); }
+    void on_trade(const OrderMessage&, const Trade& t) { trades.push_back(t); }
+    void on_cancel(const OrderMessage&, bool ok) { cancels.push_back(ok); }
+    void on_amend(const OrderMessage&, bool ok) { amends.push_back(ok); }
+    void on_reject(const OrderMessage&) { ++rejects; }
+};
+
+OrderMessage new_order(Side side, OrderType type, Price price, Quantity qty) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::NEW_ORDER);
+    m.side = static_cast<uint8_t>(side);
+    m.order_type = static_cast<uint8_t>(type);
+    m.price = price;
+    m.quantity = qty;
+    return m;
+}
+
+OrderMessage cancel(OrderId id) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::CANCEL);
+    m.order_id = id;
+    return m;
+}
+
+} // namespace
+
+TYPED_TEST(MatchingEngineTest, BatchMatchesSequentialCalls) {
+    std::vector<OrderMessage> batch;
+    for (int i = 0; i < 200; ++i) {
+        Side side = (i % 3 == 0) ? Side::BUY : Side::SELL;
+        batch.push_back(new_order(side, OrderType::LIMIT, 10000 + (i * 7) % 21 - 10, 10 + i % 50));
+        if (i % 5 == 4) batch.push_back(cancel(i - 2));
+        if (i % 17 == 0) batch.push_back(new_order(Side::BUY, OrderType::MARKET, 0, 75));
+    }
+    OrderMessage bogus{};
+    bogus.msg_type = 99;
+    batch.push_back(bogus);
+
+    RecordingSink sink;
+    this->engine.process_batch(batch, sink);
+
+    TypeParam reference;
+    std::vector<Trade> ref_trades;
+    std::vector<bool> ref_cancels;
+    for (const auto& m : batch) {
+        if (m.msg_type == static_cast<uint8_t>(MsgType::NEW_ORDER)) {
+            auto t = reference.process_order(static_cast<Side>(m.side),
+                static_cast<OrderType>(m.order_type), m.price, m.quantity);
+            ref_trades.insert(ref_trades.end(), t.begin(), t.end());
+        } else if (m.msg_type == static_cast<uint8_t>(MsgType::CANCEL)) {
+            ref_cancels.push_back(reference.cancel_order(m.order_id));
+        }
+    }
+
+    ASSERT_EQ(sink.trades.size(), ref_trades.size());
+    for (size_t i = 0; i < ref_trades.size(); ++i) {
+        EXPECT_EQ(sink.trades[i].buyer_order_id, ref_trades[i].buyer_order_id);
+        EXPECT_EQ(sink.trades[i].seller_order_id, ref_trades[i].seller_order_id);
+        EXPECT_EQ(sink.trades[i].price, ref_trades[i].price);
+        EXPECT_EQ(sink.trades[i].quantity, ref_trades[i].quantity);
+    }
+    EXPECT_EQ(sink.cancels, ref_cancels);
+    EXPECT_EQ(sink.rejects, 1);
+    EXPECT_EQ(sink.accepted.size(), reference.orders_processed());
+    EXPECT_EQ(sink.accepted.front(), 1);
+    EXPECT_EQ(this->engine.book().total_order_count(), reference.book().total_order_count());
+    EXPECT_EQ(this->engine.book().best_bid(), reference.book().best_bid());
+    EXPECT_EQ(this->engine.book().best_ask(), reference.book().best_ask());
+}
+
+TYPED_TEST(MatchingEngineTest, BatchRejectsNewOrdersWhenPoolIsFull) {
+    if constexpr (!std::is_same_v<typename TypeParam::PoolType, ObjectPool<Order>>) {
+        GTEST_SKIP() << "pool never fills";
+    } else {
+        PoolOptions options;
+        options.capacity = 2;
+        options.grow = false;
+        ObjectPool<Order> pool(options);
+        TypeParam engine(pool);
+
+        std::vector<OrderMessage> batch = {
+            new_order(Side::BUY, OrderType::LIMIT, 9900, 10),
+            new_order(Side::BUY, OrderType::LIMIT, 9800, 10),
+            new_order(Side::SELL, OrderType::LIMIT, 10100, 10),   // no slot left
+            cancel(1),
+            new_order(Side::SELL, OrderType::LIMIT, 10100, 10),   // reuses order 1's slot
+        };
+        RecordingSink sink;
+        engine.process_batch(batch, sink);
+
+        EXPECT_EQ(sink.rejects, 1);
+        EXPECT_EQ(sink.accepted, (std::vector<OrderId>{1, 2, 3}));
+        EXPECT_EQ(sink.cancels, std::vector<bool>{true});
+        EXPECT_EQ(engine.book().total_order_count(), 2);
+        EXPECT_EQ(pool.capacity(), 2);
+    }
+}
+
+// --- Amend ---
+
+TYPED_TEST(MatchingEngineTest, AmendDownKeepsTimePriority) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);   // 1
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);   // 2
+    ASSERT_TRUE(this->engine.amend_order(1, 10000, 60));
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::SELL, 10000), 160);
+    EXPECT_EQ(this->engine.book().top(Side::SELL).quantity, 160);
+
+    auto trades = this->engine.process_order(Side::BUY, OrderType::MARKET, 0, 70);
+    ASSERT_EQ(trades.size(), 2);
+    EXPECT_EQ(trades[0].seller_order_id, 1);
+    EXPECT_EQ(trades[0].quantity, 60);
+    EXPECT_EQ(trades[1].seller_order_id, 2);
+}
+
+TYPED_TEST(MatchingEngineTest, AmendUpLosesTimePriority) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);   // 1
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);   // 2
+    ASSERT_TRUE(this->engine.amend_order(1, 10000, 150));
+
+    auto trades = this->engine.process_order(Side::BUY, OrderType::MARKET, 0, 10);
+    ASSERT_EQ(trades.size(), 1);
+    EXPECT_EQ(trades[0].seller_order_id, 2);
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::SELL, 10000), 240);
+}
+
+TYPED_TEST(MatchingEngineTest, AmendPriceMovesLevelAndMatches) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 30);    // 1
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 9900, 50);      // 2
+
+    // Away from the touch: just moves
+    ASSERT_TRUE(this->engine.amend_order(2, 9950, 50));
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::BUY, 9900), 0);
+    EXPECT_EQ(this->engine.book().best_bid(), 9950);
+
+    // Through the ask: trades as the same order, the rest rests at the new price
+    std::vector<Trade> trades;
+    ASSERT_TRUE(this->engine.amend_order(2, 10100, 50,
+                                         [&](const Trade& t) { trades.push_back(t); }));
+    ASSERT_EQ(trades.size(), 1);
+    EXPECT_EQ(trades[0].buyer_order_id, 2);
+    EXPECT_EQ(trades[0].seller_order_id, 1);
+    EXPECT_EQ(trades[0].quantity, 30);
+    EXPECT_EQ(this->engine.book().best_bid(), 10100);
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::BUY, 10100), 20);
+    EXPECT_FALSE(this->engine.book().best_ask().has_value());
+    EXPECT_EQ(this->engine.book().total_order_count(), 1);
+}
+
+TYPED_TEST(MatchingEngineTest, AmendThatFillsCompletelyFreesTheOrder) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 50);    // 1
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 9900, 50);      // 2
+    ASSERT_TRUE(this->engine.amend_order(2, 10100, 50));
+    EXPECT_EQ(this->engine.book().total_order_count(), 0);
+    EXPECT_FALSE(this->engine.book().has_order(2));
+    EXPECT_EQ(this->engine.pool().allocated_count(), 0);
+}
+
+TYPED_TEST(MatchingEngineTest, AmendCountsFilledQuantity) {
+    this->engine.process_order(Side::SELL, OrderType::LIMIT, 10000, 100);   // 1
+    this->engine.process_order(Side::BUY, OrderType::LIMIT, 10000, 40);
+    // 60 open of 100; total 70 leaves 30 open
+    ASSERT_TRUE(this->engine.amend_order(1, 10000, 70));
+    EXPECT_EQ(this->engine.book().get_volume_at_price(Side::SELL, 10000), 30);
+
+    // At or below what has filled: gone
+    ASSERT_TRUE(this->engine.amend_order(1, 10000, 40));
+    EXPECT_FALSE(this->engine.book().has_order(1));
+    EXPECT_FALSE(this->engine.book().best_ask().has_value());
+    EXPECT_FALSE(this->engine.amend_order(1, 10000, 10));
+    EXPECT_FALSE(this->engine.amend_order(99, 10000, 10));
+}
+
+TYPED_TEST(MatchingEngineTest, BatchAmendAcksBeforeItsTrades) {
+    OrderMessage amend{};
+    amend.msg_type = static_cast<uint8_t>(MsgType::AMEND);
+    amend.order_id = 2;
+    amend.price = 10100;
+    amend.quantity = 50;
+    OrderMessage unknown = amend;
+    unknown.order_id = 42;
+
+    std::vector<OrderMessage> batch = {
+        new_order(Side::SELL, OrderType::LIMIT, 10100, 30),
+        new_order(Side::BUY, OrderType::LIMIT, 9900, 50),
+        amend,
+        unknown,
+    };
+    struct OrderedSink : RecordingSink {
+        std::vector<char> events;
+        void on_accept(const OrderMessage& m, OrderId id) { events.push_back('N'); RecordingSink::on_accept(m, id); }
+        void on_trade(const OrderMessage& m, const Trade& t) { events.push_back('T'); RecordingSink::on_trade(m, t); }
+        void on_amend(const OrderMessage& m, bool ok) { events.push_back('A'); RecordingSink::on_amend(m, ok); }
+    } sink;
+    this->engine.process_batch(batch, sink);
+
+    EXPECT_EQ(sink.amends, (std::vector<bool>{true, false}));
+    EXPECT_EQ(std::string(sink.events.begin(), sink.events.end()), "NNATA");
+    ASSERT_EQ(sink.trades.size(), 1);
+    EXPECT_EQ(sink.trades[0].buyer_order_id, 2);
+    EXPECT_EQ(sink.accepted, (std::vector<OrderId>{1, 2}));
 }
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "node_pool.h"
+#include "map_levels.h"
+#include "object_pool.h"
+#include <functional>
+#include <set>
+#include <vector>
+
+using namespace ob;
+
+TEST(NodePool, MapNodesRecycleFreedSlots) {
+    NodePool pool(8);
+    PooledMap<int, int, std::less<>> map{std::less<>{}, PoolAllocator<std::pair<const int, int>>(pool)};
+
+    for (int i = 0; i < 20; ++i) map[i] = i;
+    EXPECT_EQ(pool.allocated_count(), 20);
+    EXPECT_EQ(pool.capacity(), 24);   // three chunks of 8
+
+    // Churn at a steady size: no new chunks
+    for (int round = 0; round < 100; ++round) {
+        map.erase(round % 20);
+        map[round % 20] = round;
+    }
+    EXPECT_EQ(pool.capacity(), 24);
+
+    map.clear();
+    EXPECT_EQ(pool.allocated_count(), 0);
+}
+
+TEST(NodePool, ReserveCarvesAhead) {
+    NodePool pool(4);
+    PooledMap<int, int, std::less<>> map{std::less<>{}, PoolAllocator<std::pair<const int, int>>(pool)};
+    map[0] = 0;
+    pool.reserve(10);
+    size_t cap = pool.capacity();
+    EXPECT_GE(cap - pool.allocated_count(), 10u);
+    for (int i = 1; i <= 10; ++i) map[i] = i;
+    EXPECT_EQ(pool.capacity(), cap);
+}
+
+TEST(NodePool, ArraysGoToTheHeap) {
+    NodePool pool;
+    PoolAllocator<int> alloc(pool);
+    int* one = alloc.allocate(1);
+    int* many = alloc.allocate(16);
+    EXPECT_EQ(pool.allocated_count(), 1);
+    many[15] = 1;
+    alloc.deallocate(many, 16);
+    alloc.deallocate(one, 1);
+    EXPECT_EQ(pool.allocated_count(), 0);
+
+    PoolAllocator<double> rebound(alloc);
+    EXPECT_TRUE(rebound == alloc);
+}
+
+TEST(NodePool, MapLevelsReuseLevelNodes) {
+    MapLevels<Side::BUY> levels;
+    ObjectPool<Order> pool;
+    std::vector<Order*> orders(64);
+    for (size_t i = 0; i < orders.size(); ++i) {
+        Order* o = pool.allocate();
+        o->id = i + 1;
+        o->quantity = 10;
+        o->filled_qty = 0;
+        o->info() = {o->id, 100 + static_cast<Price>(i % 8), Side::BUY, OrderType::LIMIT};
+        orders[i] = o;
+    }
+
+    // Levels appear and empty repeatedly; the same slots come back
+    std::set<const void*> addresses;
+    for (int round = 0; round < 8; ++round) {
+        for (Order* o : orders) levels.add(o);
+        for (Price p = 100; p < 108; ++p) addresses.insert(levels.find(p));
+        for (Order* o : orders) levels.remove(o);
+        EXPECT_TRUE(levels.empty());
+    }
+    EXPECT_EQ(addresses.size(), 8u);
+    EXPECT_EQ(levels.node_pool().allocated_count(), 0);
+}
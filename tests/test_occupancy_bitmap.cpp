@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "occupancy_bitmap.h"
+#include <random>
+#include <set>
+
+using namespace ob;
+
+TEST(OccupancyBitmap, EmptyFindsNothing) {
+    OccupancyBitmap bits(4096);
+    EXPECT_FALSE(bits.any());
+    EXPECT_EQ(bits.first(), OccupancyBitmap::NPOS);
+    EXPECT_EQ(bits.last(), OccupancyBitmap::NPOS);
+    EXPECT_EQ(bits.next(0), OccupancyBitmap::NPOS);
+    EXPECT_EQ(bits.prev(4095), OccupancyBitmap::NPOS);
+}
+
+TEST(OccupancyBitmap, FindsAcrossWordsAndLevels) {
+    OccupancyBitmap bits(1 << 20);   // four levels
+    bits.set(5);
+    bits.set(1'000'000);
+    EXPECT_EQ(bits.first(), 5u);
+    EXPECT_EQ(bits.last(), 1'000'000u);
+    EXPECT_EQ(bits.next(5), 1'000'000u);
+    EXPECT_EQ(bits.prev(1'000'000), 5u);
+    EXPECT_EQ(bits.next(1'000'000), OccupancyBitmap::NPOS);
+
+    // Clearing the only bit of a word clears its summary bits too
+    bits.reset(5);
+    EXPECT_EQ(bits.first(), 1'000'000u);
+    EXPECT_EQ(bits.prev(1'000'000), OccupancyBitmap::NPOS);
+    bits.reset(1'000'000);
+    EXPECT_FALSE(bits.any());
+}
+
+TEST(OccupancyBitmap, MatchesOrderedSetUnderChurn) {
+    for (size_t size : {1u, 63u, 64u, 65u, 4096u, 5000u, 300'000u}) {
+        OccupancyBitmap bits(size);
+        std::set<size_t> ref;
+        std::mt19937 rng(static_cast<unsigned>(size));
+        std::uniform_int_distribution<size_t> slot(0, size - 1);
+
+        for (int step = 0; step < 5000; ++step) {
+            size_t i = slot(rng);
+            if (rng() % 2) {
+                bits.set(i);
+                ref.insert(i);
+            } else {
+                bits.reset(i);
+                ref.erase(i);
+            }
+            ASSERT_EQ(bits.test(i), ref.count(i) == 1);
+
+            size_t probe = slot(rng);
+            auto above = ref.upper_bound(probe);
+            auto below = ref.lower_bound(probe);
+            ASSERT_EQ(bits.next(probe), above == ref.end() ? OccupancyBitmap::NPOS : *above);
+            ASSERT_EQ(bits.prev(probe), below == ref.begin() ? OccupancyBitmap::NPOS : *std::prev(below));
+            ASSERT_EQ(bits.first(), ref.empty() ? OccupancyBitmap::NPOS : *ref.begin());
+            ASSERT_EQ(bits.last(), ref.empty() ? OccupancyBitmap::NPOS : *ref.rbegin());
+        }
+    }
+}
@@ -4,110 +4,159 @@
 
 using namespace ob;
 
+template <typename Book>
 class OrderBookTest : public ::testing::Test {
 protected:
     ObjectPool<Order> pool;
-    OrderBook book;
+    Book book;
 
     Order* make_order(OrderId id, Side side, Price price, Quantity qty) {
         Order* o = pool.allocate();
         o->id = id;
-        o->timestamp = id;
-        o->price = price;
         o->quantity = qty;
         o->filled_qty = 0;
-        o->side = side;
-        o->type = OrderType::LIMIT;
+        o->info() = {id, price, side, OrderType::LIMIT};
         return o;
     }
 };
 
-TEST_F(OrderBookTest, EmptyBook) {
-    EXPECT_FALSE(book.best_bid().has_value());
-    EXPECT_FALSE(book.best_ask().has_value());
-    EXPECT_EQ(book.total_order_count(), 0);
+using BookTypes = ::testing::Types<OrderBook, LadderOrderBook>;
+TYPED_TEST_SUITE(OrderBookTest, BookTypes);
+
+TYPED_TEST(OrderBookTest, EmptyBook) {
+    EXPECT_FALSE(this->book.best_bid().has_value());
+    EXPECT_FALSE(this->book.best_ask().has_value());
+    EXPECT_EQ(this->book.total_order_count(), 0);
 }
 
-TEST_F(OrderBookTest, AddBidOrder) {
-    Order* o = make_order(1, Side::BUY, 10000, 100);
-    book.add_order(o);
+TYPED_TEST(OrderBookTest, AddBidOrder) {
+    Order* o = this->make_order(1, Side::BUY, 10000, 100);
+    this->book.add_order(o);
 
-    EXPECT_EQ(book.best_bid().value(), 10000);
-    EXPECT_FALSE(book.best_ask().has_value());
-    EXPECT_EQ(book.total_order_count(), 1);
-    EXPECT_EQ(book.get_volume_at_price(Side::BUY, 10000), 100);
+    EXPECT_EQ(this->book.best_bid().value(), 10000);
+    EXPECT_FALSE(this->book.best_ask().has_value());
+    EXPECT_EQ(this->book.total_order_count(), 1);
+    EXPECT_EQ(this->book.get_volume_at_price(Side::BUY, 10000), 100);
 }
 
-TEST_F(OrderBookTest, AddAskOrder) {
-    Order* o = make_order(1, Side::SELL, 10100, 50);
-    book.add_order(o);
+TYPED_TEST(OrderBookTest, AddAskOrder) {
+    Order* o = this->make_order(1, Side::SELL, 10100, 50);
+    this->book.add_order(o);
 
-    EXPECT_FALSE(book.best_bid().has_value());
-    EXPECT_EQ(book.best_ask().value(), 10100);
-    EXPECT_EQ(book.get_volume_at_price(Side::SELL, 10100), 50);
+    EXPECT_FALSE(this->book.best_bid().has_value());
+    EXPECT_EQ(this->book.best_ask().value(), 10100);
+    EXPECT_EQ(this->book.get_volume_at_price(Side::SELL, 10100), 50);
 }
 
-TEST_F(OrderBookTest, BestBidIsHighest) {
-    book.add_order(make_order(1, Side::BUY, 10000, 100));
-    book.add_order(make_order(2, Side::BUY, 10100, 100));
-    book.add_order(make_order(3, Side::BUY, 9900, 100));
+TYPED_TEST(OrderBookTest, BestBidIsHighest) {
+    this->book.add_order(this->make_order(1, Side::BUY, 10000, 100));
+    this->book.add_order(this->make_order(2, Side::BUY, 10100, 100));
+    this->book.add_order(this->make_order(3, Side::BUY, 9900, 100));
 
-    EXPECT_EQ(book.best_bid().value(), 10100);
+    EXPECT_EQ(this->book.best_bid().value(), 10100);
 }
 
-TEST_F(OrderBookTest, BestAskIsLowest) {
-    book.add_order(make_order(1, Side::SELL, 10200, 100));
-    book.add_order(make_order(2, Side::SELL, 10100, 100));
-    book.add_order(make_order(3, Side::SELL, 10300, 100));
+TYPED_TEST(OrderBookTest, BestAskIsLowest) {
+    this->book.add_order(this->make_order(1, Side::SELL, 10200, 100));
+    this->book.add_order(this->make_order(2, Side::SELL, 10100, 100));
+    this->book.add_order(this->make_order(3, Side::SELL, 10300, 100));
 
-    EXPECT_EQ(book.best_ask().value(), 10100);
+    EXPECT_EQ(this->book.best_ask().value(), 10100);
 }
 
-TEST_F(OrderBookTest, CancelOrder) {
-    Order* o = make_order(1, Side::BUY, 10000, 100);
-    book.add_order(o);
-    EXPECT_EQ(book.total_order_count(), 1);
+TYPED_TEST(OrderBookTest, CancelOrder) {
+    Order* o = this->make_order(1, Side::BUY, 10000, 100);
+    this->book.add_order(o);
+    EXPECT_EQ(this->book.total_order_count(), 1);
 
-    Order* cancelled = book.cancel_order(1);
+    Order* cancelled = this->book.cancel_order(1);
     EXPECT_EQ(cancelled, o);
-    EXPECT_EQ(book.total_order_count(), 0);
-    EXPECT_FALSE(book.best_bid().has_value());
+    EXPECT_EQ(this->book.total_order_count(), 0);
+    EXPECT_FALSE(this->book.best_bid().has_value());
 
-    pool.deallocate(cancelled);
+    this->pool.deallocate(cancelled);
 }
 
-TEST_F(OrderBookTest, CancelNonExistent) {
-    Order* cancelled = book.cancel_order(999);
+TYPED_TEST(OrderBookTest, CancelNonExistent) {
+    Order* cancelled = this->book.cancel_order(999);
     EXPECT_EQ(cancelled, nullptr);
 }
 
-TEST_F(OrderBookTest, VolumeAtPrice) {
-    book.add_order(make_order(1, Side::BUY, 10000, 100));
-    book.add_order(make_order(2, Side::BUY, 10000, 200));
-    book.add_order(make_order(3, Side::BUY, 9900, 50));
+TYPED_TEST(OrderBookTest, VolumeAtPrice) {
+    this->book.add_order(this->make_order(1, Side::BUY, 10000, 100));
+    this->book.add_order(this->make_order(2, Side::BUY, 10000, 200));
+    this->book.add_order(this->make_order(3, Side::BUY, 9900, 50));
+
+    EXPECT_EQ(this->book.get_volume_at_price(Side::BUY, 10000), 300);
+    EXPECT_EQ(this->book.get_volume_at_price(Side::BUY, 9900), 50);
+    EXPECT_EQ(this->book.get_volume_at_price(Side::BUY, 9800), 0);
+}
+
+TYPED_TEST(OrderBookTest, MultipleLevels) {
+    this->book.add_order(this->make_order(1, Side::BUY, 10000, 100));
+    this->book.add_order(this->make_order(2, Side::BUY, 9900, 200));
+    this->book.add_order(this->make_order(3, Side::SELL, 10100, 150));
+    this->book.add_order(this->make_order(4, Side::SELL, 10200, 250));
 
-    EXPECT_EQ(book.get_volume_at_price(Side::BUY, 10000), 300);
-    EXPECT_EQ(book.get_volume_at_price(Side::BUY, 9900), 50);
-    EXPECT_EQ(book.get_volume_at_price(Side::BUY, 9800), 0);
+    EXPECT_EQ(this->book.bid_level_count(), 2);
+    EXPECT_EQ(this->book.ask_level_count(), 2);
+    EXPECT_EQ(this->book.total_order_count(), 4);
 }
 
-TEST_F(OrderBookTest, MultipleLevels) {
-    book.add_order(make_order(1, Side::BUY, 10000, 100));
-    book.add_order(make_order(2, Side::BUY, 9900, 200));
-    book.add_order(make_order(3, Side::SELL, 10100, 150));
-    book.add_order(make_order(4, Side::SELL, 10200, 250));
+TYPED_TEST(OrderBookTest, CancelRemovesEmptyLevel) {
+    Order* o = this->make_order(1, Side::SELL, 10100, 100);
+    this->book.add_order(o);
+    EXPECT_EQ(this->book.ask_level_count(), 1);
 
-    EXPECT_EQ(book.bid_level_count(), 2);
-    EXPECT_EQ(book.ask_level_count(), 2);
-    EXPECT_EQ(book.total_order_count(), 4);
+    Order* cancelled = this->book.cancel_order(1);
+    EXPECT_EQ(this->book.ask_level_count(), 0);
+    this->pool.deallocate(cancelled);
 }
 
-TEST_F(OrderBookTest, CancelRemovesEmptyLevel) {
-    Order* o = make_order(1, Side::SELL, 10100, 100);
-    book.add_order(o);
-    EXPECT_EQ(book.ask_level_count(), 1);
+TYPED_TEST(OrderBookTest, TopTracksAddsAndCancels) {
+    EXPECT_EQ(this->book.top(Side::BUY).order_count, 0);
+
+    this->book.add_order(this->make_order(1, Side::BUY, 10000, 100));
+    this->book.add_order(this->make_order(2, Side::BUY, 10000, 50));
+    this->book.add_order(this->make_order(3, Side::BUY, 9900, 70));   // worse: top unchanged
+
+    const LevelSnapshot& bid = this->book.top(Side::BUY);
+    EXPECT_EQ(bid.price, 10000);
+    EXPECT_EQ(bid.quantity, 150);
+    EXPECT_EQ(bid.order_count, 2);
 
-    Order* cancelled = book.cancel_order(1);
-    EXPECT_EQ(book.ask_level_count(), 0);
-    pool.deallocate(cancelled);
+    this->book.add_order(this->make_order(4, Side::BUY, 10050, 5));  // better: new top
+    EXPECT_EQ(this->book.top(Side::BUY).price, 10050);
+
+    this->pool.deallocate(this->book.cancel_order(4));
+    this->pool.deallocate(this->book.cancel_order(1));
+    EXPECT_EQ(this->book.top(Side::BUY).price, 10000);
+    EXPECT_EQ(this->book.top(Side::BUY).quantity, 50);
+    EXPECT_EQ(this->book.top(Side::BUY).order_count, 1);
+
+    this->pool.deallocate(this->book.cancel_order(2));
+    EXPECT_EQ(this->book.top(Side::BUY).price, 9900);
+    this->pool.deallocate(this->book.cancel_order(3));
+    EXPECT_EQ(this->book.top(Side::BUY).order_count, 0);
+    EXPECT_FALSE(this->book.best_bid().has_value());
+}
+
+TYPED_TEST(OrderBookTest, GetDepthFillsCallerBuffer) {
+    for (OrderId id = 1; id <= 5; ++id) {
+        this->book.add_order(this->make_order(id, Side::SELL, 10000 + static_cast<Price>(id) * 10,
+                                              static_cast<Quantity>(id)));
+    }
+    this->book.add_order(this->make_order(6, Side::SELL, 10010, 4));
+
+    LevelSnapshot out[3];
+    size_t n = this->book.get_depth(Side::SELL, 10, out);   // buffer caps at 3
+    ASSERT_EQ(n, 3);
+    EXPECT_EQ(out[0].price, 10010);
+    EXPECT_EQ(out[0].quantity, 5);
+    EXPECT_EQ(out[0].order_count, 2);
+    EXPECT_EQ(out[1].price, 10020);
+    EXPECT_EQ(out[2].price, 10030);
+
+    EXPECT_EQ(this->book.get_depth(Side::SELL, 2, out), 2);
+    EXPECT_EQ(this->book.get_depth(Side::BUY, 10, out), 0);
 }
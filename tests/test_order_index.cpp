@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "order_index.h"
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace ob;
+
+namespace {
+
+// Distinct fake pointers; the index never dereferences them
+Order* fake(uint64_t n) { return reinterpret_cast<Order*>((n + 1) * 64); }
+
+} // namespace
+
+TEST(FlatOrderMap, InsertFindErase) {
+    FlatOrderMap map;
+    map.insert(7, fake(7));
+    map.insert(42, fake(42));
+
+    EXPECT_EQ(map.find(7), fake(7));
+    EXPECT_EQ(map.find(42), fake(42));
+    EXPECT_EQ(map.find(8), nullptr);
+    EXPECT_EQ(map.size(), 2);
+
+    EXPECT_TRUE(map.erase(7));
+    EXPECT_FALSE(map.erase(7));
+    EXPECT_EQ(map.find(7), nullptr);
+    EXPECT_EQ(map.find(42), fake(42));
+}
+
+TEST(FlatOrderMap, MatchesUnorderedMapUnderChurn) {
+    FlatOrderMap map;
+    std::unordered_map<OrderId, Order*> ref;
+    std::mt19937_64 rng(1);
+
+    for (int i = 0; i < 50000; ++i) {
+        OrderId id = rng() % 2000;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(map.erase(id), ref.erase(id) > 0);
+        } else {
+            map.insert(id, fake(id));
+            ref[id] = fake(id);
+        }
+    }
+    ASSERT_EQ(map.size(), ref.size());
+    for (OrderId id = 0; id < 2000; ++id) {
+        auto it = ref.find(id);
+        EXPECT_EQ(map.find(id), it == ref.end() ? nullptr : it->second);
+    }
+}
+
+TEST(OrderIndex, SequentialIds) {
+    OrderIndex index;
+    for (OrderId id = 1; id <= 10000; ++id) {
+        index.insert(id, fake(id));
+    }
+    EXPECT_EQ(index.size(), 10000);
+    EXPECT_EQ(index.find(1), fake(1));
+    EXPECT_EQ(index.find(9999), fake(9999));
+    EXPECT_EQ(index.find(10001), nullptr);
+
+    EXPECT_TRUE(index.erase(5000));
+    EXPECT_FALSE(index.erase(5000));
+    EXPECT_FALSE(index.contains(5000));
+    EXPECT_EQ(index.size(), 9999);
+}
+
+TEST(OrderIndex, RetiresDeadChunks) {
+    OrderIndex index;
+    const OrderId n = OrderIndex::CHUNK_SIZE * 4;
+    for (OrderId id = 1; id <= n; ++id) {
+        index.insert(id, fake(id));
+    }
+    EXPECT_EQ(index.chunk_count(), 5);   // ids 1..n span chunks 0..4
+
+    // Kill everything in the first two chunks
+    for (OrderId id = 1; id < OrderIndex::CHUNK_SIZE * 2; ++id) {
+        index.erase(id);
+    }
+    EXPECT_EQ(index.chunk_count(), 3);
+    EXPECT_EQ(index.find(OrderIndex::CHUNK_SIZE * 2), fake(OrderIndex::CHUNK_SIZE * 2));
+
+    // A late (out-of-sequence) id behind the window still works via fallback
+    index.insert(3, fake(3));
+    EXPECT_EQ(index.find(3), fake(3));
+    EXPECT_TRUE(index.erase(3));
+    EXPECT_EQ(index.find(3), nullptr);
+}
+
+TEST(OrderIndex, HeadChunkIsNotRetired) {
+    OrderIndex index;
+    index.insert(1, fake(1));
+    index.erase(1);
+    // Newest chunk stays allocated for the ids that follow
+    EXPECT_EQ(index.chunk_count(), 1);
+    index.insert(2, fake(2));
+    EXPECT_EQ(index.find(2), fake(2));
+}
+
+// Each chunk empties while it is still the head; it goes once ids move
+// past it, so the window doesn't grow with the id range
+TEST(OrderIndex, RetiresHeadChunkOnceIdsMoveOn) {
+    OrderIndex index;
+    for (OrderId id = 1; id <= OrderIndex::CHUNK_SIZE * 8; ++id) {
+        index.insert(id, fake(id));
+        index.erase(id);
+    }
+    EXPECT_EQ(index.chunk_count(), 1);
+    EXPECT_EQ(index.size(), 0);
+    index.insert(OrderIndex::CHUNK_SIZE * 8 + 1, fake(1));
+    EXPECT_EQ(index.find(OrderIndex::CHUNK_SIZE * 8 + 1), fake(1));
+}
+
+TEST(OrderIndex, FarAheadIdsUseFallback) {
+    OrderIndex index;
+    index.insert(1, fake(1));
+    OrderId far = OrderId{1} << 40;
+    index.insert(far, fake(far));
+
+    EXPECT_EQ(index.size(), 2);
+    EXPECT_EQ(index.chunk_count(), 1);
+    EXPECT_EQ(index.find(far), fake(far));
+    EXPECT_TRUE(index.erase(far));
+    EXPECT_EQ(index.size(), 1);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "order_log.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+using namespace ob;
+
+namespace {
+
+std::string temp_path(const char* name) {
+    return (std::filesystem::temp_directory_path() /
+            (std::string("ob-log-") + name + "-" + std::to_string(getpid()) + ".log")).string();
+}
+
+OrderMessage order(uint64_t i) {
+    OrderMessage msg{};
+    msg.msg_type = static_cast<uint8_t>(i % 5 ? MsgType::NEW_ORDER : MsgType::CANCEL);
+    msg.side = static_cast<uint8_t>(i % 2 ? Side::BUY : Side::SELL);
+    msg.symbol_id = static_cast<SymbolId>(i % 3);
+    msg.order_id = i / 2;
+    msg.price = 10000 + static_cast<Price>(i % 17);
+    msg.quantity = static_cast<Quantity>(1 + i % 9);
+    return msg;
+}
+
+} // namespace
+
+TEST(OrderLog, RoundTripsRecords) {
+    // Spans several writer buffers
+    constexpr uint64_t N = 40000;
+    std::string path = temp_path("roundtrip");
+    {
+        OrderLogWriter log;
+        ASSERT_TRUE(log.open(path));
+        for (uint64_t i = 0; i < N; ++i) log.append(i * 100, order(i));
+        ASSERT_TRUE(log.close());
+        EXPECT_EQ(log.count(), N);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), sizeof(OrderLogHeader) + N * sizeof(OrderLogRecord));
+
+    OrderLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    auto records = reader.records();
+    ASSERT_EQ(records.size(), N);
+    for (uint64_t i = 0; i < N; i += 997) {
+        OrderMessage expect = order(i);
+        EXPECT_EQ(records[i].timestamp_ns, i * 100);
+        EXPECT_EQ(std::memcmp(&records[i].msg, &expect, sizeof(expect)), 0) << "record " << i;
+    }
+    std::remove(path.c_str());
+}
+
+TEST(OrderLog, TruncatedFileKeepsWholeRecords) {
+    std::string path = temp_path("truncated");
+    {
+        OrderLogWriter log;
+        ASSERT_TRUE(log.open(path));
+        for (uint64_t i = 0; i < 10; ++i) log.append(i, order(i));
+    }
+    std::filesystem::resize_file(path, sizeof(OrderLogHeader) + 7 * sizeof(OrderLogRecord) + 5);
+
+    OrderLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_EQ(reader.records().size(), 7u);
+    EXPECT_EQ(reader.records()[6].timestamp_ns, 6u);
+    std::remove(path.c_str());
+}
+
+TEST(OrderLog, RejectsOtherFiles) {
+    std::string path = temp_path("other");
+    std::ofstream(path) << "LIMIT,BUY,100.00,5\nLIMIT,SELL,100.00,5\nPRINT\n";
+
+    OrderLogReader reader;
+    EXPECT_FALSE(reader.open(path));
+    EXPECT_FALSE(reader.open("/nonexistent/orders.log"));
+    EXPECT_TRUE(reader.records().empty());
+    std::remove(path.c_str());
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "price_level.h"
+#include "object_pool.h"
+#include <vector>
+
+using namespace ob;
+
+class PriceLevelTest : public ::testing::Test {
+protected:
+    ObjectPool<Order> pool;
+    PriceLevel level;
+
+    Order* make_order(OrderId id, Quantity qty) {
+        Order* o = pool.allocate();
+        o->id = id;
+        o->quantity = qty;
+        o->filled_qty = 0;
+        o->info() = {id, 10000, Side::BUY, OrderType::LIMIT};
+        return o;
+    }
+
+    std::vector<OrderId> ids() const {
+        std::vector<OrderId> out;
+        for (Order* o = level.front(); o; o = o->next) out.push_back(o->id);
+        return out;
+    }
+};
+
+TEST_F(PriceLevelTest, AppendKeepsFifoOrder) {
+    level.add(make_order(1, 10));
+    level.add(make_order(2, 20));
+    level.add(make_order(3, 30));
+
+    EXPECT_EQ(ids(), (std::vector<OrderId>{1, 2, 3}));
+    EXPECT_EQ(level.order_count(), 3);
+    EXPECT_EQ(level.total_quantity(), 60);
+}
+
+TEST_F(PriceLevelTest, PopFront) {
+    level.add(make_order(1, 10));
+    level.add(make_order(2, 20));
+
+    level.pop_front();
+    EXPECT_EQ(level.front()->id, 2);
+    EXPECT_EQ(level.total_quantity(), 20);
+
+    level.pop_front();
+    EXPECT_TRUE(level.is_empty());
+    EXPECT_EQ(level.total_quantity(), 0);
+}
+
+TEST_F(PriceLevelTest, RemoveFromMiddleHeadAndTail) {
+    Order* a = make_order(1, 10);
+    Order* b = make_order(2, 20);
+    Order* c = make_order(3, 30);
+    Order* d = make_order(4, 40);
+    level.add(a);
+    level.add(b);
+    level.add(c);
+    level.add(d);
+
+    level.remove(b);
+    EXPECT_EQ(ids(), (std::vector<OrderId>{1, 3, 4}));
+    level.remove(a);
+    EXPECT_EQ(ids(), (std::vector<OrderId>{3, 4}));
+    level.remove(d);
+    EXPECT_EQ(ids(), (std::vector<OrderId>{3}));
+    EXPECT_EQ(level.total_quantity(), 30);
+
+    // Appending after tail removal links behind the survivor
+    level.add(make_order(5, 50));
+    EXPECT_EQ(ids(), (std::vector<OrderId>{3, 5}));
+    EXPECT_EQ(level.order_count(), 2);
+}
+
+TEST_F(PriceLevelTest, MoveLeavesSourceEmpty) {
+    level.add(make_order(1, 10));
+    level.add(make_order(2, 20));
+
+    PriceLevel moved = std::move(level);
+    EXPECT_TRUE(level.is_empty());
+    EXPECT_EQ(level.total_quantity(), 0);
+    EXPECT_EQ(moved.order_count(), 2);
+    EXPECT_EQ(moved.front()->id, 1);
+}
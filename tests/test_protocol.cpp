@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "protocol.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace ob;
+
+namespace {
+
+void append(std::vector<char>& buf, const void* p, size_t n) {
+    const char* c = static_cast<const char*>(p);
+    buf.insert(buf.end(), c, c + n);
+}
+
+void append_frame(std::vector<char>& buf, OrderId first, uint32_t count) {
+    FrameHeader h{static_cast<uint32_t>(count * sizeof(ResponseMessage)), count};
+    append(buf, &h, sizeof(h));
+    for (uint32_t i = 0; i < count; ++i) {
+        ResponseMessage r = make_ack(0, first + i);
+        append(buf, &r, sizeof(r));
+    }
+}
+
+} // namespace
+
+TEST(Protocol, UnframedStreamKeepsAPartialMessage) {
+    std::vector<char> buf;
+    for (OrderId id : {1, 2}) {
+        ResponseMessage r = make_ack(0, id);
+        append(buf, &r, sizeof(r));
+    }
+    std::vector<OrderId> ids;
+    size_t used = decode_responses(buf.data(), buf.size() - 5, false,
+                                   [&](const ResponseMessage& r) { ids.push_back(r.order_id); });
+    EXPECT_EQ(used, sizeof(ResponseMessage));
+    EXPECT_EQ(ids, std::vector<OrderId>{1});
+}
+
+TEST(Protocol, FramedStreamIsConsumedWholeFramesAtATime) {
+    std::vector<char> buf;
+    append_frame(buf, 1, 3);
+    append_frame(buf, 4, 2);
+    std::vector<OrderId> ids;
+    auto collect = [&](const ResponseMessage& r) { ids.push_back(r.order_id); };
+
+    // The second frame is cut short: only the first is taken
+    size_t first = sizeof(FrameHeader) + 3 * sizeof(ResponseMessage);
+    EXPECT_EQ(decode_responses(buf.data(), buf.size() - 1, true, collect), first);
+    EXPECT_EQ(ids, (std::vector<OrderId>{1, 2, 3}));
+
+    EXPECT_EQ(decode_responses(buf.data() + first, buf.size() - first, true, collect),
+              buf.size() - first);
+    EXPECT_EQ(ids, (std::vector<OrderId>{1, 2, 3, 4, 5}));
+}
+
+TEST(Protocol, MalformedFrameHeaderIsReported) {
+    std::vector<char> buf;
+    FrameHeader h{100, 3};   // length does not match the count
+    append(buf, &h, sizeof(h));
+    buf.resize(buf.size() + 100);
+    EXPECT_EQ(decode_responses(buf.data(), buf.size(), true, [](const ResponseMessage&) {}),
+              SIZE_MAX);
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "shm_transport.h"
+#include "shm_client.h"
+#include <unistd.h>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ob;
+
+namespace {
+
+std::string segment_name(const char* test) {
+    return "/ob-test-" + std::string(test) + "-" + std::to_string(::getpid());
+}
+
+OrderMessage request(uint64_t order_id) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::CANCEL);
+    m.order_id = order_id;
+    return m;
+}
+
+// poll() until at least want requests arrived (or a bounded number of passes)
+std::vector<std::pair<uint64_t, OrderMessage>> poll_until(ShmServer& server, size_t want) {
+    std::vector<std::pair<uint64_t, OrderMessage>> got;
+    for (int pass = 0; pass < 1'000'000 && got.size() < want; ++pass) {
+        server.poll([&](uint64_t session, const OrderMessage& msg, uint8_t) {
+            got.emplace_back(session, msg);
+        });
+    }
+    return got;
+}
+
+} // namespace
+
+TEST(ShmTransport, RequestsAndResponsesRoundTrip) {
+    ShmServer server(segment_name("roundtrip"), 4, ShmWait::SPIN);
+    ShmClient client(segment_name("roundtrip"));
+
+    ASSERT_TRUE(client.send(request(1)));
+    ASSERT_TRUE(client.send(request(2)));
+    auto got = poll_until(server, 2);
+    ASSERT_EQ(got.size(), 2);
+    EXPECT_EQ(server.attached(), 1);
+    EXPECT_TRUE(ShmServer::owns(got[0].first));
+    EXPECT_EQ(got[0].second.order_id, 1);
+    EXPECT_EQ(got[1].second.order_id, 2);
+
+    EXPECT_TRUE(server.send(got[0].first, make_ack(0, 1)));
+    EXPECT_TRUE(server.send(got[1].first, make_reject(0, 2)));
+    server.flush();
+
+    ResponseMessage r;
+    ASSERT_TRUE(client.receive(r, 1'000'000));
+    EXPECT_EQ(r.msg_type, static_cast<uint8_t>(MsgType::ACK));
+    ASSERT_TRUE(client.receive(r, 1'000'000));
+    EXPECT_EQ(r.msg_type, static_cast<uint8_t>(MsgType::REJECT));
+    EXPECT_FALSE(client.try_receive(r));
+}
+
+TEST(ShmTransport, ClosedSlotIsReusedUnderANewSession) {
+    ShmServer server(segment_name("reuse"), 1, ShmWait::SPIN);
+    uint64_t first = 0;
+    {
+        ShmClient client(segment_name("reuse"));
+        // The only slot is taken
+        EXPECT_THROW(ShmClient(segment_name("reuse")), std::runtime_error);
+        client.send(request(1));
+        first = poll_until(server, 1).at(0).first;
+    }
+    server.poll([](uint64_t, const OrderMessage&, uint8_t) {});
+    EXPECT_EQ(server.attached(), 0);
+    // A late response for the old session goes nowhere
+    EXPECT_FALSE(server.send(first, make_ack(0, 1)));
+
+    ShmClient again(segment_name("reuse"));
+    again.send(request(2));
+    auto got = poll_until(server, 1);
+    ASSERT_EQ(got.size(), 1);
+    EXPECT_NE(got[0].first, first);
+    EXPECT_EQ(got[0].second.order_id, 2);
+}
+
+TEST(ShmTransport, FutexClientSleepsUntilTheServerAnswers) {
+    ShmServer server(segment_name("futex"), 2, ShmWait::FUTEX);
+    ASSERT_GE(server.notify_fd(), 0);
+    ShmClient client(segment_name("futex"), ShmWait::FUTEX);
+    client.send(request(7));
+
+    uint64_t session = poll_until(server, 1).at(0).first;
+    std::thread answer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        server.send(session, make_ack(0, 7));
+        server.flush();
+    });
+    ResponseMessage r;
+    EXPECT_TRUE(client.receive(r, 5'000'000));
+    EXPECT_EQ(r.order_id, 7);
+    answer.join();
+}
+
+TEST(ShmTransport, ClientNoticesServerExit) {
+    auto server = std::make_unique<ShmServer>(segment_name("exit"), 1, ShmWait::SPIN);
+    ShmClient client(segment_name("exit"));
+    EXPECT_TRUE(client.connected());
+    server.reset();
+    EXPECT_FALSE(client.connected());
+    ResponseMessage r;
+    EXPECT_FALSE(client.receive(r));
+}
+
+TEST(ShmTransport, FirstSessionRequestIsAnsweredAndSetsTheFlags) {
+    ShmServer server(segment_name("session"), 1, ShmWait::SPIN);
+    ShmClient client(segment_name("session"));
+    client.send(make_session_request(SessionFlags::AGGREGATE_FILLS | SessionFlags::FRAMED));
+    client.send(request(1));
+    client.send(make_session_request(0));   // not first: passed on like any request
+
+    std::vector<std::pair<OrderMessage, uint8_t>> got;
+    for (int pass = 0; pass < 1'000'000 && got.size() < 2; ++pass) {
+        server.poll([&](uint64_t, const OrderMessage& msg, uint8_t flags) {
+            got.emplace_back(msg, flags);
+        });
+    }
+    ASSERT_EQ(got.size(), 2);
+    EXPECT_EQ(got[0].first.order_id, 1);
+    EXPECT_EQ(got[0].second, SessionFlags::AGGREGATE_FILLS);   // FRAMED is TCP only
+    EXPECT_EQ(got[1].first.msg_type, static_cast<uint8_t>(MsgType::SESSION));
+
+    server.flush();
+    ResponseMessage r;
+    ASSERT_TRUE(client.receive(r, 1'000'000));
+    EXPECT_EQ(r.msg_type, static_cast<uint8_t>(MsgType::ACK));
+    EXPECT_EQ(r.order_id, 0);
+}
+
+TEST(ShmTransport, MissingSegmentThrows) {
+    EXPECT_THROW(ShmClient(segment_name("missing")), std::runtime_error);
+}
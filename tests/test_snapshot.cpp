@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include "snapshot.h"
+#include "engine_router.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace ob;
+
+namespace {
+
+struct TempDir {
+    std::string path;
+    TempDir() {
+        static int counter = 0;
+        path = (std::filesystem::temp_directory_path() /
+                ("ob-snapshot-" + std::to_string(getpid()) + "-" + std::to_string(counter++)))
+                   .string();
+        std::filesystem::remove_all(path);
+        std::filesystem::create_directories(path);
+    }
+    ~TempDir() { std::filesystem::remove_all(path); }
+};
+
+OrderMessage new_order(SymbolId symbol, Side side, Price price, Quantity qty) {
+    OrderMessage m{};
+    m.msg_type = static_cast<uint8_t>(MsgType::NEW_ORDER);
+    m.side = static_cast<uint8_t>(side);
+    m.order_type = static_cast<uint8_t>(OrderType::LIMIT);
+    m.symbol_id = symbol;
+    m.price = price;
+    m.quantity = qty;
+    return m;
+}
+
+std::vector<RoutedResponse> drain(EngineRouter& router) {
+    std::vector<RoutedResponse> out;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (router.in_flight() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    router.poll_responses(out);
+    return out;
+}
+
+bool wait_for_snapshots(EngineRouter& router, uint64_t count) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (router.snapshots_written() < count) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+size_t count_files(const std::string& dir, const std::string& suffix) {
+    size_t n = 0;
+    for (const auto& e : std::filesystem::directory_iterator(dir)) {
+        if (e.path().extension() == suffix) ++n;
+    }
+    return n;
+}
+
+// Populate an engine with several levels per side, several orders per
+// level and one partial fill
+void fill_book(MatchingEngine& engine) {
+    engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 50);
+    engine.process_order(Side::SELL, OrderType::LIMIT, 10100, 20);
+    engine.process_order(Side::SELL, OrderType::LIMIT, 10200, 30);
+    engine.process_order(Side::BUY, OrderType::LIMIT, 9900, 40);
+    engine.process_order(Side::BUY, OrderType::LIMIT, 9900, 10);
+    engine.process_order(Side::BUY, OrderType::LIMIT, 9800, 25);
+    engine.process_order(Side::BUY, OrderType::LIMIT, 10100, 15);   // partly fills id 1
+}
+
+} // namespace
+
+TEST(Snapshot, EngineRoundTrip) {
+    TempDir dir;
+    std::string path = dir.path + "/book.snapshot";
+
+    MatchingEngine original;
+    fill_book(original);
+    {
+        SnapshotWriter writer(path);
+        writer.add_engine(7, original);
+        ASSERT_TRUE(writer.finish(42));
+    }
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+
+    SnapshotReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.journal_seq(), 42);
+    EXPECT_EQ(reader.engine_count(), 1);
+
+    MatchingEngine restored;
+    SymbolId seen = 0;
+    ASSERT_TRUE(reader.load([&](SymbolId symbol) {
+        seen = symbol;
+        return &restored;
+    }));
+    EXPECT_EQ(seen, 7);
+
+    const auto& a = original.book();
+    const auto& b = restored.book();
+    EXPECT_EQ(b.best_bid(), a.best_bid());
+    EXPECT_EQ(b.best_ask(), a.best_ask());
+    EXPECT_EQ(b.bid_level_count(), a.bid_level_count());
+    EXPECT_EQ(b.ask_level_count(), a.ask_level_count());
+    EXPECT_EQ(b.total_order_count(), a.total_order_count());
+    EXPECT_EQ(b.get_volume_at_price(Side::SELL, 10100), 55);
+    EXPECT_EQ(b.get_volume_at_price(Side::BUY, 9900), 50);
+    EXPECT_EQ(restored.next_order_id(), original.next_order_id());
+    EXPECT_EQ(restored.next_timestamp(), original.next_timestamp());
+    EXPECT_EQ(restored.trade_count(), original.trade_count());
+    EXPECT_EQ(restored.orders_processed(), original.orders_processed());
+
+    // Same sweep on both: same makers in the same FIFO order, same ids
+    auto expect = original.process_order(Side::BUY, OrderType::MARKET, 0, 100);
+    auto got = restored.process_order(Side::BUY, OrderType::MARKET, 0, 100);
+    ASSERT_EQ(got.size(), expect.size());
+    for (size_t i = 0; i < got.size(); ++i) {
+        EXPECT_EQ(got[i].seller_order_id, expect[i].seller_order_id);
+        EXPECT_EQ(got[i].buyer_order_id, expect[i].buyer_order_id);
+        EXPECT_EQ(got[i].quantity, expect[i].quantity);
+        EXPECT_EQ(got[i].timestamp, expect[i].timestamp);
+    }
+    EXPECT_TRUE(restored.cancel_order(5));
+}
+
+TEST(Snapshot, DamagedFileIsRejected) {
+    TempDir dir;
+    std::string path = dir.path + "/book.snapshot";
+
+    MatchingEngine engine;
+    fill_book(engine);
+    {
+        SnapshotWriter writer(path);
+        writer.add_engine(0, engine);
+        ASSERT_TRUE(writer.finish(1));
+    }
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(sizeof(SnapshotHeader) + sizeof(SnapshotEngine) + 4);
+        f.put('\x7f');
+    }
+    SnapshotReader reader;
+    EXPECT_FALSE(reader.open(path));
+    EXPECT_FALSE(reader.open(dir.path + "/missing.snapshot"));
+}
+
+TEST(Snapshot, RouterTruncatesJournalAndRecovers) {
+    TempDir dir;
+    RouterOptions opts{.shards = 2,
+                       .journal = {.dir = dir.path, .segment_bytes = 4 * sizeof(JournalRecord)}};
+
+    {
+        EngineRouter router(opts);
+        router.start();
+        for (int i = 0; i < 10; ++i) {
+            router.submit(1, new_order(0, Side::SELL, 10000 + i, 10));
+            router.submit(1, new_order(1, Side::BUY, 5000 - i, 10));
+        }
+        drain(router);
+        size_t segments_before = count_files(dir.path, ".journal");
+
+        router.request_snapshot();
+        ASSERT_TRUE(wait_for_snapshots(router, 2));
+        EXPECT_EQ(count_files(dir.path, ".snapshot"), 2);
+        EXPECT_LT(count_files(dir.path, ".journal"), segments_before);
+
+        // Lands in the journal after the snapshot
+        router.submit(1, new_order(0, Side::SELL, 9990, 5));
+        drain(router);
+        router.stop();
+    }
+
+    EngineRouter router(opts);
+    router.start();
+    EXPECT_EQ(router.recovered(), 1);
+
+    // Books and ids come back: the best ask is the post-snapshot order
+    router.submit(2, new_order(0, Side::BUY, 10000, 15));
+    auto out = drain(router);
+    ASSERT_EQ(out.size(), 3);
+    EXPECT_EQ(out[0].msg.order_id, 12);
+    EXPECT_EQ(out[1].msg.match_id, 11);
+    EXPECT_EQ(out[1].msg.quantity, 5);
+    EXPECT_EQ(out[2].msg.match_id, 1);
+    EXPECT_EQ(out[2].msg.quantity, 10);
+}
+
+TEST(Snapshot, RouterSnapshotsEveryNRecords) {
+    TempDir dir;
+    RouterOptions opts{.shards = 1, .journal = {.dir = dir.path}, .snapshot_records = 5};
+
+    EngineRouter router(opts);
+    router.start();
+    for (int i = 0; i < 6; ++i) {
+        router.submit(1, new_order(0, Side::SELL, 10000 + i, 1));
+    }
+    drain(router);
+    ASSERT_TRUE(wait_for_snapshots(router, 1));
+
+    // An older snapshot is removed once a newer one lands
+    for (int i = 0; i < 6; ++i) {
+        router.submit(1, new_order(0, Side::SELL, 11000 + i, 1));
+    }
+    drain(router);
+    ASSERT_TRUE(wait_for_snapshots(router, 2));
+    router.stop();
+    EXPECT_EQ(count_files(dir.path, ".snapshot"), 1);
+}
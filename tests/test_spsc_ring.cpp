@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "spsc_ring.h"
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ob;
+
+TEST(SpscRing, PushPopFifo) {
+    SpscRing<int, 8> ring;
+    EXPECT_TRUE(ring.empty_approx());
+    for (int i = 0; i < 5; ++i) EXPECT_TRUE(ring.try_push(i));
+    EXPECT_EQ(ring.size_approx(), 5);
+
+    int v;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(ring.try_pop(v));
+        EXPECT_EQ(v, i);
+    }
+    EXPECT_FALSE(ring.try_pop(v));
+}
+
+TEST(SpscRing, FullRingRejectsPush) {
+    SpscRing<int, 4> ring;
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(ring.try_push(i));
+    EXPECT_FALSE(ring.try_push(99));
+
+    int v;
+    ASSERT_TRUE(ring.try_pop(v));
+    EXPECT_TRUE(ring.try_push(4));   // slot freed, wraps around
+}
+
+TEST(SpscRing, BulkOperationsWrapAndClamp) {
+    SpscRing<int, 8> ring;
+    int in[6] = {0, 1, 2, 3, 4, 5};
+    int out[8];
+
+    EXPECT_EQ(ring.push_bulk(in, 6), 6);
+    EXPECT_EQ(ring.pop_bulk(out, 4), 4);
+    EXPECT_EQ(ring.push_bulk(in, 6), 6);     // wraps past the end of storage
+    EXPECT_EQ(ring.push_bulk(in, 6), 0);     // full: 2 + 6 = 8
+
+    EXPECT_EQ(ring.pop_bulk(out, 8), 8);
+    EXPECT_EQ(out[0], 4);
+    EXPECT_EQ(out[1], 5);
+    for (int i = 0; i < 6; ++i) EXPECT_EQ(out[2 + i], i);
+}
+
+TEST(SpscRing, CrossThreadOrderAndCompleteness) {
+    auto ring = std::make_unique<SpscRing<uint64_t, 1024>>();
+    constexpr uint64_t count = 200000;
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < count;) {
+            if (ring->try_push(i)) ++i;
+            else std::this_thread::yield();
+        }
+    });
+
+    uint64_t expected = 0;
+    uint64_t buf[64];
+    while (expected < count) {
+        size_t n = ring->pop_bulk(buf, 64);
+        if (n == 0) std::this_thread::yield();
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(buf[i], expected);
+            ++expected;
+        }
+    }
+    producer.join();
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "workload_generator.h"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace ob;
+
+TEST(WorkloadGenerator, CancelsAlwaysHitRestingOrders) {
+    for (auto age : {WorkloadOptions::CancelAge::UNIFORM, WorkloadOptions::CancelAge::RECENT,
+                     WorkloadOptions::CancelAge::OLDEST}) {
+        WorkloadOptions options;
+        options.cancel_pct = 40;
+        options.cancel_age = age;
+        WorkloadGenerator gen(options, 7);
+        auto orders = gen.generate(20000);
+
+        // A fresh engine replaying the stream sees the shadow engine's book
+        MatchingEngine engine;
+        size_t cancels = 0;
+        for (const auto& o : orders) {
+            if (o.is_cancel) {
+                ++cancels;
+                ASSERT_TRUE(engine.cancel_order(o.cancel_id)) << "order " << o.cancel_id;
+            } else {
+                engine.process_order(o.side, o.type, o.price, o.quantity, [](const Trade&) {});
+            }
+        }
+        EXPECT_GT(cancels, 6000u);
+        EXPECT_GT(engine.trade_count(), 0u);
+    }
+}
+
+TEST(WorkloadGenerator, RecentCancelsTargetYoungOrders) {
+    WorkloadOptions options;
+    options.cancel_age = WorkloadOptions::CancelAge::RECENT;
+    options.cancel_age_mean = 2;
+    WorkloadGenerator gen(options, 3);
+    auto orders = gen.generate(20000);
+
+    // Most cancels name one of the last few orders submitted
+    OrderId submitted = 0;
+    size_t cancels = 0;
+    size_t young = 0;
+    for (const auto& o : orders) {
+        if (!o.is_cancel) {
+            ++submitted;
+            continue;
+        }
+        ++cancels;
+        young += submitted - o.cancel_id < 20;
+    }
+    EXPECT_GT(young, cancels * 3 / 4);
+}
+
+TEST(WorkloadGenerator, PricesClusterAtTheTouch) {
+    WorkloadOptions options;
+    options.market_pct = 0;
+    WorkloadGenerator gen(options, 11);
+    auto orders = gen.generate(20000);
+
+    MatchingEngine engine;
+    size_t limits = 0;
+    size_t near = 0;
+    for (const auto& o : orders) {
+        if (o.is_cancel) {
+            engine.cancel_order(o.cancel_id);
+            continue;
+        }
+        auto touch = o.side == Side::BUY ? engine.book().best_bid() : engine.book().best_ask();
+        if (touch) {
+            ++limits;
+            near += std::abs(o.price - *touch) <= 10;
+        }
+        engine.process_order(o.side, o.type, o.price, o.quantity, [](const Trade&) {});
+    }
+    EXPECT_GT(near, limits * 9 / 10);
+}
+
+TEST(WorkloadGenerator, HawkesArrivalsAreOrderedAndBursty) {
+    WorkloadOptions options;
+    options.rate = 10000;
+    options.hawkes_alpha = 0.5;
+    WorkloadGenerator gen(options, 5);
+    auto orders = gen.generate(50000);
+
+    for (size_t i = 1; i < orders.size(); ++i) {
+        ASSERT_GE(orders[i].timestamp_ns, orders[i - 1].timestamp_ns);
+    }
+
+    // Long-run rate is rate / (1 - alpha)
+    double seconds = orders.back().timestamp_ns / 1e9;
+    double rate = orders.size() / seconds;
+    EXPECT_GT(rate, 20000 * 0.8);
+    EXPECT_LT(rate, 20000 * 1.2);
+
+    // Clustering: counts per 10 ms window are over-dispersed (variance /
+    // mean is 1 for Poisson, tending to 1 / (1 - alpha)^2 for Hawkes)
+    std::vector<double> counts(static_cast<size_t>(seconds * 100) + 1);
+    for (const auto& o : orders) counts[o.timestamp_ns / 10'000'000] += 1;
+    counts.pop_back();   // partial window
+    double mean = 0;
+    for (double c : counts) mean += c;
+    mean /= counts.size();
+    double var = 0;
+    for (double c : counts) var += (c - mean) * (c - mean);
+    var /= counts.size();
+    EXPECT_GT(var / mean, 2.0);
+}
+
+TEST(WorkloadGenerator, SameSeedSameStream) {
+    WorkloadGenerator a({}, 99);
+    WorkloadGenerator b({}, 99);
+    auto x = a.generate(5000);
+    auto y = b.generate(5000);
+    ASSERT_EQ(x.size(), y.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        EXPECT_EQ(x[i].is_cancel, y[i].is_cancel);
+        EXPECT_EQ(x[i].cancel_id, y[i].cancel_id);
+        EXPECT_EQ(x[i].price, y[i].price);
+        EXPECT_EQ(x[i].quantity, y[i].quantity);
+        EXPECT_EQ(x[i].timestamp_ns, y[i].timestamp_ns);
+    }
+}
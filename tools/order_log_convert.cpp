@@ -0,0 +1,375 @@
+#include "order_log.h"
+#include "csv_parser.h"
+#include "order_generator.h"
+#include "symbol_table.h"
+#include "workload_generator.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+// Writes a binary order log for `replay`.
+//
+// Usage: order-log-convert csv IN.csv OUT.log [--interval-ns N]
+//        order-log-convert generate COUNT OUT.log [--cancel-pct P] [--market-pct P]
+//                          [--seed S] [--rate R]
+//        order-log-convert workload COUNT OUT.log [--cancel-pct P] [--market-pct P]
+//                          [--seed S] [--rate R]
+//        order-log-convert itch IN.itch OUT.log [--symbol NAME]...
+//
+//   csv       one record per order/cancel line; PRINT, comments and bad
+//             lines are dropped. Named symbols get ids in order of first
+//             appearance (the unnamed symbol is 0). Records are N ns apart.
+//   generate  OrderGenerator output, symbol 0. --rate R timestamps the
+//             orders as Poisson arrivals at R orders/sec (default: all 0).
+//   workload  WorkloadGenerator output, symbol 0: live-order cancels,
+//             near-touch prices, Pareto sizes, Hawkes arrivals at baseline
+//             rate R (default 100000).
+//   itch      a NASDAQ TotalView-ITCH 5.0 file (2-byte length-prefixed
+//             messages), restricted to the given symbols if any. Symbols
+//             get ids from 1 in order of first appearance. Adds map to
+//             limit orders and deletes to cancels. Executions become
+//             market orders for the executed size against the maker's side,
+//             which fill the same order as long as it holds time priority.
+//             A replace is a cancel plus a new order. Partial cancels
+//             become amends to the reduced size, keeping queue position.
+
+namespace {
+
+ob::OrderMessage new_order(ob::Side side, ob::OrderType type, ob::Price price,
+                           ob::Quantity quantity, ob::SymbolId symbol) {
+    ob::OrderMessage msg{};
+    msg.msg_type = static_cast<uint8_t>(ob::MsgType::NEW_ORDER);
+    msg.side = static_cast<uint8_t>(side);
+    msg.order_type = static_cast<uint8_t>(type);
+    msg.symbol_id = symbol;
+    msg.price = price;
+    msg.quantity = quantity;
+    return msg;
+}
+
+ob::OrderMessage amend(ob::OrderId order_id, ob::Price price, ob::Quantity quantity,
+                       ob::SymbolId symbol) {
+    ob::OrderMessage msg{};
+    msg.msg_type = static_cast<uint8_t>(ob::MsgType::AMEND);
+    msg.symbol_id = symbol;
+    msg.order_id = order_id;
+    msg.price = price;
+    msg.quantity = quantity;
+    return msg;
+}
+
+ob::OrderMessage cancel(ob::OrderId order_id, ob::SymbolId symbol) {
+    ob::OrderMessage msg{};
+    msg.msg_type = static_cast<uint8_t>(ob::MsgType::CANCEL);
+    msg.symbol_id = symbol;
+    msg.order_id = order_id;
+    return msg;
+}
+
+int convert_csv(const char* in_path, const char* out_path, uint64_t interval_ns) {
+    std::ifstream in(in_path, std::ios::binary);
+    if (!in) {
+        std::cerr << "Error: cannot open file '" << in_path << "'\n";
+        return 1;
+    }
+    std::stringstream contents;
+    contents << in.rdbuf();
+    const std::string data = contents.str();
+
+    ob::OrderLogWriter log;
+    if (!log.open(out_path)) return 1;
+
+    ob::SymbolTable symbols;
+    size_t skipped = 0;
+    std::string_view rest = data;
+    while (!rest.empty()) {
+        size_t eol = rest.find('\n');
+        std::string_view line = rest.substr(0, eol);
+        rest = eol == std::string_view::npos ? std::string_view{} : rest.substr(eol + 1);
+
+        ob::CsvCommand cmd = ob::CsvParser::parse_line(line);
+        uint64_t ts = log.count() * interval_ns;
+        switch (cmd.kind) {
+        case ob::CsvCommand::ORDER:
+            log.append(ts, new_order(cmd.side, cmd.type, cmd.price, cmd.quantity,
+                                     symbols.intern(cmd.symbol)));
+            break;
+        case ob::CsvCommand::CANCEL:
+            log.append(ts, cancel(cmd.order_id, symbols.intern(cmd.symbol)));
+            break;
+        case ob::CsvCommand::NONE:
+            break;
+        default:
+            ++skipped;
+            break;
+        }
+    }
+
+    if (!log.close()) return 1;
+    std::cerr << "Wrote " << log.count() << " records, " << symbols.size() << " symbols ("
+              << skipped << " lines skipped)\n";
+    return 0;
+}
+
+int convert_generated(size_t count, const char* out_path, int cancel_pct, int market_pct,
+                      uint64_t seed, double rate) {
+    ob::OrderGenerator gen(seed);
+    auto orders = gen.generate(count, cancel_pct, market_pct);
+
+    ob::OrderLogWriter log;
+    if (!log.open(out_path)) return 1;
+
+    std::mt19937_64 rng(seed);
+    std::exponential_distribution<double> gap(rate > 0 ? rate / 1e9 : 1.0);
+    double ts = 0;
+    for (const auto& o : orders) {
+        if (rate > 0) ts += gap(rng);
+        auto t = static_cast<uint64_t>(ts);
+        if (o.is_cancel) {
+            log.append(t, cancel(o.cancel_id, 0));
+        } else {
+            log.append(t, new_order(o.side, o.type, o.price, o.quantity, 0));
+        }
+    }
+
+    if (!log.close()) return 1;
+    std::cerr << "Wrote " << log.count() << " records\n";
+    return 0;
+}
+
+int convert_workload(size_t count, const char* out_path, int cancel_pct, int market_pct,
+                     uint64_t seed, double rate) {
+    ob::WorkloadOptions options;
+    options.cancel_pct = cancel_pct;
+    options.market_pct = market_pct;
+    if (rate > 0) options.rate = rate;
+    ob::WorkloadGenerator gen(options, seed);
+    auto orders = gen.generate(count);
+
+    ob::OrderLogWriter log;
+    if (!log.open(out_path)) return 1;
+    for (const auto& o : orders) {
+        if (o.is_cancel) {
+            log.append(o.timestamp_ns, cancel(o.cancel_id, 0));
+        } else {
+            log.append(o.timestamp_ns, new_order(o.side, o.type, o.price, o.quantity, 0));
+        }
+    }
+
+    if (!log.close()) return 1;
+    std::cerr << "Wrote " << log.count() << " records\n";
+    return 0;
+}
+
+// Big-endian field readers for ITCH
+uint64_t be(const unsigned char* p, size_t n) {
+    uint64_t v = 0;
+    for (size_t i = 0; i < n; ++i) v = (v << 8) | p[i];
+    return v;
+}
+
+std::string_view itch_symbol(const unsigned char* p) {
+    std::string_view name(reinterpret_cast<const char*>(p), 8);
+    return name.substr(0, name.find_last_not_of(' ') + 1);
+}
+
+int convert_itch(const char* in_path, const char* out_path,
+                 const std::unordered_set<std::string>& wanted) {
+    int fd = ::open(in_path, O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error: cannot open file '" << in_path << "'\n";
+        return 1;
+    }
+    struct stat st;
+    size_t bytes = fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    void* map = bytes ? mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        std::cerr << "Error: cannot map file '" << in_path << "'\n";
+        return 1;
+    }
+
+    ob::OrderLogWriter log;
+    if (!log.open(out_path)) {
+        munmap(map, bytes);
+        return 1;
+    }
+
+    // ITCH order reference -> the id our engine will assign it
+    struct Resting {
+        ob::SymbolId symbol;
+        ob::Side     side;
+        ob::OrderId  id;
+        uint32_t     shares;   // still open
+        ob::Price    price;
+        uint32_t     size;     // as added, less partial cancels
+    };
+    std::unordered_map<uint64_t, Resting> resting;
+    ob::SymbolTable symbols;
+    std::vector<ob::OrderId> next_id(1, 1);   // per symbol, as the engine counts
+
+    auto submit = [&](uint64_t ts, ob::Side side, ob::OrderType type, ob::Price price,
+                      uint32_t shares, ob::SymbolId symbol) {
+        log.append(ts, new_order(side, type, price, shares, symbol));
+        return next_id[symbol]++;
+    };
+    auto add = [&](uint64_t ts, uint64_t ref, ob::Side side,
+                   uint32_t shares, std::string_view name, uint64_t price4) {
+        if (!wanted.empty() && !wanted.count(std::string(name))) return;
+        ob::SymbolId symbol = symbols.intern(name);
+        if (symbol >= next_id.size()) next_id.resize(symbol + 1, 1);
+        // ITCH prices carry four decimals
+        auto price = static_cast<ob::Price>((price4 + 50) / 100);
+        resting[ref] = {symbol, side, submit(ts, side, ob::OrderType::LIMIT, price, shares, symbol),
+                        shares, price, shares};
+    };
+
+    const auto* p = static_cast<const unsigned char*>(map);
+    const auto* end = p + bytes;
+    while (end - p >= 2) {
+        size_t len = be(p, 2);
+        const unsigned char* m = p + 2;
+        p = m + len;
+        if (p > end || len < 11) break;
+        uint64_t ts = be(m + 5, 6);
+
+        switch (m[0]) {
+        case 'A':
+        case 'F':
+            if (len < 36) break;
+            add(ts, be(m + 11, 8), m[19] == 'B' ? ob::Side::BUY : ob::Side::SELL,
+                static_cast<uint32_t>(be(m + 20, 4)), itch_symbol(m + 24), be(m + 32, 4));
+            break;
+        case 'E':
+        case 'C': {
+            auto it = resting.find(be(m + 11, 8));
+            if (it == resting.end() || len < 31) break;
+            auto shares = static_cast<uint32_t>(be(m + 19, 4));
+            Resting& r = it->second;
+            ob::Side taker = r.side == ob::Side::BUY ? ob::Side::SELL : ob::Side::BUY;
+            submit(ts, taker, ob::OrderType::MARKET, 0, shares, r.symbol);
+            if (shares >= r.shares) {
+                resting.erase(it);
+            } else {
+                r.shares -= shares;
+            }
+            break;
+        }
+        case 'X': {
+            auto it = resting.find(be(m + 11, 8));
+            if (it == resting.end() || len < 23) break;
+            auto shares = static_cast<uint32_t>(be(m + 19, 4));
+            if (shares >= it->second.shares) {
+                log.append(ts, cancel(it->second.id, it->second.symbol));
+                resting.erase(it);
+            } else {
+                // AMEND sizes count what has filled, so shrink the total
+                Resting& r = it->second;
+                r.shares -= shares;
+                r.size -= shares;
+                log.append(ts, amend(r.id, r.price, r.size, r.symbol));
+            }
+            break;
+        }
+        case 'D': {
+            auto it = resting.find(be(m + 11, 8));
+            if (it == resting.end()) break;
+            log.append(ts, cancel(it->second.id, it->second.symbol));
+            resting.erase(it);
+            break;
+        }
+        case 'U': {
+            auto it = resting.find(be(m + 11, 8));
+            if (it == resting.end() || len < 35) break;
+            Resting old = it->second;
+            resting.erase(it);
+            log.append(ts, cancel(old.id, old.symbol));
+            add(ts, be(m + 19, 8), old.side, static_cast<uint32_t>(be(m + 27, 4)),
+                symbols.name(old.symbol), be(m + 31, 4));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    munmap(map, bytes);
+
+    if (!log.close()) return 1;
+    std::cerr << "Wrote " << log.count() << " records, " << symbols.size() - 1 << " symbols\n";
+    return 0;
+}
+
+void usage() {
+    std::cerr << "Usage: order-log-convert csv IN.csv OUT.log [--interval-ns N]\n"
+                 "       order-log-convert generate COUNT OUT.log [--cancel-pct P]"
+                 " [--market-pct P] [--seed S] [--rate R]\n"
+                 "       order-log-convert workload COUNT OUT.log [--cancel-pct P]"
+                 " [--market-pct P] [--seed S] [--rate R]\n"
+                 "       order-log-convert itch IN.itch OUT.log [--symbol NAME]...\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        usage();
+        return 1;
+    }
+
+    uint64_t interval_ns = 0;
+    int cancel_pct = 5;
+    int market_pct = 10;
+    uint64_t seed = 42;
+    double rate = 0;
+    std::unordered_set<std::string> symbols;
+    try {
+        for (int i = 4; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--interval-ns") == 0 && i + 1 < argc) {
+                interval_ns = std::stoull(argv[++i]);
+            } else if (std::strcmp(argv[i], "--cancel-pct") == 0 && i + 1 < argc) {
+                cancel_pct = std::stoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--market-pct") == 0 && i + 1 < argc) {
+                market_pct = std::stoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+                seed = std::stoull(argv[++i]);
+            } else if (std::strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+                rate = std::stod(argv[++i]);
+            } else if (std::strcmp(argv[i], "--symbol") == 0 && i + 1 < argc) {
+                symbols.insert(argv[++i]);
+            } else {
+                usage();
+                return 1;
+            }
+        }
+
+        if (std::strcmp(argv[1], "csv") == 0) {
+            return convert_csv(argv[2], argv[3], interval_ns);
+        }
+        if (std::strcmp(argv[1], "generate") == 0) {
+            return convert_generated(std::stoull(argv[2]), argv[3], cancel_pct, market_pct,
+                                     seed, rate);
+        }
+        if (std::strcmp(argv[1], "workload") == 0) {
+            return convert_workload(std::stoull(argv[2]), argv[3], cancel_pct, market_pct,
+                                    seed, rate);
+        }
+        if (std::strcmp(argv[1], "itch") == 0) {
+            return convert_itch(argv[2], argv[3], symbols);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    usage();
+    return 1;
+}
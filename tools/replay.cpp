@@ -0,0 +1,200 @@
+#include "order_log.h"
+#include "matching_engine.h"
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Drives matching engines from a binary order log (see order-log-convert).
+//
+// Usage: replay LOG [--book map|ladder] [--batch N] [--paced] [--speed X]
+//
+//   --batch N  feed runs of up to N same-symbol records through
+//              process_batch(); latency is amortized per record
+//   --paced    release each record at its logged time (scaled by 1/X with
+//              --speed); latency then runs from the scheduled release, so
+//              falling behind shows up as queueing delay
+//
+// Without --paced records are applied back to back as fast as possible.
+
+using Clock = std::chrono::high_resolution_clock;
+
+namespace {
+
+struct ReplayOptions {
+    size_t batch = 1;
+    bool paced = false;
+    double speed = 1.0;
+};
+
+struct ReplayResult {
+    double throughput;  // records/sec
+    double p50_ns, p95_ns, p99_ns, p999_ns;
+    double mean_ns;
+    uint64_t total_trades;
+    size_t pool_peak;   // most orders one book's pool held at once
+};
+
+struct NullBatchSink {
+    void on_accept(const ob::OrderMessage&, ob::OrderId) {}
+    void on_trade(const ob::OrderMessage&, const ob::Trade&) {}
+    void on_cancel(const ob::OrderMessage&, bool) {}
+    void on_amend(const ob::OrderMessage&, bool) {}
+    void on_reject(const ob::OrderMessage&) {}
+};
+
+template <typename Engine>
+ReplayResult replay(std::span<const ob::OrderLogRecord> records, const ReplayOptions& opts) {
+    // One engine per symbol id, created on first use
+    std::vector<std::unique_ptr<Engine>> engines;
+    auto engine_for = [&](ob::SymbolId symbol) -> Engine& {
+        if (symbol >= engines.size()) engines.resize(symbol + 1);
+        if (!engines[symbol]) engines[symbol] = std::make_unique<Engine>();
+        return *engines[symbol];
+    };
+    // Touch every symbol before the clock starts
+    for (const auto& r : records) engine_for(r.msg.symbol_id);
+
+    NullBatchSink sink;
+    std::vector<ob::OrderMessage> staged(opts.batch);
+    ob::LatencyHistogram latencies;   // ns
+
+    const uint64_t first_ts = records.empty() ? 0 : records.front().timestamp_ns;
+    auto total_start = Clock::now();
+
+    for (size_t i = 0; i < records.size();) {
+        // A run of consecutive records for one symbol, at most batch long
+        ob::SymbolId symbol = records[i].msg.symbol_id;
+        size_t n = 1;
+        while (n < opts.batch && i + n < records.size() &&
+               records[i + n].msg.symbol_id == symbol) {
+            ++n;
+        }
+
+        Clock::time_point start;
+        if (opts.paced) {
+            auto offset = std::chrono::nanoseconds(static_cast<int64_t>(
+                static_cast<double>(records[i + n - 1].timestamp_ns - first_ts) / opts.speed));
+            start = total_start + std::chrono::duration_cast<Clock::duration>(offset);
+            while (Clock::now() < start) {}
+        } else {
+            start = Clock::now();
+        }
+
+        Engine& engine = *engines[symbol];
+        if (n == 1) {
+            const ob::OrderMessage& msg = records[i].msg;
+            if (msg.msg_type == static_cast<uint8_t>(ob::MsgType::CANCEL)) {
+                engine.cancel_order(msg.order_id);
+            } else if (msg.msg_type == static_cast<uint8_t>(ob::MsgType::AMEND)) {
+                engine.amend_order(msg.order_id, msg.price, msg.quantity);
+            } else if (msg.msg_type == static_cast<uint8_t>(ob::MsgType::NEW_ORDER)) {
+                engine.process_order(static_cast<ob::Side>(msg.side),
+                                     static_cast<ob::OrderType>(msg.order_type),
+                                     msg.price, msg.quantity, [](const ob::Trade&) {});
+            }
+        } else {
+            for (size_t k = 0; k < n; ++k) staged[k] = records[i + k].msg;
+            engine.process_batch(std::span<const ob::OrderMessage>(staged.data(), n), sink);
+        }
+
+        auto end = Clock::now();
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        latencies.record(static_cast<uint64_t>(ns) / n);
+        i += n;
+    }
+
+    auto total_end = Clock::now();
+    double total_sec = std::chrono::duration<double>(total_end - total_start).count();
+
+    ReplayResult result{};
+    for (const auto& e : engines) {
+        if (!e) continue;
+        result.total_trades += e->trade_count();
+        result.pool_peak = std::max(result.pool_peak, e->pool().high_water());
+    }
+    if (latencies.count() == 0) return result;
+
+    result.throughput = records.size() / total_sec;
+    result.mean_ns = latencies.mean();
+    result.p50_ns = static_cast<double>(latencies.percentile(50));
+    result.p95_ns = static_cast<double>(latencies.percentile(95));
+    result.p99_ns = static_cast<double>(latencies.percentile(99));
+    result.p999_ns = static_cast<double>(latencies.percentile(99.9));
+    return result;
+}
+
+void print_result(const std::string& label, const ReplayResult& r, size_t record_count) {
+    std::cout << "\n=== " << label << " ===\n";
+    std::cout << "Orders:     " << record_count << "\n";
+    std::cout << "Trades:     " << r.total_trades << "\n";
+    std::cout << "Pool peak:  " << r.pool_peak << " orders (largest book)\n";
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "Throughput: " << r.throughput << " orders/sec\n";
+    std::cout << std::setprecision(1);
+    std::cout << "Latency (ns):\n";
+    std::cout << "  mean:  " << r.mean_ns << "\n";
+    std::cout << "  p50:   " << r.p50_ns << "\n";
+    std::cout << "  p95:   " << r.p95_ns << "\n";
+    std::cout << "  p99:   " << r.p99_ns << "\n";
+    std::cout << "  p99.9: " << r.p999_ns << "\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string path;
+    std::string book = "map";
+    ReplayOptions opts;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--book") == 0 && i + 1 < argc) {
+                book = argv[++i];
+            } else if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+                opts.batch = std::max<size_t>(1, std::stoull(argv[++i]));
+            } else if (std::strcmp(argv[i], "--paced") == 0) {
+                opts.paced = true;
+            } else if (std::strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+                opts.speed = std::stod(argv[++i]);
+                opts.paced = true;
+            } else {
+                path = argv[i];
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    if (path.empty() || (book != "map" && book != "ladder") || opts.speed <= 0) {
+        std::cerr << "Usage: replay LOG [--book map|ladder] [--batch N] [--paced] [--speed X]\n";
+        return 1;
+    }
+
+    ob::OrderLogReader log;
+    if (!log.open(path)) {
+        std::cerr << "Error: '" << path << "' is not a readable order log\n";
+        return 1;
+    }
+    auto records = log.records();
+
+    std::string label = "Replay " + path + " [" + book + "]";
+    if (opts.batch > 1) label += ", batched x" + std::to_string(opts.batch);
+    if (opts.paced) {
+        std::ostringstream speed;
+        speed << opts.speed;
+        label += ", paced x" + speed.str();
+    }
+
+    ReplayResult r = book == "map" ? replay<ob::MatchingEngine>(records, opts)
+                                   : replay<ob::LadderMatchingEngine>(records, opts);
+    print_result(label, r, records.size());
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "shm_client.h"
+#include "backoff.h"
+
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+namespace ob {
+
+ShmClient::ShmClient(const std::string& name, ShmWait wait)
+    : mapping_(ShmMapping::open(name)), wait_(wait) {
+    segment_ = static_cast<ShmSegment*>(mapping_.data());
+    if (std::atomic_ref<uint32_t>(segment_->magic).load(std::memory_order_acquire) != ShmSegment::MAGIC ||
+        segment_->version != ShmSegment::VERSION ||
+        mapping_.size() < ShmSegment::bytes(segment_->slot_count)) {
+        throw std::runtime_error("shm segment " + name + " is not an order-book segment");
+    }
+    if (!segment_->server_alive.load()) {
+        throw std::runtime_error("order-book server behind " + name + " has exited");
+    }
+
+    slot_ = nullptr;
+    for (uint32_t i = 0; i < segment_->slot_count && !slot_; ++i) {
+        ShmSlot& slot = segment_->slots()[i];
+        uint32_t expected = ShmSlot::FREE;
+        if (slot.state.compare_exchange_strong(expected, ShmSlot::CLAIMED)) slot_ = &slot;
+    }
+    if (!slot_) throw std::runtime_error("no free client slot in " + name);
+
+    slot_->pid = static_cast<int32_t>(::getpid());
+    slot_->state.store(ShmSlot::ATTACHED, std::memory_order_release);
+    segment_->request_bell.ring();
+}
+
+ShmClient::~ShmClient() {
+    slot_->state.store(ShmSlot::CLOSING, std::memory_order_release);
+    segment_->request_bell.ring();
+}
+
+bool ShmClient::connected() const {
+    return segment_->server_alive.load(std::memory_order_relaxed) &&
+           slot_->state.load(std::memory_order_relaxed) == ShmSlot::ATTACHED;
+}
+
+bool ShmClient::try_send(const OrderMessage& msg) {
+    if (!slot_->requests.try_push(msg)) return false;
+    segment_->request_bell.ring();
+    return true;
+}
+
+bool ShmClient::send(const OrderMessage& msg) {
+    while (!slot_->requests.try_push(msg)) {
+        if (!connected()) return false;
+        cpu_relax();
+    }
+    segment_->request_bell.ring();
+    return true;
+}
+
+bool ShmClient::try_receive(ResponseMessage& out) {
+    return slot_->responses.try_pop(out);
+}
+
+bool ShmClient::receive(ResponseMessage& out, int64_t timeout_us) {
+    using Clock = std::chrono::steady_clock;
+    auto deadline = Clock::now() + std::chrono::microseconds(timeout_us);
+    uint32_t spins = 0;
+    while (!slot_->responses.try_pop(out)) {
+        if (!connected()) return false;
+        // Checking the clock every spin would cost more than the spin
+        if ((++spins & 1023) == 0 && timeout_us >= 0 && Clock::now() >= deadline) return false;
+
+        if (wait_ == ShmWait::SPIN) {
+            cpu_relax();
+        } else {
+            int64_t left = -1;
+            if (timeout_us >= 0) {
+                left = std::chrono::duration_cast<std::chrono::microseconds>(
+                    deadline - Clock::now()).count();
+                if (left <= 0) return false;
+            }
+            slot_->response_bell.wait([&] { return !slot_->responses.empty_approx() || !connected(); },
+                                      left);
+        }
+    }
+    return true;
+}
+
+} // namespace ob
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "shm_transport.h"
+#include <cstdint>
+#include <string>
+
+namespace ob {
+
+// Client end of the shared-memory transport: claims a slot in the
+// server's segment (order-book-server --shm NAME) and exchanges the usual
+// protocol messages through it. Responses arrive exactly as over TCP: one
+// ACK or REJECT per request, a NEW_ORDER's FILLs behind its ACK.
+//
+// One thread sends and one receives (they may be the same); a process
+// wanting more streams opens more clients.
+class ShmClient {
+public:
+    // Throws std::runtime_error if there is no such segment, it isn't one
+    // of ours, or every slot is taken. wait picks how receive() waits.
+    explicit ShmClient(const std::string& name, ShmWait wait = ShmWait::SPIN);
+    ~ShmClient();
+
+    ShmClient(const ShmClient&) = delete;
+    ShmClient& operator=(const ShmClient&) = delete;
+
+    // Queue a request; false if the request ring is full
+    bool try_send(const OrderMessage& msg);
+
+    // Queue a request, spinning while the ring is full; false if the
+    // server has gone or dropped this client
+    bool send(const OrderMessage& msg);
+
+    bool try_receive(ResponseMessage& out);
+
+    // Next response, waiting up to timeout_us (< 0: no limit); false on
+    // timeout or if the server has gone or dropped this client
+    bool receive(ResponseMessage& out, int64_t timeout_us = -1);
+
+    // The server is up and still serving this client
+    bool connected() const;
+
+private:
+    ShmMapping mapping_;
+    ShmSegment* segment_;
+    ShmSlot* slot_;
+    ShmWait wait_;
+};
+
+} // namespace ob
@@ -0,0 +1,81 @@
+#include "shm_client.h"
+#include "latency_histogram.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+// Round-trip latency over the shared-memory transport.
+//
+// Usage: shm-ping [--shm NAME] [--pings N] [--gap-us G] [--wait spin|futex]
+//
+// Rests a bid and cancels it, over and over, one request in flight; each
+// request is answered by one ACK. --gap-us idles between requests so the
+// server's wakeup path is measured too. Run the server with --busy-poll
+// to keep the shard hop from dominating.
+
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char* argv[]) {
+    std::string name = "/ob-9000";
+    size_t pings = 100000;
+    int gap_us = 0;
+    ob::ShmWait wait = ob::ShmWait::SPIN;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--shm" && i + 1 < argc) {
+            name = argv[++i];
+            if (name.front() != '/') name.insert(0, "/");
+        } else if (arg == "--pings" && i + 1 < argc) {
+            pings = std::stoul(argv[++i]);
+        } else if (arg == "--gap-us" && i + 1 < argc) {
+            gap_us = std::stoi(argv[++i]);
+        } else if (arg == "--wait" && i + 1 < argc) {
+            wait = std::string(argv[++i]) == "futex" ? ob::ShmWait::FUTEX : ob::ShmWait::SPIN;
+        }
+    }
+
+    try {
+        ob::ShmClient client(name, wait);
+        ob::LatencyHistogram latency;
+        uint64_t last_id = 0;
+
+        for (size_t i = 0; i < pings; ++i) {
+            if (gap_us > 0) std::this_thread::sleep_for(std::chrono::microseconds(gap_us));
+
+            ob::OrderMessage msg{};
+            if (i % 2 == 0) {
+                msg.msg_type = static_cast<uint8_t>(ob::MsgType::NEW_ORDER);
+                msg.side = static_cast<uint8_t>(ob::Side::BUY);
+                msg.order_type = static_cast<uint8_t>(ob::OrderType::LIMIT);
+                msg.price = 9000;
+                msg.quantity = 10;
+            } else {
+                msg.msg_type = static_cast<uint8_t>(ob::MsgType::CANCEL);
+                msg.order_id = last_id;
+            }
+
+            ob::ResponseMessage r;
+            auto start = Clock::now();
+            if (!client.send(msg) || !client.receive(r, 1'000'000)) {
+                std::cerr << "Error: no response from the server\n";
+                return 1;
+            }
+            latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - start).count());
+            if (i % 2 == 0) last_id = r.order_id;
+        }
+
+        std::cout << "Round trip (us) over " << name << ", " << pings << " requests:\n";
+        std::cout << "  p50:   " << latency.percentile(50) / 1000.0 << "\n";
+        std::cout << "  p99:   " << latency.percentile(99) / 1000.0 << "\n";
+        std::cout << "  p99.9: " << latency.percentile(99.9) / 1000.0 << "\n";
+        std::cout << "  max:   " << latency.max() / 1000.0 << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
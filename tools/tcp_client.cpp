@@ -1,20 +1,86 @@
 #include "protocol.h"
+#include "latency_histogram.h"
 
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
+#include <cerrno>
 #include <cstring>
 #include <iostream>
 #include <chrono>
+#include <deque>
+#include <memory>
 #include <vector>
 #include <algorithm>
-#include <numeric>
 #include <random>
 #include <iomanip>
+#include <string>
+#include <thread>
 
-using Clock = std::chrono::high_resolution_clock;
+// Open-loop load generator for order-book-server.
+//
+// Usage: tcp-client [--host H] [--port P] [--connections C] [--threads T]
+//                   [--rate R] [--orders N] [--pipeline D] [--symbols K]
+//                   [--cancel-pct P] [--amend-pct P] [--aggregate] [--framed]
+//
+//   --rate R      total orders/sec across all connections, each connection
+//                 sending on its own fixed schedule; 0 sends as fast as the
+//                 pipeline allows (closed loop)
+//   --pipeline D  most requests a connection has unanswered; a connection
+//                 at the limit falls behind its schedule rather than
+//                 piling up more
+//   --symbols K   spread orders over symbol ids 0..K-1
+//   --amend-pct P re-price or resize a recently acked order in place of
+//                 P% of new orders, as a quoting client would
+//   --aggregate   open each session with AGGREGATE_FILLS: fill summary in
+//                 the ACK, one LEVEL_FILL per price
+//   --framed      open each session with FRAMED responses
+//
+// Every request is answered by one ACK or REJECT, in request order per
+// symbol on a connection, with a NEW_ORDER's FILLs behind its ACK. Latency
+// is measured to that ACK/REJECT twice: from when the request was
+// actually queued to send, and from when the schedule said it should have been.
+// The second is corrected for coordinated omission -- a stalled server
+// also delays the requests the client would have sent meanwhile, and
+// timing from the actual send would hide that wait.
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct LoadOptions {
+    const char* host = "127.0.0.1";
+    uint16_t port = 9000;
+    size_t connections = 4;
+    size_t threads = 1;
+    double rate = 100000;
+    size_t orders = 100000;
+    size_t pipeline = 64;
+    size_t symbols = 1;
+    int cancel_pct = 10;
+    int amend_pct = 0;
+    uint8_t session_flags = 0;   // sent as a SESSION request when non-zero
+};
+
+struct ThreadStats {
+    ob::LatencyHistogram corrected;   // ns from intended send
+    ob::LatencyHistogram raw;         // ns from actual send
+    uint64_t acks = 0;
+    uint64_t rejects = 0;
+    uint64_t fills = 0;
+    uint64_t responses = 0;   // messages, the SESSION ACK aside
+    uint64_t bytes = 0;       // received, framing included
+    bool failed = false;
+};
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
 
 int connect_to_server(const char* host, uint16_t port) {
     int fd = socket(AF_INET, SOCK_STREAM, 0);
@@ -33,92 +99,331 @@ int connect_to_server(const char* host, uint16_t port) {
         close(fd);
         return -1;
     }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
     return fd;
 }
 
-void send_order(int fd, ob::Side side, ob::OrderType type, int64_t price, uint32_t qty) {
-    ob::OrderMessage msg{};
-    msg.msg_type = static_cast<uint8_t>(ob::MsgType::NEW_ORDER);
-    msg.side = static_cast<uint8_t>(side);
-    msg.order_type = static_cast<uint8_t>(type);
-    msg.price = price;
-    msg.quantity = qty;
-
-    char buf[sizeof(ob::OrderMessage)];
-    ob::serialize(msg, buf);
-    write(fd, buf, sizeof(buf));
-}
+class Connection {
+public:
+    Connection(int fd, const LoadOptions& opts, size_t quota, int64_t first_send,
+               int64_t interval, uint64_t seed)
+        : fd_(fd), opts_(opts), quota_(quota), next_send_(first_send), interval_(interval),
+          rng_(seed), pending_(opts.symbols), live_(opts.symbols) {
+        if (opts.session_flags) {
+            ob::OrderMessage msg = ob::make_session_request(opts.session_flags);
+            out_.resize(sizeof(msg));
+            ob::serialize(msg, out_.data());
+            awaiting_session_ack_ = true;
+        }
+    }
+
+    ~Connection() { if (fd_ >= 0) close(fd_); }
+
+    int fd() const { return fd_; }
+    bool all_sent() const { return sent_ == quota_; }
+    bool finished() const { return all_sent() && in_flight_ == 0; }
+    bool wants_write() const { return out_off_ < out_.size(); }
 
-ob::ResponseMessage read_response(int fd) {
-    char buf[sizeof(ob::ResponseMessage)];
-    size_t total = 0;
-    while (total < sizeof(buf)) {
-        ssize_t n = read(fd, buf + total, sizeof(buf) - total);
-        if (n <= 0) break;
-        total += n;
+    // Queue every request the schedule has due by now. Returns the next
+    // send time, or INT64_MAX if nothing more can go until replies arrive.
+    int64_t schedule(int64_t now) {
+        while (sent_ < quota_ && in_flight_ < opts_.pipeline) {
+            if (opts_.rate > 0 && next_send_ > now) return next_send_;
+            int64_t intended = opts_.rate > 0 ? next_send_ : now;
+            enqueue(intended, now);
+            next_send_ += interval_;
+        }
+        return INT64_MAX;
     }
-    ob::ResponseMessage resp{};
-    ob::deserialize(buf, resp);
-    return resp;
-}
 
-int main(int argc, char* argv[]) {
-    const char* host = "127.0.0.1";
-    uint16_t port = 9000;
-    int num_orders = 10000;
+    // False if the peer is gone
+    bool flush() {
+        while (out_off_ < out_.size()) {
+            ssize_t n = ::send(fd_, out_.data() + out_off_, out_.size() - out_off_, MSG_NOSIGNAL);
+            if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+            out_off_ += static_cast<size_t>(n);
+        }
+        out_.clear();
+        out_off_ = 0;
+        return true;
+    }
+
+    bool read(ThreadStats& stats) {
+        for (;;) {
+            ssize_t n = ::recv(fd_, in_ + in_len_, sizeof(in_) - in_len_, 0);
+            if (n == 0) return false;
+            if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+            in_len_ += static_cast<size_t>(n);
+            stats.bytes += static_cast<uint64_t>(n);
+
+            int64_t now = now_ns();
+            bool framed = opts_.session_flags & ob::SessionFlags::FRAMED;
+            size_t off = ob::decode_responses(in_, in_len_, framed, [&](const ob::ResponseMessage& r) {
+                on_response(r, now, stats);
+            });
+            if (off == SIZE_MAX) return false;
+            std::memmove(in_, in_ + off, in_len_ - off);
+            in_len_ -= off;
+        }
+    }
+
+private:
+    struct Pending {
+        int64_t intended_ns;
+        int64_t sent_ns;
+        bool    new_order;   // its ACK carries a new live id
+    };
+    static constexpr size_t LIVE_IDS = 1024;
+
+    int fd_;
+    const LoadOptions& opts_;
+    size_t quota_;
+    size_t sent_ = 0;
+    size_t in_flight_ = 0;
+    int64_t next_send_;
+    int64_t interval_;
+    std::mt19937_64 rng_;
+    std::vector<char> out_;
+    size_t out_off_ = 0;
+    char in_[64 * 1024];   // holds a whole frame (MAX_FRAME_BYTES)
+    size_t in_len_ = 0;
+    bool awaiting_session_ack_ = false;
+    std::vector<std::deque<Pending>> pending_;    // by symbol
+    std::vector<std::vector<ob::OrderId>> live_;  // recently acked ids, by symbol
 
-    for (int i = 1; i < argc; ++i) {
-        if (std::strcmp(argv[i], "--host") == 0 && i + 1 < argc) host = argv[++i];
-        else if (std::strcmp(argv[i], "--port") == 0 && i + 1 < argc) port = std::stoi(argv[++i]);
-        else if (std::strcmp(argv[i], "--orders") == 0 && i + 1 < argc) num_orders = std::stoi(argv[++i]);
+    void enqueue(int64_t intended, int64_t now) {
+        ob::OrderMessage msg{};
+        auto symbol = static_cast<ob::SymbolId>(rng_() % opts_.symbols);
+        msg.symbol_id = symbol;
+        auto& ids = live_[symbol];
+        int roll = static_cast<int>(rng_() % 100);
+        bool cancel = !ids.empty() && roll < opts_.cancel_pct;
+        bool amend = !ids.empty() && !cancel && roll < opts_.cancel_pct + opts_.amend_pct;
+        if (cancel) {
+            size_t pick = rng_() % ids.size();
+            msg.msg_type = static_cast<uint8_t>(ob::MsgType::CANCEL);
+            msg.order_id = ids[pick];
+            ids[pick] = ids.back();
+            ids.pop_back();
+        } else if (amend) {
+            msg.msg_type = static_cast<uint8_t>(ob::MsgType::AMEND);
+            msg.order_id = ids[rng_() % ids.size()];
+            msg.price = 9900 + static_cast<int64_t>(rng_() % 201);
+            msg.quantity = 1 + static_cast<uint32_t>(rng_() % 100);
+        } else {
+            msg.msg_type = static_cast<uint8_t>(ob::MsgType::NEW_ORDER);
+            msg.side = static_cast<uint8_t>(rng_() & 1 ? ob::Side::BUY : ob::Side::SELL);
+            msg.order_type = static_cast<uint8_t>(ob::OrderType::LIMIT);
+            msg.price = 9900 + static_cast<int64_t>(rng_() % 201);
+            msg.quantity = 1 + static_cast<uint32_t>(rng_() % 100);
+        }
+
+        size_t at = out_.size();
+        out_.resize(at + sizeof(msg));
+        ob::serialize(msg, out_.data() + at);
+        pending_[symbol].push_back({intended, now, !cancel && !amend});
+        ++sent_;
+        ++in_flight_;
     }
 
-    std::cout << "Connecting to " << host << ":" << port << "...\n";
-    int fd = connect_to_server(host, port);
-    if (fd < 0) return 1;
+    void on_response(const ob::ResponseMessage& resp, int64_t now, ThreadStats& stats) {
+        auto type = static_cast<ob::MsgType>(resp.msg_type);
+        if (awaiting_session_ack_) {
+            awaiting_session_ack_ = false;
+            return;
+        }
+        ++stats.responses;
+        if (type == ob::MsgType::FILL) {
+            // With --aggregate these are counted through their LEVEL_FILL
+            if (!(opts_.session_flags & ob::SessionFlags::AGGREGATE_FILLS)) ++stats.fills;
+            return;
+        }
+        if (type == ob::MsgType::LEVEL_FILL) {
+            stats.fills += resp.match_id;
+            return;
+        }
+        if (resp.symbol_id >= pending_.size() || pending_[resp.symbol_id].empty()) {
+            return;   // not ours to match; the server echoes symbols it was sent
+        }
+        Pending p = pending_[resp.symbol_id].front();
+        pending_[resp.symbol_id].pop_front();
+        --in_flight_;
 
-    std::cout << "Connected. Sending " << num_orders << " orders...\n";
+        stats.corrected.record(static_cast<uint64_t>(now - p.intended_ns));
+        stats.raw.record(static_cast<uint64_t>(now - p.sent_ns));
+        if (type == ob::MsgType::ACK) {
+            ++stats.acks;
+            auto& ids = live_[resp.symbol_id];
+            if (p.new_order && ids.size() < LIVE_IDS) ids.push_back(resp.order_id);
+        } else {
+            ++stats.rejects;
+        }
+    }
+};
+
+void run_thread(std::vector<std::unique_ptr<Connection>>& conns, ThreadStats& stats) {
+    std::vector<pollfd> fds;
+    int64_t give_up = INT64_MAX;
+
+    for (;;) {
+        int64_t now = now_ns();
+        int64_t next_due = INT64_MAX;
+        bool all_finished = true;
+        bool all_sent = true;
+        fds.clear();
+        for (auto& c : conns) {
+            if (!c) continue;
+            next_due = std::min(next_due, c->schedule(now));
+            if (!c->flush()) {
+                stats.failed = true;
+                c.reset();
+                continue;
+            }
+            all_finished &= c->finished();
+            all_sent &= c->all_sent();
+            fds.push_back({c->fd(), static_cast<short>(POLLIN | (c->wants_write() ? POLLOUT : 0)), 0});
+        }
+        if (all_finished || fds.empty()) return;
 
-    std::mt19937 rng(42);
-    std::uniform_int_distribution<int> side_dist(0, 1);
-    std::uniform_int_distribution<int> price_dist(9900, 10100);
-    std::uniform_int_distribution<uint32_t> qty_dist(1, 100);
+        // Everything sent: allow the stragglers a few seconds, counted
+        // from the last reply
+        if (all_sent && give_up == INT64_MAX) give_up = now + 5'000'000'000;
+        if (now > give_up) {
+            stats.failed = true;
+            return;
+        }
 
-    std::vector<double> latencies;
-    latencies.reserve(num_orders);
+        // Sleep in poll only when the next send is over a millisecond
+        // away; closer than that, spin so the schedule is kept
+        int timeout = 0;
+        if (next_due == INT64_MAX) {
+            timeout = 10;
+        } else if (next_due - now > 1'000'000) {
+            timeout = static_cast<int>((next_due - now) / 1'000'000);
+        }
+        if (poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR) {
+            perror("poll");
+            stats.failed = true;
+            return;
+        }
 
-    for (int i = 0; i < num_orders; ++i) {
-        ob::Side side = side_dist(rng) ? ob::Side::BUY : ob::Side::SELL;
-        int64_t price = price_dist(rng);
-        uint32_t qty = qty_dist(rng);
+        size_t k = 0;
+        for (auto& c : conns) {
+            if (!c) continue;
+            if (fds[k++].revents & (POLLIN | POLLHUP | POLLERR)) {
+                if (!c->read(stats)) {
+                    stats.failed = true;
+                    c.reset();
+                }
+                give_up = INT64_MAX;
+            }
+        }
+    }
+}
 
-        auto start = Clock::now();
-        send_order(fd, side, ob::OrderType::LIMIT, price, qty);
-        auto resp = read_response(fd);
-        auto end = Clock::now();
+void print_latency(const char* label, const ob::LatencyHistogram& h) {
+    std::cout << "Latency (us, " << label << "):\n";
+    std::cout << "  mean:  " << h.mean() / 1000 << "\n";
+    std::cout << "  p50:   " << h.percentile(50) / 1000.0 << "\n";
+    std::cout << "  p95:   " << h.percentile(95) / 1000.0 << "\n";
+    std::cout << "  p99:   " << h.percentile(99) / 1000.0 << "\n";
+    std::cout << "  p99.9: " << h.percentile(99.9) / 1000.0 << "\n";
+    std::cout << "  max:   " << h.max() / 1000.0 << "\n";
+}
 
-        double us = std::chrono::duration<double, std::micro>(end - start).count();
-        latencies.push_back(us);
+} // namespace
 
-        // Drain any fill messages
-        if (static_cast<ob::MsgType>(resp.msg_type) == ob::MsgType::ACK) {
-            // There may be fill messages following, but for simplicity
-            // we only measure the ACK round-trip
+int main(int argc, char* argv[]) {
+    LoadOptions opts;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--host" && i + 1 < argc) opts.host = argv[++i];
+            else if (arg == "--port" && i + 1 < argc) opts.port = static_cast<uint16_t>(std::stoi(argv[++i]));
+            else if (arg == "--connections" && i + 1 < argc) opts.connections = std::stoul(argv[++i]);
+            else if (arg == "--threads" && i + 1 < argc) opts.threads = std::stoul(argv[++i]);
+            else if (arg == "--rate" && i + 1 < argc) opts.rate = std::stod(argv[++i]);
+            else if (arg == "--orders" && i + 1 < argc) opts.orders = std::stoul(argv[++i]);
+            else if (arg == "--pipeline" && i + 1 < argc) opts.pipeline = std::stoul(argv[++i]);
+            else if (arg == "--symbols" && i + 1 < argc) opts.symbols = std::stoul(argv[++i]);
+            else if (arg == "--cancel-pct" && i + 1 < argc) opts.cancel_pct = std::stoi(argv[++i]);
+            else if (arg == "--amend-pct" && i + 1 < argc) opts.amend_pct = std::stoi(argv[++i]);
+            else if (arg == "--aggregate") opts.session_flags |= ob::SessionFlags::AGGREGATE_FILLS;
+            else if (arg == "--framed") opts.session_flags |= ob::SessionFlags::FRAMED;
         }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
     }
+    opts.connections = std::max<size_t>(1, opts.connections);
+    opts.threads = std::clamp<size_t>(opts.threads, 1, opts.connections);
+    opts.pipeline = std::max<size_t>(1, opts.pipeline);
+    opts.symbols = std::clamp<size_t>(opts.symbols, 1, 65536);
 
-    close(fd);
+    std::cout << "Connecting " << opts.connections << " clients to " << opts.host << ":"
+              << opts.port << "...\n";
 
-    std::sort(latencies.begin(), latencies.end());
-    size_t n = latencies.size();
+    // Each connection sends rate / C on its own schedule, staggered so
+    // they don't all fire on the same tick
+    int64_t interval = opts.rate > 0
+                           ? static_cast<int64_t>(1e9 * opts.connections / opts.rate) : 0;
+    int64_t start = now_ns() + 10'000'000;
+    std::vector<std::vector<std::unique_ptr<Connection>>> per_thread(opts.threads);
+    for (size_t i = 0; i < opts.connections; ++i) {
+        int fd = connect_to_server(opts.host, opts.port);
+        if (fd < 0) return 1;
+        size_t quota = opts.orders / opts.connections + (i < opts.orders % opts.connections);
+        int64_t first = start + interval * static_cast<int64_t>(i) / static_cast<int64_t>(opts.connections);
+        per_thread[i % opts.threads].push_back(
+            std::make_unique<Connection>(fd, opts, quota, first, interval, 42 + i));
+    }
+    start = std::max(start, now_ns());
 
+    std::cout << "Sending " << opts.orders << " orders...\n";
+    std::vector<ThreadStats> stats(opts.threads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < opts.threads; ++t) {
+        threads.emplace_back([&, t] { run_thread(per_thread[t], stats[t]); });
+    }
+    for (auto& th : threads) th.join();
+    double seconds = (now_ns() - start) / 1e9;
+
+    ThreadStats total;
+    for (const auto& s : stats) {
+        total.corrected.merge(s.corrected);
+        total.raw.merge(s.raw);
+        total.acks += s.acks;
+        total.rejects += s.rejects;
+        total.fills += s.fills;
+        total.responses += s.responses;
+        total.bytes += s.bytes;
+        total.failed |= s.failed;
+    }
+
+    std::cout << "\n=== TCP Load (" << opts.connections << " connections, " << opts.threads
+              << " threads, pipeline " << opts.pipeline << ", target ";
+    if (opts.rate > 0) {
+        std::cout << std::fixed << std::setprecision(0) << opts.rate << "/s) ===\n";
+    } else {
+        std::cout << "closed loop) ===\n";
+    }
+    std::cout << "Orders:     " << opts.orders << "\n";
+    std::cout << "Answered:   " << total.acks + total.rejects << " (" << total.rejects
+              << " rejected)\n";
+    std::cout << "Fills:      " << total.fills << "\n";
     std::cout << std::fixed << std::setprecision(1);
-    std::cout << "\n=== Round-trip Latency (us) ===\n";
-    std::cout << "  mean:  " << std::accumulate(latencies.begin(), latencies.end(), 0.0) / n << "\n";
-    std::cout << "  p50:   " << latencies[n * 50 / 100] << "\n";
-    std::cout << "  p95:   " << latencies[n * 95 / 100] << "\n";
-    std::cout << "  p99:   " << latencies[n * 99 / 100] << "\n";
-    std::cout << "  p99.9: " << latencies[std::min(n - 1, n * 999 / 1000)] << "\n";
+    std::cout << "Responses:  " << total.responses << " messages, " << total.bytes << " bytes ("
+              << static_cast<double>(total.bytes) / std::max<size_t>(1, opts.orders)
+              << " per order)\n";
+    std::cout << std::setprecision(0);
+    std::cout << "Throughput: " << (total.acks + total.rejects) / seconds << " orders/sec\n";
+    std::cout << std::setprecision(1);
+    print_latency("from schedule, corrected", total.corrected);
+    print_latency("from send", total.raw);
 
+    if (total.failed) {
+        std::cerr << "Warning: connections failed or replies went missing\n";
+        return 1;
+    }
     return 0;
 }